@@ -36,6 +36,10 @@ using namespace std;
 
 void testTutorialOne();
 
+// Test that analyzing the states in parallel windows reproduces the serial
+// results.
+void testTutorialOneMultiThreaded();
+
 // Test different default activations are respected when activation
 // states are not provided.
 void testTugOfWar(const string& dataFileName, const double& defaultAct);
@@ -49,6 +53,12 @@ int main()
         cout << e.what() << endl; failures.push_back("testTutorialOne");
     }
 
+    try { testTutorialOneMultiThreaded(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testTutorialOneMultiThreaded");
+    }
+
     // produce passive force-length curve
     try { testTugOfWar("Tug_of_War_ConstantVelocity.sto", 0.01); }
     catch (const std::exception& e) {
@@ -104,6 +114,25 @@ void testTutorialOne() {
     cout << "testAnalyzeTutorialOne passed" << endl;
 }
 
+void testTutorialOneMultiThreaded() {
+    AnalyzeTool serial("PlotterTool.xml");
+    serial.setName("BothLegsSerial");
+    serial.run();
+    AnalyzeTool analyze("PlotterTool.xml");
+    analyze.setName("BothLegsThreaded");
+    analyze.setNumThreads(3);
+    analyze.run();
+    Storage resultFiberLength("testPlotterTool/BothLegsThreaded__FiberLength.sto");
+    Storage serialFiberLength("testPlotterTool/BothLegsSerial__FiberLength.sto");
+    ASSERT(resultFiberLength.getSize() == serialFiberLength.getSize(),
+        __FILE__, __LINE__,
+        "Threaded analysis recorded a different number of rows.");
+    CHECK_STORAGE_AGAINST_STANDARD(resultFiberLength, serialFiberLength,
+        std::vector<double>(100, 0.0001), __FILE__, __LINE__,
+        "testTutorialOneMultiThreaded failed");
+    cout << "testTutorialOneMultiThreaded passed" << endl;
+}
+
 void testTugOfWar(const string& dataFileName, const double& defaultAct) {
     AnalyzeTool analyze("Tug_of_War_Setup_Analyze.xml");
     analyze.setCoordinatesFileName("");
@@ -37,6 +37,7 @@ using namespace std;
 // Prototypes
 void testDoublePendulumWithSolver();
 void testDoublePendulum();
+void testSolveContributorsTogether();
 Vector calcDoublePendulumUdot(const Model &model, State &s, double Torq1, double Torq2, bool gravity, bool velocity);
 
 int main()
@@ -49,6 +50,8 @@ int main()
         // check that analysis version still works
         testDoublePendulum();
 
+        testSolveContributorsTogether();
+
         AnalyzeTool analyze("subject02_Setup_IAA_02_232.xml");
         analyze.run();
         Storage result1("ResultsInducedAccelerations/subject02_running_arms_InducedAccelerations_center_of_mass.sto");
@@ -228,6 +231,42 @@ void testDoublePendulum()
     cout << "Analysis computed " << nt << " frames in " << 1.e3*(std::clock()-startTime)/CLOCKS_PER_SEC << "ms\n" << endl;
 }
 
+void testSolveContributorsTogether()
+{
+    // Solving for the contributors together (the default) must give the same
+    // accelerations as realizing the model for each contributor, with muscles
+    // and contact constraints.
+    auto runAnalysis = [](bool together, const std::string& resultsDir) {
+        AnalyzeTool analyze("subject02_Setup_IAA_02_232.xml");
+        analyze.setResultsDir(resultsDir);
+        analyze.setFinalTime(0.80);
+        Analysis& iaa = analyze.getAnalysisSet().get("InducedAccelerations");
+        PropertySet& props = iaa.getPropertySet();
+        props.get("coordinate_names")->getValueStrArray() =
+            Array<std::string>("hip_flexion_r", 1);
+        Array<std::string> bodies("pelvis", 1);
+        bodies.append("center_of_mass");
+        props.get("body_names")->getValueStrArray() = bodies;
+        props.get("report_constraint_reactions")->getValueBool() = false;
+        props.get("solve_contributors_together")->getValueBool() = together;
+        analyze.run();
+    };
+    runAnalysis(false, "ResultsInducedAccelerationsEach");
+    runAnalysis(true, "ResultsInducedAccelerationsTogether");
+
+    for (const std::string& name :
+            {"hip_flexion_r", "pelvis", "center_of_mass"}) {
+        const std::string file =
+            "/subject02_running_arms_InducedAccelerations_" + name + ".sto";
+        Storage each("ResultsInducedAccelerationsEach" + file);
+        Storage together("ResultsInducedAccelerationsTogether" + file);
+        CHECK_STORAGE_AGAINST_STANDARD(together, each,
+            std::vector<double>(each.getSmallestNumberOfStates(), 1e-6),
+            __FILE__, __LINE__,
+            "Induced Accelerations of " + name + " solved together failed");
+    }
+    cout << "Induced Accelerations solved together passed\n" << endl;
+}
 
 Vector calcDoublePendulumUdot(const Model &model, State &s, double Torq1, double Torq2, bool gravity, bool velocity)
 {   
@@ -40,6 +40,8 @@ void testArm26(const string& muscleModelClassName, double atol, double ftol);
 
 void testArm26DisabledMuscles();
 
+void testArm26PersistentOptimizer();
+
 void testLapackErrorDLASD4();
 
 void testModelWithPassiveForces();
@@ -105,6 +107,14 @@ int main()
         failures.push_back("testArm26DisabledMuscles");
     }
 
+    try {
+        testArm26PersistentOptimizer();
+    }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testArm26PersistentOptimizer");
+    }
+
     if (!failures.empty()) {
         cout << "Done, with failure(s): " << failures << endl;
         return 1;
@@ -265,4 +275,68 @@ void testArm26DisabledMuscles() {
     ASSERT_EQUAL(forces.getColumnLabels().findIndex("TRIlat"), -1);
     ASSERT_EQUAL(forces.getColumnLabels().findIndex("TRImed"), -1);
 
-}
\ No newline at end of file
+}
+
+// Compare the row of `single` (one frame) with the row of `all` at the same
+// time.
+void compareFrame(const Storage& all, const Storage& single, double tol,
+                  const std::string& name) {
+    ASSERT_EQUAL(1, single.getSize(), __FILE__, __LINE__,
+                 name + ": expected exactly one frame.");
+    const StateVector& row = *single.getStateVector(0);
+    int index = -1;
+    for (int i = 0; i < all.getSize(); ++i) {
+        if (std::abs(all.getStateVector(i)->getTime() - row.getTime()) < 1e-8)
+            index = i;
+    }
+    ASSERT(index >= 0, __FILE__, __LINE__,
+           name + ": frame at time " + std::to_string(row.getTime()) +
+           " is missing.");
+    const Array<double>& expected = all.getStateVector(index)->getData();
+    const Array<double>& found = row.getData();
+    ASSERT_EQUAL(expected.getSize(), found.getSize(), __FILE__, __LINE__,
+                 name + ": number of columns differs.");
+    for (int j = 0; j < expected.getSize(); ++j) {
+        ASSERT_EQUAL(expected[j], found[j], tol, __FILE__, __LINE__,
+                     name + ": column '" + single.getColumnLabels()[j + 1] +
+                     "' differs at time " + std::to_string(row.getTime()));
+    }
+}
+
+void testArm26PersistentOptimizer() {
+    // StaticOptimization keeps one target and optimizer for all frames of an
+    // analysis and warm starts each frame from the previous one. Solving a
+    // frame on its own, with a new target and optimizer as was done for
+    // every frame before, must give the same activations and forces.
+    AnalyzeTool analyze("arm26_Setup_StaticOptimization.xml");
+    analyze.setResultsDir("Results_arm26_StaticOptimization_Persistent");
+    analyze.run();
+    Storage activations(analyze.getResultsDir() +
+                        "/arm26_StaticOptimization_activation.sto");
+    Storage forces(analyze.getResultsDir() +
+                   "/arm26_StaticOptimization_force.sto");
+    const int numFrames = activations.getSize();
+    ASSERT(numFrames > 3, __FILE__, __LINE__,
+           "Expected a motion with multiple frames.");
+
+    // Interior frames, so that the frame solved on its own is also in the
+    // full analysis even if the time read from file was rounded.
+    for (int frame : {1, numFrames / 2, numFrames - 2}) {
+        const double time = activations.getStateVector(frame)->getTime();
+        AnalyzeTool single("arm26_Setup_StaticOptimization.xml");
+        single.setResultsDir("Results_arm26_StaticOptimization_Frame" +
+                             std::to_string(frame));
+        single.setInitialTime(time);
+        single.setFinalTime(time);
+        single.run();
+        Storage singleActivations(single.getResultsDir() +
+                                  "/arm26_StaticOptimization_activation.sto");
+        Storage singleForces(single.getResultsDir() +
+                             "/arm26_StaticOptimization_force.sto");
+        compareFrame(activations, singleActivations, 1e-3,
+                     "Arm26 persistent optimizer activations");
+        compareFrame(forces, singleForces, 1.0,
+                     "Arm26 persistent optimizer forces");
+    }
+    cout << "testArm26PersistentOptimizer passed." << endl;
+}
@@ -53,6 +53,26 @@ void testCMCArm26() {
     cout << "\n" << base <<" passed\n" << endl;
 }
 
+// Same as above, but integrating each muscle independently (with 2 threads)
+// when predicting the muscle forces.
+void testCMCArm26IntegratingActuatorsIndependently() {
+    CMCTool cmc("arm26_Setup_CMC.xml");
+    cmc.setIntegrateActuatorsIndependently(true);
+    cmc.setNumThreads(2);
+    cmc.setResultsDir("Results_Arm26_Independent");
+    cmc.run();
+
+    Storage results("Results_Arm26_Independent/arm26_states.sto"),
+            temp("std_arm26_states.sto");
+    Storage standard;
+    cmc.getModel().formStateStorage(temp, standard);
+
+    std::vector<double> rms_tols(2*2+2*6, 0.01);
+    CHECK_STORAGE_AGAINST_STANDARD(results, standard, rms_tols, __FILE__,
+        __LINE__, "testCMCArm26IntegratingActuatorsIndependently failed");
+
+    cout << "\ntestCMCArm26IntegratingActuatorsIndependently passed\n" << endl;
+}
 
 int main() {
 
@@ -63,6 +83,12 @@ int main() {
     } catch(const std::exception& e) {  
         cout << e.what() <<endl; failures.push_back("testCMCArm26"); 
     }
+    try{
+        testCMCArm26IntegratingActuatorsIndependently();
+    } catch(const std::exception& e) {
+        cout << e.what() <<endl;
+        failures.push_back("testCMCArm26IntegratingActuatorsIndependently");
+    }
 
     if (!failures.empty()) {
         cout << "Done, with failure(s): " << failures << endl;
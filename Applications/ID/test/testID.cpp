@@ -33,6 +33,65 @@
 using namespace OpenSim;
 using namespace std;
 
+// The results written with one and with three threads must be identical.
+void compareResultsOfThreads(const string& name)
+{
+    Storage serial("Results/" + name + "_threads1.sto");
+    Storage parallel("Results/" + name + "_threads3.sto");
+    ASSERT_EQUAL(serial.getSize(), parallel.getSize(),
+            __FILE__, __LINE__, name + ": number of rows differ.");
+    ASSERT(serial.getColumnLabels() == parallel.getColumnLabels(),
+            __FILE__, __LINE__, name + ": column labels differ.");
+    for (int i = 0; i < serial.getSize(); ++i) {
+        const StateVector& expected = *serial.getStateVector(i);
+        const StateVector& found = *parallel.getStateVector(i);
+        ASSERT(expected.getTime() == found.getTime(), __FILE__, __LINE__);
+        for (int j = 0; j < expected.getSize(); ++j) {
+            ASSERT(expected.getData()[j] == found.getData()[j],
+                    __FILE__, __LINE__,
+                    name + ": values differ at row " + to_string(i) +
+                    ", column " + to_string(j) + ".");
+        }
+    }
+}
+
+// Solving the times on multiple threads must give exactly the same
+// generalized forces and body forces at the joints as on a single thread.
+void testGaitWithMultipleThreads()
+{
+    Array<string> joints("All", 1);
+    for (int numThreads : {1, 3}) {
+        InverseDynamicsTool id("subject01_Setup_InverseDynamics.xml");
+        id.setNumThreads(numThreads);
+        id.setOutputGenForceFileName("subject01_InverseDynamics_threads" +
+                to_string(numThreads) + ".sto");
+        id.getPropertySet().get("joints_to_report_body_forces")->
+                setValue(joints);
+        id.getPropertySet().get("output_body_forces_file")->setValue(
+                "subject01_BodyForces_threads" + to_string(numThreads) +
+                ".sto");
+        id.run();
+    }
+    compareResultsOfThreads("subject01_InverseDynamics");
+    compareResultsOfThreads("subject01_BodyForces");
+}
+
+// Same with the forces of the muscles of arm26, whose paths wrap over wrap
+// objects, so that every thread wraps the paths of its copy of the model.
+void testArmWrappingMusclesWithMultipleThreads()
+{
+    for (int numThreads : {1, 3}) {
+        InverseDynamicsTool id("arm26_Setup_InverseDynamics.xml");
+        id.setNumThreads(numThreads);
+        id.getPropertySet().get("forces_to_exclude")->
+                setValue(Array<string>());
+        id.setOutputGenForceFileName("arm26_InverseDynamicsMuscles_threads" +
+                to_string(numThreads) + ".sto");
+        id.run();
+    }
+    compareResultsOfThreads("arm26_InverseDynamicsMuscles");
+}
+
 int main()
 {
     try {
@@ -51,6 +110,12 @@ int main()
             std::vector<double>(23, 2.0), __FILE__, __LINE__,
             "testGait failed");
         cout << "testGait passed" << endl;
+
+        testGaitWithMultipleThreads();
+        cout << "testGaitWithMultipleThreads passed" << endl;
+
+        testArmWrappingMusclesWithMultipleThreads();
+        cout << "testArmWrappingMusclesWithMultipleThreads passed" << endl;
     }
     catch (const Exception& e) {
         e.print(cerr);
@@ -106,6 +106,31 @@ int main()
         failures.push_back("testInverseKinematicsGait2354_GUI_workflow");
     }
 
+    try {
+        // Solving chunks of frames concurrently must reproduce the serial
+        // solution to within the solver accuracy.
+        InverseKinematicsTool ikSerial("subject01_Setup_InverseKinematics.xml");
+        ikSerial.setOutputMotionFileName("subject01_walk1_ik_serial.mot");
+        ikSerial.run();
+        InverseKinematicsTool ikParallel(
+                "subject01_Setup_InverseKinematics.xml");
+        ikParallel.setNumThreads(3);
+        ikParallel.setOutputMotionFileName("subject01_walk1_ik_parallel.mot");
+        ikParallel.run();
+        Storage serial(ikSerial.getOutputMotionFileName());
+        Storage parallel(ikParallel.getOutputMotionFileName());
+        ASSERT(parallel.getSize() == serial.getSize(), __FILE__, __LINE__,
+                "testInverseKinematicsParallel: number of frames differ.");
+        CHECK_STORAGE_AGAINST_STANDARD(parallel, serial,
+            std::vector<double>(24, 1e-3), __FILE__, __LINE__,
+            "testInverseKinematicsParallel failed");
+        cout << "testInverseKinematicsParallel passed" << endl;
+    }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testInverseKinematicsParallel");
+    }
+
     try {
         InverseKinematicsTool ik3("constraintTest_setup_ik.xml");
         ik3.run();
@@ -23,6 +23,7 @@
 
 #include "opensim-cmd_info.h"
 #include "opensim-cmd_print-xml.h"
+#include "opensim-cmd_run-ensemble.h"
 #include "opensim-cmd_run-tool.h"
 #include "opensim-cmd_update-file.h"
 #include "opensim-cmd_viz.h"
@@ -53,6 +54,7 @@ Options:
 
 Available commands:
   run-tool     Run a tool (e.g., Inverse Kinematics) from an XML setup file.
+  run-ensemble Run many forward simulations of a model concurrently.
   print-xml    Print a template XML file for a Tool or class.
   info         Show description of properties in an OpenSim class.
   update-file  Update an .xml file (.osim or setup) to this version's format.
@@ -73,6 +75,7 @@ Description of options:
 
 Examples:
   opensim-cmd run-tool InverseDynamics_Setup.xml
+  opensim-cmd run-ensemble -f 0.5 arm26.osim runs.sto
   opensim-cmd print-xml cmc
   opensim-cmd info PathActuator
   opensim-cmd update-file lowerlimb_v3.3.osim lowerlimb_updated.osim
@@ -94,6 +97,7 @@ int main(int argc, const char** argv) {
 
     commands["print-xml"] = print_xml;
     commands["run-tool"] = run_tool;
+    commands["run-ensemble"] = run_ensemble;
     commands["info"] = info;
     commands["update-file"] = update_file;
     commands["viz"] = viz;
@@ -0,0 +1,105 @@
+#ifndef OPENSIM_CMD_RUN_ENSEMBLE_H_
+#define OPENSIM_CMD_RUN_ENSEMBLE_H_
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  opensim-cmd_run-ensemble.h                    *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "parse_arguments.h"
+#include <docopt.h>
+#include <iostream>
+
+#include <OpenSim/OpenSim.h>
+#include <OpenSim/Simulation/Manager/EnsembleRunner.h>
+
+static const char HELP_RUN_ENSEMBLE[] =
+R"(Run many forward simulations of a model concurrently.
+
+Usage:
+  opensim-cmd [options]... run-ensemble [--final-time=<t>] [--initial-time=<t>] [--threads=<n>] [--interval=<dt>] [--results-dir=<dir>] [--output=<path>]... <model-file> <runs-file>
+  opensim-cmd run-ensemble -h | --help
+
+Options:
+  -L <path>, --library <path>  Load a plugin.
+  -o <level>, --log <level>  Logging level.
+  -f <t>, --final-time <t>  Time at which the runs end [default: 1].
+  -i <t>, --initial-time <t>  Time at which the runs start [default: 0].
+  -j <n>, --threads <n>  Number of runs integrated at the same time.
+  -d <dt>, --interval <dt>  Time interval for recording results [default: 0.01].
+  -r <dir>, --results-dir <dir>  Directory for the results [default: .].
+  -O <path>, --output <path>  Record an output, e.g., /forceset/BIC|fiber_length.
+
+Description:
+  The model is loaded once, and each run integrates a copy of it. The runs
+  are given by <runs-file>, a table (e.g., .sto or .csv) with one row per run;
+  its time column is only used to order the runs. Each column label is either
+  the path of a state variable, whose initial value is set, or the path of a
+  component, '|' and the name of a property of type double, whose value is
+  set, for example:
+
+            /jointset/r_elbow/r_elbow_flex/value
+            /forceset/BIClong|max_isometric_force
+
+  For each run, named run_<i> after its row, the states and the outputs are
+  written to run_<i>_states.sto and run_<i>_outputs.sto, and each analysis in
+  the model writes its usual files. By default, as many runs are integrated
+  at the same time as there are hardware threads.
+
+Examples:
+  opensim-cmd run-ensemble -f 0.5 arm26.osim runs.sto
+  opensim-cmd run-ensemble -j 4 -r results -O /forceset/BIClong|fiber_length arm26.osim runs.sto
+)";
+
+int run_ensemble(int argc, const char** argv) {
+
+    using namespace OpenSim;
+
+    std::map<std::string, docopt::value> args = OpenSim::parse_arguments(
+            HELP_RUN_ENSEMBLE, { argv + 1, argv + argc },
+            true); // show help if requested
+
+    Model model(args["<model-file>"].asString());
+    EnsembleRunner runner(model);
+    runner.addRunsFromTable(TimeSeriesTable(args["<runs-file>"].asString()));
+    runner.setInitialTime(std::stod(args["--initial-time"].asString()));
+    runner.setFinalTime(std::stod(args["--final-time"].asString()));
+    runner.setReportingInterval(std::stod(args["--interval"].asString()));
+    if (args["--threads"]) {
+        runner.setNumThreads(std::stoi(args["--threads"].asString()));
+    }
+    for (const auto& output : args["--output"].asStringList()) {
+        runner.addOutput(output);
+    }
+    runner.setResultsDirectory(args["--results-dir"].asString());
+    runner.setKeepResultsInMemory(false);
+
+    int numFailed = 0;
+    for (const auto& result : runner.run()) {
+        if (!result.success) ++numFailed;
+    }
+    if (numFailed > 0) {
+        log_error("{} of {} runs failed.", numFailed, runner.getNumRuns());
+        return EXIT_FAILURE;
+    }
+    log_info("Completed {} runs.", runner.getNumRuns());
+    return EXIT_SUCCESS;
+}
+
+#endif // OPENSIM_CMD_RUN_ENSEMBLE_H_
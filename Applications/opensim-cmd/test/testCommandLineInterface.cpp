@@ -349,6 +349,29 @@ void testRunTool() {
     testLoadPluginLibraries("run-tool");
 }
 
+void testRunEnsemble() {
+    // Help.
+    // =====
+    {
+        StartsWith output("Run many forward simulations ");
+        testCommand("run-ensemble -h", EXIT_SUCCESS, output);
+        testCommand("run-ensemble -help", EXIT_SUCCESS, output);
+    }
+
+    // Error messages.
+    // ===============
+    testCommand("run-ensemble", EXIT_FAILURE,
+            ContainsSubstring("Arguments did not match expected patterns"));
+    testCommand("run-ensemble putes.osim", EXIT_FAILURE,
+            ContainsSubstring("Arguments did not match expected patterns"));
+    testCommand("run-ensemble putes.osim runs.sto", EXIT_FAILURE,
+            StartsWith("[error] "));
+
+    // Library option.
+    // ===============
+    testLoadPluginLibraries("run-ensemble");
+}
+
 void testPrintXML() {
     // Help.
     // =====
@@ -494,6 +517,7 @@ int main() {
     SimTK_START_TEST("testCommandLineInterface");
         SimTK_SUBTEST(testNoCommand);
         SimTK_SUBTEST(testRunTool);
+        SimTK_SUBTEST(testRunEnsemble);
         SimTK_SUBTEST(testPrintXML);
         SimTK_SUBTEST(testInfo);
         SimTK_SUBTEST(testUpdateFile);
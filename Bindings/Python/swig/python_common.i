@@ -167,7 +167,101 @@ note: ## is a "glue" operator: `a ## b` --> `ab`.
 // ====================
 //%include <OpenSim/Common/LoadOpenSimLibrary.h>
 
-// %include "numpy.i"
+// Add support for converting between NumPy and C arrays, and for creating
+// NumPy arrays that view the data of a table.
+%include "numpy.i"
+%init %{
+    import_array();
+%}
+%apply (int DIM1, double* IN_ARRAY1) {
+    (int ntime, double* numpytimes)
+};
+%apply (int DIM1, int DIM2, double* IN_ARRAY2) {
+    (int nrow, int ncol, double* numpytable)
+};
+%apply (int DIM1, int DIM2, int DIM3, double* IN_ARRAY3) {
+    (int nrow, int ncol, int ncomp, double* numpytable)
+};
+
+%{
+namespace {
+// Create a NumPy array of doubles that views `data` without copying it. The
+// array holds a reference to `owner`, the Python object that owns the data,
+// so that the data outlives the array.
+PyObject* createNumPyView(PyObject* owner, int nd, npy_intp* shape,
+                          npy_intp* strides, const double* data,
+                          bool writable) {
+    PyObject* array = PyArray_New(&PyArray_Type, nd, shape, NPY_DOUBLE,
+            strides, const_cast<double*>(data), 0,
+            writable ? NPY_ARRAY_WRITEABLE : 0, nullptr);
+    if (!array) return nullptr;
+    Py_INCREF(owner);
+    if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(array),
+                              owner) < 0) {
+        Py_DECREF(array);
+        return nullptr;
+    }
+    return array;
+}
+
+// View the matrix of a table as an array of shape (nrow, ncol) if the
+// elements are doubles, or (nrow, ncol, ncomp) otherwise, where ncomp is the
+// number of doubles in an element (e.g., 3 for Vec3).
+template <typename ETY>
+PyObject* createMatrixView(OpenSim::DataTable_<double, ETY>& table,
+                           PyObject* owner, bool writable) {
+    const auto& matrix = table.updMatrix();
+    const int ncomp = static_cast<int>(sizeof(ETY) / sizeof(double));
+    const int nd = ncomp == 1 ? 2 : 3;
+    npy_intp shape[3] = {matrix.nrow(), matrix.ncol(), ncomp};
+    if (matrix.nrow() == 0 || matrix.ncol() == 0) {
+        return PyArray_ZEROS(nd, shape, NPY_DOUBLE, 0);
+    }
+    // SimTK matrices are stored by column, but we do not rely on it.
+    const char* first = reinterpret_cast<const char*>(&matrix(0, 0));
+    npy_intp strides[3] = {sizeof(ETY), npy_intp(sizeof(ETY)) * shape[0],
+                           sizeof(double)};
+    if (matrix.nrow() > 1) {
+        strides[0] = reinterpret_cast<const char*>(&matrix(1, 0)) - first;
+    }
+    if (matrix.ncol() > 1) {
+        strides[1] = reinterpret_cast<const char*>(&matrix(0, 1)) - first;
+    }
+    return createNumPyView(owner, nd, shape, strides,
+            reinterpret_cast<const double*>(first), writable);
+}
+
+// Create a table with the given times, data and column labels. The rows are
+// appended all at once.
+template <typename TableT, typename ETY>
+TableT* createTableFromMat(int ntime, const double* times,
+                           const SimTK::Matrix_<ETY>& data,
+                           const std::vector<std::string>& labels) {
+    SimTK_ERRCHK_ALWAYS(ntime == data.nrow(), "createFromMat()",
+            "Number of times must match number of rows of the data.");
+    std::unique_ptr<TableT> table(new TableT());
+    table->setColumnLabels(labels);
+    table->appendRows(std::vector<double>(times, times + ntime), data);
+    return table.release();
+}
+
+// Create a matrix of Vec3 from an array of shape (nrow, ncol, 3).
+SimTK::Matrix_<SimTK::Vec3> createVec3Matrix(int nrow, int ncol, int ncomp,
+                                             const double* data) {
+    SimTK_ERRCHK_ALWAYS(ncomp == 3, "createFromMat()",
+            "Size of the last dimension of the data must be 3.");
+    return SimTK::Matrix_<SimTK::Vec3>(nrow, ncol,
+            reinterpret_cast<const SimTK::Vec3*>(data));
+}
+
+PyObject* createIndependentColumnView(const std::vector<double>& column,
+                                      PyObject* owner) {
+    npy_intp shape[1] = {static_cast<npy_intp>(column.size())};
+    if (column.empty()) return PyArray_ZEROS(1, shape, NPY_DOUBLE, 0);
+    return createNumPyView(owner, 1, shape, nullptr, column.data(), false);
+}
+}
+%}
 
 // Pythonic operators
 // ==================
@@ -289,6 +383,92 @@ note: ## is a "glue" operator: `a ## b` --> `ab`.
     }
 }
 
+// NumPy views of the data of a table. The views share memory with the table
+// and keep it alive, but any change to the number of rows or columns of the
+// table (e.g., appendRow()) invalidates them.
+%define DATATABLE_NUMPY_VIEW(ETY)
+%extend OpenSim::DataTable_<double, ETY> {
+    PyObject* _getMatrixView(PyObject* owner, bool writable) {
+        return createMatrixView(*$self, owner, writable);
+    }
+    PyObject* _getIndependentColumnView(PyObject* owner) const {
+        return createIndependentColumnView($self->getIndependentColumn(),
+                                           owner);
+    }
+%pythoncode %{
+    def getMatrixView(self, writable=False):
+        """Get a NumPy array that views the matrix of this table without
+        copying it. The array has shape (nrow, ncol) for a table of doubles,
+        and (nrow, ncol, ncomp) for a table of Vec3 (ncomp = 3), etc. It is
+        read-only unless `writable` is True, in which case editing the array
+        edits the table. Do not use the array after changing the number of
+        rows or columns of the table."""
+        return self._getMatrixView(self, writable)
+
+    def getIndependentColumnView(self):
+        """Get a read-only NumPy array that views the independent column
+        (e.g., time) of this table without copying it. Use
+        setIndependentValueAtIndex() to edit the independent column."""
+        return self._getIndependentColumnView(self)
+%}
+}
+%enddef
+DATATABLE_NUMPY_VIEW(double)
+DATATABLE_NUMPY_VIEW(SimTK::Vec3)
+DATATABLE_NUMPY_VIEW(SimTK::UnitVec3)
+DATATABLE_NUMPY_VIEW(SimTK::Quaternion_<double>)
+DATATABLE_NUMPY_VIEW(SimTK::Vec6)
+DATATABLE_NUMPY_VIEW(SimTK::SpatialVec)
+
+// Create tables from NumPy arrays with a single bulk copy of the data, rather
+// than appending one row at a time. Ideally these would be constructors, but
+// they would conflict with the existing constructors, so we resort to static
+// functions.
+%newobject OpenSim::DataTable_<double, double>::createFromMat;
+%newobject OpenSim::DataTable_<double, SimTK::Vec3>::createFromMat;
+%newobject OpenSim::TimeSeriesTable_<double>::createFromMat;
+%newobject OpenSim::TimeSeriesTable_<SimTK::Vec3>::createFromMat;
+%extend OpenSim::DataTable_<double, double> {
+    static DataTable_<double, double>* createFromMat(
+            int ntime, double* numpytimes,
+            int nrow, int ncol, double* numpytable,
+            const std::vector<std::string>& labels) {
+        return createTableFromMat<OpenSim::DataTable_<double, double>>(
+                ntime, numpytimes,
+                SimTK::Matrix(nrow, ncol, numpytable), labels);
+    }
+}
+%extend OpenSim::DataTable_<double, SimTK::Vec3> {
+    static DataTable_<double, SimTK::Vec3>* createFromMat(
+            int ntime, double* numpytimes,
+            int nrow, int ncol, int ncomp, double* numpytable,
+            const std::vector<std::string>& labels) {
+        return createTableFromMat<OpenSim::DataTable_<double, SimTK::Vec3>>(
+                ntime, numpytimes,
+                createVec3Matrix(nrow, ncol, ncomp, numpytable), labels);
+    }
+}
+%extend OpenSim::TimeSeriesTable_<double> {
+    static TimeSeriesTable_<double>* createFromMat(
+            int ntime, double* numpytimes,
+            int nrow, int ncol, double* numpytable,
+            const std::vector<std::string>& labels) {
+        return createTableFromMat<OpenSim::TimeSeriesTable_<double>>(
+                ntime, numpytimes,
+                SimTK::Matrix(nrow, ncol, numpytable), labels);
+    }
+}
+%extend OpenSim::TimeSeriesTable_<SimTK::Vec3> {
+    static TimeSeriesTable_<SimTK::Vec3>* createFromMat(
+            int ntime, double* numpytimes,
+            int nrow, int ncol, int ncomp, double* numpytable,
+            const std::vector<std::string>& labels) {
+        return createTableFromMat<OpenSim::TimeSeriesTable_<SimTK::Vec3>>(
+                ntime, numpytimes,
+                createVec3Matrix(nrow, ncol, ncomp, numpytable), labels);
+    }
+}
+
 // Include all the OpenSim code.
 // =============================
 %include <Bindings/preliminaries.i>
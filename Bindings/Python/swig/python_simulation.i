@@ -113,16 +113,70 @@ MODEL_ADOPT_HELPER(Controller);
 
             for state in states:
                 model.calcMassCenterPosition(state)
+
+        With compact storage, each yielded state is valid only until the next
+        one is yielded; copy it if you need to keep it.
         """
         it = self.begin()
         while it != self.end():
-            yield it.next()
+            yield it.deref()
+            it.next()
 
     def getBetween(self, *args, **kwargs):
         iter_range = self._getBetween(*args, **kwargs)
         it = iter_range.begin()
         while it != iter_range.end():
-            yield it.next()
+            yield it.deref()
+            it.next()
+%}
+};
+
+// Add support for creating NumPy arrays.
+%include "numpy.i"
+%init %{
+    import_array();
+%}
+
+%extend OpenSim::StatesTrajectory {
+    PyObject* _to_numpy(PyObject* owner) const {
+        npy_intp shape[2] = {static_cast<npy_intp>($self->getSize()),
+                static_cast<npy_intp>($self->getNumCompactValuesPerState())};
+        if (const double* values = $self->getCompactValues()) {
+            // View the compact buffer without copying it.
+            PyObject* array = PyArray_New(&PyArray_Type, 2, shape, NPY_DOUBLE,
+                    nullptr, const_cast<double*>(values), 0, 0, nullptr);
+            if (!array) return nullptr;
+            Py_INCREF(owner);
+            if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(array),
+                                      owner) < 0) {
+                Py_DECREF(array);
+                return nullptr;
+            }
+            return array;
+        }
+        shape[1] = $self->getSize() == 0 ? 0 : 1 + $self->front().getNY();
+        PyObject* array = PyArray_ZEROS(2, shape, NPY_DOUBLE, 0);
+        if (!array) return nullptr;
+        double* out = static_cast<double*>(
+                PyArray_DATA(reinterpret_cast<PyArrayObject*>(array)));
+        for (size_t i = 0; i < $self->getSize(); ++i) {
+            const SimTK::State& state = $self->get(i);
+            *out++ = state.getTime();
+            const SimTK::Vector& y = state.getY();
+            for (int j = 0; j < y.size(); ++j) *out++ = y[j];
+        }
+        return array;
+    }
+%pythoncode %{
+
+    def to_numpy(self):
+        """Get the time and the continuous state variables (Y, that is Q, U
+        and Z) of the states as a NumPy array with one row per state: column 0
+        is time and columns 1 to NY are Y. With compact storage, this is a
+        read-only view of the trajectory's data, without a copy, that must not
+        be used after appending to or clearing the trajectory. With full
+        storage, this is a copy."""
+        return self._to_numpy(self)
 %}
 };
 
@@ -565,3 +565,47 @@ class TestDataTable(unittest.TestCase):
                                                  '2_x', '2_y', '2_z')
         print(tableDouble)
         
+
+    def test_numpy_views(self):
+        import numpy as np
+        times = np.array([0.1, 0.2, 0.3])
+        data = np.arange(12, dtype=float).reshape(3, 4)
+        table = osim.TimeSeriesTable.createFromMat(times, data,
+                                                   ['a', 'b', 'c', 'd'])
+        assert table.getNumRows() == 3
+        assert table.getNumColumns() == 4
+        assert table.getColumnLabels() == ('a', 'b', 'c', 'd')
+        assert table.getRowAtIndex(2)[1] == 9
+
+        matrix = table.getMatrixView()
+        assert matrix.shape == (3, 4)
+        assert np.array_equal(matrix, data)
+        assert not matrix.flags.writeable
+        assert np.array_equal(table.getIndependentColumnView(), times)
+
+        # Editing a writable view edits the table.
+        matrix = table.getMatrixView(True)
+        matrix[1, 2] = -1
+        assert table.getRowAtIndex(1)[2] == -1
+
+        # The view keeps the table alive.
+        del table
+        assert matrix[1, 2] == -1
+
+        # Times must be increasing.
+        self.assertRaises(RuntimeError, osim.TimeSeriesTable.createFromMat,
+                          np.array([0.3, 0.2, 0.1]), data,
+                          ['a', 'b', 'c', 'd'])
+
+        # Tables of Vec3 have an extra dimension for the components.
+        data = np.arange(18, dtype=float).reshape(3, 2, 3)
+        table = osim.TimeSeriesTableVec3.createFromMat(times, data,
+                                                       ['m1', 'm2'])
+        assert table.getRowAtIndex(1)[1][2] == 11
+        matrix = table.getMatrixView()
+        assert matrix.shape == (3, 2, 3)
+        assert np.array_equal(matrix, data)
+
+        table = osim.DataTable.createFromMat(times, np.ones((3, 2)),
+                                             ['x', 'y'])
+        assert table.getMatrixView().sum() == 6
@@ -165,4 +165,29 @@ class TestStatesTrajectory(unittest.TestCase):
         for i in range(6):
             assert states[i].getTime() == i * 0.01
 
+    def test_compact_to_numpy(self):
+        model = osim.Model(os.path.join(test_dir,
+            "gait10dof18musc_subject01.osim"))
+
+        rep = osim.StatesTrajectoryReporter()
+        rep.setName('reporter')
+        rep.set_report_time_interval(0.01)
+        rep.set_compact_storage(True)
+        model.addComponent(rep)
+
+        model.initSystem()
+
+        forward = osim.ForwardTool()
+        forward.setModel(model)
+        forward.setName('test_states_trajectory_compact_gait1018')
+        forward.setFinalTime(0.05)
+        forward.run()
 
+        states = rep.getStates()
+        assert states.getSize() == 6
+        values = states.to_numpy()
+        assert values.shape == (6, 1 + states[0].getNY())
+        assert not values.flags.writeable
+        for i, state in enumerate(states):
+            assert values[i, 0] == state.getTime()
+            assert values[i, 1] == state.getY()[0]
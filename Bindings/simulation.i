@@ -190,6 +190,7 @@ OpenSim::ModelComponentSet<OpenSim::Controller>;
 %template(ArrayPointForceDirection) OpenSim::Array<OpenSim::PointForceDirection*>;
 
 %include <OpenSim/Simulation/Model/GeometryPath.h>
+%include <OpenSim/Simulation/Model/PolynomialPath.h>
 %include <OpenSim/Simulation/Model/Ligament.h>
 %include <OpenSim/Simulation/Model/Blankevoort1991Ligament.h>
 %include <OpenSim/Simulation/Model/PathActuator.h>
@@ -224,6 +225,11 @@ OpenSim::ModelComponentSet<OpenSim::Controller>;
 %include <OpenSim/Simulation/OpenSense/IMUPlacer.h>
 %include <OpenSim/Simulation/OpenSense/OpenSenseUtilities.h>
 
+namespace OpenSim {
+    %ignore StatesTrajectoryIterator::operator++; // ignore warning 383.
+    %ignore StatesTrajectoryIterator::operator--; // ignore warning 384.
+    %ignore StatesTrajectoryIterator::operator[];
+}
 %include <OpenSim/Simulation/StatesTrajectory.h>
 // This enables iterating using the getBetween() method.
 %template(IteratorRangeStatesTrajectoryIterator)
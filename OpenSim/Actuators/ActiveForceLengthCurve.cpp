@@ -87,6 +87,9 @@ void ActiveForceLengthCurve::buildCurve()
     SimTK::Function* f = createSimTKFunction();
     m_curve = *(static_cast<SmoothSegmentedFunction*>(f));
     delete f;
+    if(m_usePrecompiledCurve) {
+        m_curve.precompile();
+    }
     setObjectIsUpToDateWithProperties();
 }
 
@@ -97,6 +100,18 @@ void ActiveForceLengthCurve::ensureCurveUpToDate()
     }
 }
 
+void ActiveForceLengthCurve::setUsePrecompiledCurve(bool usePrecompiledCurve)
+{
+    if(usePrecompiledCurve != m_usePrecompiledCurve) {
+        m_usePrecompiledCurve = usePrecompiledCurve;
+        clearObjectIsUpToDateWithProperties();
+        ensureCurveUpToDate();
+    }
+}
+
+bool ActiveForceLengthCurve::getUsePrecompiledCurve() const
+{   return m_usePrecompiledCurve; }
+
 //==============================================================================
 // OpenSim::Function Interface
 //==============================================================================
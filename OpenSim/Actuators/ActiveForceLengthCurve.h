@@ -207,7 +207,7 @@ public:
 
     /** Evaluates the active-force-length curve at a normalized fiber length of
     'normFiberLength'. */
-    double calcValue(double normFiberLength) const;
+    double calcValue(double normFiberLength) const override;
 
 
     /** Calculates the derivative of the active-force-length multiplier with
@@ -220,7 +220,7 @@ public:
         The derivative of the active-force-length curve with respect to the
         normalized fiber length.
     */
-    double calcDerivative(double normFiberLength, int order) const;
+    double calcDerivative(double normFiberLength, int order) const override;
     
     /// If possible, use the simpler overload above.
     double calcDerivative(const std::vector<int>& derivComponents,
@@ -267,6 +267,16 @@ public:
     */
     void printMuscleCurveToCSVFile(const std::string& path);
 
+    /** %Set whether the curve is evaluated from a precompiled piecewise
+    polynomial in x (see SmoothSegmentedFunction::precompile(), with its
+    default tolerances) rather than from its Bezier curves, which avoids
+    iterating to find the Bezier parameter. This setting is not a property;
+    muscles that use the curve set it (e.g., from the
+    use_precompiled_curves property of Millard2012EquilibriumMuscle). The
+    default is false. */
+    void setUsePrecompiledCurve(bool usePrecompiledCurve);
+    bool getUsePrecompiledCurve() const;
+
     void ensureCurveUpToDate();
 //==============================================================================
 // PRIVATE
@@ -286,6 +296,7 @@ private:
     void buildCurve();
 
     SmoothSegmentedFunction   m_curve;
+    bool m_usePrecompiledCurve = false;
 };
 
 }
@@ -298,7 +298,7 @@ public:
     \endverbatim
 
     */
-    double calcValue(double cosPennationAngle) const;
+    double calcValue(double cosPennationAngle) const override;
 
 
     /** Implement the generic OpenSim::Function interface **/
@@ -327,7 +327,7 @@ public:
     \endverbatim
 
     */
-    double calcDerivative(double cosPennationAngle, int order) const;
+    double calcDerivative(double cosPennationAngle, int order) const override;
 
     /// If possible, use the simpler overload above.
     double calcDerivative(const std::vector<int>& derivComponents,
@@ -93,6 +93,9 @@ void FiberForceLengthCurve::buildCurve(bool computeIntegral)
 
     m_curve = *f;
     delete f;
+    if(m_usePrecompiledCurve) {
+        m_curve.precompile();
+    }
 
     setObjectIsUpToDateWithProperties();
 }
@@ -159,6 +162,18 @@ void FiberForceLengthCurve::ensureCurveUpToDate()
     buildCurve();
 }
 
+void FiberForceLengthCurve::setUsePrecompiledCurve(bool usePrecompiledCurve)
+{
+    if(usePrecompiledCurve != m_usePrecompiledCurve) {
+        m_usePrecompiledCurve = usePrecompiledCurve;
+        clearObjectIsUpToDateWithProperties();
+        ensureCurveUpToDate();
+    }
+}
+
+bool FiberForceLengthCurve::getUsePrecompiledCurve() const
+{   return m_usePrecompiledCurve; }
+
 //==============================================================================
 // OpenSim::Function Interface
 //==============================================================================
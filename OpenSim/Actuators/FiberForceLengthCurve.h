@@ -277,7 +277,7 @@ public:
 
     /** Evaluates the fiber-force-length curve at a normalized fiber length of
     'normFiberLength'. */
-    double calcValue(double normFiberLength) const;
+    double calcValue(double normFiberLength) const override;
 
     /** Calculates the derivative of the fiber-force-length multiplier with
     respect to the normalized fiber length.
@@ -289,7 +289,7 @@ public:
         The derivative of the fiber-force-length curve with respect to the
         normalized fiber length.
     */
-    double calcDerivative(double normFiberLength, int order) const;
+    double calcDerivative(double normFiberLength, int order) const override;
     
 
     /// If possible, use the simpler overload above.
@@ -347,6 +347,16 @@ public:
     */
     void printMuscleCurveToCSVFile(const std::string& path);
 
+    /** %Set whether the curve is evaluated from a precompiled piecewise
+    polynomial in x (see SmoothSegmentedFunction::precompile(), with its
+    default tolerances) rather than from its Bezier curves, which avoids
+    iterating to find the Bezier parameter. This setting is not a property;
+    muscles that use the curve set it (e.g., from the
+    use_precompiled_curves property of Millard2012EquilibriumMuscle). The
+    default is false. */
+    void setUsePrecompiledCurve(bool usePrecompiledCurve);
+    bool getUsePrecompiledCurve() const;
+
     void ensureCurveUpToDate();
 //==============================================================================
 // PRIVATE
@@ -385,6 +395,7 @@ private:
                                   double area, double relTol);
 
     SmoothSegmentedFunction m_curve;
+    bool m_usePrecompiledCurve = false;
     double m_stiffnessAtLowForceInUse;
     double m_stiffnessAtOneNormForceInUse;
     double m_curvinessInUse;
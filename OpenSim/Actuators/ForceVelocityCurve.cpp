@@ -89,6 +89,9 @@ void ForceVelocityCurve::buildCurve()
     SimTK::Function* f = createSimTKFunction();
     m_curve = *(static_cast<SmoothSegmentedFunction*>(f));
     delete f;
+    if(m_usePrecompiledCurve) {
+        m_curve.precompile();
+    }
     setObjectIsUpToDateWithProperties();
 }
 
@@ -99,6 +102,18 @@ void ForceVelocityCurve::ensureCurveUpToDate()
     }
 }
 
+void ForceVelocityCurve::setUsePrecompiledCurve(bool usePrecompiledCurve)
+{
+    if(usePrecompiledCurve != m_usePrecompiledCurve) {
+        m_usePrecompiledCurve = usePrecompiledCurve;
+        clearObjectIsUpToDateWithProperties();
+        ensureCurveUpToDate();
+    }
+}
+
+bool ForceVelocityCurve::getUsePrecompiledCurve() const
+{   return m_usePrecompiledCurve; }
+
 //==============================================================================
 // OpenSim::Function Interface
 //==============================================================================
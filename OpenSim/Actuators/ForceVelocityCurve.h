@@ -303,7 +303,7 @@ public:
 
     /** Evaluates the force-velocity curve at a normalized fiber velocity of
     'normFiberVelocity'. */
-    double calcValue(double normFiberVelocity) const;
+    double calcValue(double normFiberVelocity) const override;
 
     /** Calculates the derivative of the force-velocity multiplier with respect
     to the normalized fiber velocity.
@@ -315,7 +315,7 @@ public:
         The derivative of the force-velocity curve with respect to the
         normalized fiber velocity.
     */
-    double calcDerivative(double normFiberVelocity, int order) const;
+    double calcDerivative(double normFiberVelocity, int order) const override;
     
 
     /// If possible, use the simpler overload above.
@@ -362,6 +362,16 @@ public:
     */
     void printMuscleCurveToCSVFile(const std::string& path);
 
+    /** %Set whether the curve is evaluated from a precompiled piecewise
+    polynomial in x (see SmoothSegmentedFunction::precompile(), with its
+    default tolerances) rather than from its Bezier curves, which avoids
+    iterating to find the Bezier parameter. This setting is not a property;
+    muscles that use the curve set it (e.g., from the
+    use_precompiled_curves property of Millard2012EquilibriumMuscle). The
+    default is false. */
+    void setUsePrecompiledCurve(bool usePrecompiledCurve);
+    bool getUsePrecompiledCurve() const;
+
     void ensureCurveUpToDate();
 //==============================================================================
 // PRIVATE
@@ -380,6 +390,7 @@ private:
     void buildCurve();
 
     SmoothSegmentedFunction m_curve;
+    bool m_usePrecompiledCurve = false;
 };
 
 }
@@ -90,6 +90,9 @@ void ForceVelocityInverseCurve::buildCurve()
     SimTK::Function* f = createSimTKFunction();
     m_curve = *(static_cast<SmoothSegmentedFunction*>(f));
     delete f;
+    if(m_usePrecompiledCurve) {
+        m_curve.precompile();
+    }
     setObjectIsUpToDateWithProperties();
 }
 
@@ -100,6 +103,18 @@ void ForceVelocityInverseCurve::ensureCurveUpToDate()
     }
 }
 
+void ForceVelocityInverseCurve::setUsePrecompiledCurve(bool usePrecompiledCurve)
+{
+    if(usePrecompiledCurve != m_usePrecompiledCurve) {
+        m_usePrecompiledCurve = usePrecompiledCurve;
+        clearObjectIsUpToDateWithProperties();
+        ensureCurveUpToDate();
+    }
+}
+
+bool ForceVelocityInverseCurve::getUsePrecompiledCurve() const
+{   return m_usePrecompiledCurve; }
+
 //==============================================================================
 // OpenSim::Function Interface
 //==============================================================================
@@ -271,7 +271,7 @@ public:
 
     /** Evaluates the inverse force-velocity curve at a force-velocity
     multiplier value of 'aForceVelocityMultiplier'. */
-    double calcValue(double aForceVelocityMultiplier) const;
+    double calcValue(double aForceVelocityMultiplier) const override;
 
     /** Calculates the derivative of the inverse force-velocity curve with
     respect to the force-velocity multiplier.
@@ -283,7 +283,7 @@ public:
         The derivative of the inverse force-velocity curve with respect to the
         force-velocity multiplier.
     */
-    double calcDerivative(double aForceVelocityMultiplier, int order) const;
+    double calcDerivative(double aForceVelocityMultiplier, int order) const override;
     
     /// If possible, use the simpler overload above.
     double calcDerivative(const std::vector<int>& derivComponents,
@@ -329,6 +329,16 @@ public:
     */
     void printMuscleCurveToCSVFile(const std::string& path);
 
+    /** %Set whether the curve is evaluated from a precompiled piecewise
+    polynomial in x (see SmoothSegmentedFunction::precompile(), with its
+    default tolerances) rather than from its Bezier curves, which avoids
+    iterating to find the Bezier parameter. This setting is not a property;
+    muscles that use the curve set it (e.g., from the
+    use_precompiled_curves property of Millard2012EquilibriumMuscle). The
+    default is false. */
+    void setUsePrecompiledCurve(bool usePrecompiledCurve);
+    bool getUsePrecompiledCurve() const;
+
     void ensureCurveUpToDate();
 //==============================================================================
 // PRIVATE
@@ -347,6 +357,7 @@ private:
     void buildCurve();
 
     SmoothSegmentedFunction   m_curve;
+    bool m_usePrecompiledCurve = false;
 
 };
 
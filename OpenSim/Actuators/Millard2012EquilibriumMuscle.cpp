@@ -55,6 +55,7 @@ void Millard2012EquilibriumMuscle::constructProperties()
     constructProperty_ForceVelocityCurve(ForceVelocityCurve());
     constructProperty_FiberForceLengthCurve(FiberForceLengthCurve());
     constructProperty_TendonForceLengthCurve(TendonForceLengthCurve());
+    constructProperty_use_precompiled_curves(false);
 
     setMinControl(get_minimum_activation());
 }
@@ -145,6 +146,12 @@ void Millard2012EquilibriumMuscle::extendFinalizeFromProperties()
                                            conCurviness, eccCurviness);
 
     // Ensure all muscle curves are up-to-date.
+    const bool precompiled = get_use_precompiled_curves();
+    falCurve.setUsePrecompiledCurve(precompiled);
+    fvCurve.setUsePrecompiledCurve(precompiled);
+    fvInvCurve.setUsePrecompiledCurve(precompiled);
+    fpeCurve.setUsePrecompiledCurve(precompiled);
+    fseCurve.setUsePrecompiledCurve(precompiled);
     falCurve.ensureCurveUpToDate();
     fvCurve.ensureCurveUpToDate();
     fvInvCurve.ensureCurveUpToDate();
@@ -86,6 +86,12 @@ muscle model to be more physiological (it can have an activation of zero, its
 active-force-length curve can go to zero, and its force-velocity curve can be
 asymptotic).
 
+\li use_precompiled_curves: set to <I>true</I> to evaluate the muscle curves
+from piecewise polynomials in the normalized lengths and velocity that are
+within 1e-9 of the values and 1e-6 of the slopes of the curves (see
+SmoothSegmentedFunction::precompile()), which avoids iterating to evaluate
+the Bezier curves.
+
 <B>Elastic Tendon, No Fiber Damping</B>
 
 The most typical configuration used in the literature is to simulate a muscle
@@ -226,6 +232,9 @@ public:
         "Passive-force-length curve.");
     OpenSim_DECLARE_UNNAMED_PROPERTY(TendonForceLengthCurve,
         "Tendon-force-length curve.");
+    OpenSim_DECLARE_PROPERTY(use_precompiled_curves, bool,
+        "Evaluate the muscle curves from precompiled piecewise polynomials "
+        "rather than from their Bezier curves (default: false).");
 
 //==============================================================================
 // OUTPUTS
@@ -165,7 +165,7 @@ void RigidTendonMuscle::calcFiberVelocityInfo(const State& s, FiberVelocityInfo&
     fvi.normFiberVelocity = fvi.fiberVelocity / 
                             (getOptimalFiberLength()*getMaxContractionVelocity());
     fvi.fiberForceVelocityMultiplier = 
-        get_force_velocity_curve().calcValue(Vector(1, fvi.normFiberVelocity));
+        get_force_velocity_curve().calcValue(fvi.normFiberVelocity);
 }
 
 /* calculate muscle's active and passive force-length, force-velocity, 
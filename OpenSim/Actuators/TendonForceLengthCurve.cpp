@@ -101,6 +101,9 @@ void TendonForceLengthCurve::buildCurve(bool computeIntegral)
                                      getName());
     m_curve = *f;
     delete f;
+    if(m_usePrecompiledCurve) {
+        m_curve.precompile();
+    }
     setObjectIsUpToDateWithProperties();
 }
 
@@ -155,6 +158,18 @@ void TendonForceLengthCurve::ensureCurveUpToDate()
     buildCurve();
 }
 
+void TendonForceLengthCurve::setUsePrecompiledCurve(bool usePrecompiledCurve)
+{
+    if(usePrecompiledCurve != m_usePrecompiledCurve) {
+        m_usePrecompiledCurve = usePrecompiledCurve;
+        clearObjectIsUpToDateWithProperties();
+        ensureCurveUpToDate();
+    }
+}
+
+bool TendonForceLengthCurve::getUsePrecompiledCurve() const
+{   return m_usePrecompiledCurve; }
+
 //==============================================================================
 // GET AND SET METHODS
 //==============================================================================
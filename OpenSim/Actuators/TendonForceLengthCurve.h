@@ -261,7 +261,7 @@ public:
 
     /** Evaluates the tendon-force-length curve at a normalized tendon length of
     'aNormLength'. */
-    double calcValue(double aNormLength) const;
+    double calcValue(double aNormLength) const override;
 
     /** Calculates the derivative of the tendon-force-length multiplier with
     respect to the normalized tendon length.
@@ -273,7 +273,7 @@ public:
         The derivative of the tendon-force-length curve with respect to the
         normalized tendon length.
     */
-    double calcDerivative(double aNormLength, int order) const;
+    double calcDerivative(double aNormLength, int order) const override;
     
     /// If possible, use the simpler overload above.
     double calcDerivative(const std::vector<int>& derivComponents,
@@ -330,6 +330,16 @@ public:
     */
     void printMuscleCurveToCSVFile(const std::string& path);
 
+    /** %Set whether the curve is evaluated from a precompiled piecewise
+    polynomial in x (see SmoothSegmentedFunction::precompile(), with its
+    default tolerances) rather than from its Bezier curves, which avoids
+    iterating to find the Bezier parameter. This setting is not a property;
+    muscles that use the curve set it (e.g., from the
+    use_precompiled_curves property of Millard2012EquilibriumMuscle). The
+    default is false. */
+    void setUsePrecompiledCurve(bool usePrecompiledCurve);
+    bool getUsePrecompiledCurve() const;
+
     void ensureCurveUpToDate();
 //==============================================================================
 // PRIVATE
@@ -368,6 +378,7 @@ private:
     void buildCurve(bool computeIntegral = false);
 
     SmoothSegmentedFunction m_curve;
+    bool m_usePrecompiledCurve = false;
 
     double m_normForceAtToeEndInUse;
     double m_stiffnessAtOneNormForceInUse;
@@ -28,6 +28,7 @@
 #include <OpenSim/Actuators/FiberForceLengthCurve.h>
 #include <OpenSim/Actuators/FiberCompressiveForceLengthCurve.h>
 #include <OpenSim/Actuators/FiberCompressiveForceCosPennationCurve.h>
+#include <OpenSim/Actuators/Millard2012EquilibriumMuscle.h>
 
 #include <SimTKsimbody.h>
 #include <ctime>
@@ -45,6 +46,7 @@ void testTendonForceLengthCurve();
 void testFiberForceLengthCurve();
 void testFiberCompressiveForceLengthCurve();
 void testFiberCompressiveForceCosPennationCurve();
+void testPrecompiledCurves();
 
 int main(int argc, char* argv[])
 {
@@ -59,6 +61,7 @@ int main(int argc, char* argv[])
             testFiberForceLengthCurve();
             testFiberCompressiveForceLengthCurve();
             testFiberCompressiveForceCosPennationCurve();
+            testPrecompiledCurves();
 
             cout << "================================================" << endl;
             cout << "                   Timing Tests                 " << endl;
@@ -1227,3 +1230,64 @@ void testFiberCompressiveForceCosPennationCurve()
         cout <<"________________________________________________________"<<endl;
 
 }
+
+
+/*
+Compares a curve that uses its precompiled polynomial against the same curve
+evaluated from its Bezier curves, at many more points than precompile()
+samples, over the curve domain and beyond.
+*/
+template <typename CurveType>
+void comparePrecompiledCurve(const CurveType& curve)
+{
+    CurveType precompiled(curve);
+    SimTK_TEST(!precompiled.getUsePrecompiledCurve());
+    precompiled.setUsePrecompiledCurve(true);
+    SimTK_TEST(precompiled.getUsePrecompiledCurve());
+
+    const SimTK::Vec2 domain = curve.getCurveDomain();
+    const double width = domain[1] - domain[0];
+    const int n = 5000;
+    for(int i=0; i <= n; i++){
+        const double x = domain[0] - 0.1*width + 1.2*width*i/n;
+        SimTK_TEST_EQ_TOL(precompiled.calcValue(x), curve.calcValue(x),
+                          1e-8);
+        SimTK_TEST_EQ_TOL(precompiled.calcDerivative(x,1),
+                          curve.calcDerivative(x,1), 1e-5);
+    }
+}
+
+void testPrecompiledCurves()
+{
+    cout << endl;
+    cout << "**************************************************" << endl;
+    cout << "TEST: Precompiled curves" << endl;
+
+    comparePrecompiledCurve(ActiveForceLengthCurve());
+    comparePrecompiledCurve(ForceVelocityCurve());
+    comparePrecompiledCurve(ForceVelocityInverseCurve());
+    comparePrecompiledCurve(FiberForceLengthCurve());
+    comparePrecompiledCurve(TendonForceLengthCurve());
+
+    // A curve rebuilt after a change of its properties stays precompiled.
+    ActiveForceLengthCurve fal;
+    fal.setUsePrecompiledCurve(true);
+    fal.setMinValue(0.2);
+    SimTK_TEST(fal.getUsePrecompiledCurve());
+    ActiveForceLengthCurve falBezier;
+    falBezier.setMinValue(0.2);
+    SimTK_TEST_EQ_TOL(fal.calcValue(0.6), falBezier.calcValue(0.6), 1e-8);
+
+    // Millard2012EquilibriumMuscle precompiles its curves on request.
+    Millard2012EquilibriumMuscle muscle("muscle", 1000, 0.1, 0.2, 0.1);
+    muscle.finalizeFromProperties();
+    SimTK_TEST(!muscle.getActiveForceLengthCurve().getUsePrecompiledCurve());
+    muscle.set_use_precompiled_curves(true);
+    muscle.finalizeFromProperties();
+    SimTK_TEST(muscle.getActiveForceLengthCurve().getUsePrecompiledCurve());
+    SimTK_TEST(muscle.getForceVelocityCurve().getUsePrecompiledCurve());
+    SimTK_TEST(muscle.getFiberForceLengthCurve().getUsePrecompiledCurve());
+    SimTK_TEST(muscle.getTendonForceLengthCurve().getUsePrecompiledCurve());
+
+    cout << "    passed" << endl;
+}
@@ -68,7 +68,8 @@ InducedAccelerations::InducedAccelerations(Model *aModel) :
     _constraintSet((ConstraintSet&)_constraintSetProp.getValueObj()),
     _forceThreshold(_forceThresholdProp.getValueDbl()),
     _computePotentialsOnly(_computePotentialsOnlyProp.getValueBool()),
-    _reportConstraintReactions(_reportConstraintReactionsProp.getValueBool())
+    _reportConstraintReactions(_reportConstraintReactionsProp.getValueBool()),
+    _solveContributorsTogether(_solveContributorsTogetherProp.getValueBool())
 {
     // make sure members point to NULL if not valid. 
     setNull();
@@ -96,7 +97,8 @@ InducedAccelerations::InducedAccelerations(const std::string &aFileName):
     _constraintSet((ConstraintSet&)_constraintSetProp.getValueObj()),
     _forceThreshold(_forceThresholdProp.getValueDbl()),
     _computePotentialsOnly(_computePotentialsOnlyProp.getValueBool()),
-    _reportConstraintReactions(_reportConstraintReactionsProp.getValueBool())
+    _reportConstraintReactions(_reportConstraintReactionsProp.getValueBool()),
+    _solveContributorsTogether(_solveContributorsTogetherProp.getValueBool())
 {
     setNull();
 
@@ -120,7 +122,8 @@ InducedAccelerations::InducedAccelerations(const InducedAccelerations &aInducedA
     _constraintSet((ConstraintSet&)_constraintSetProp.getValueObj()),
     _forceThreshold(_forceThresholdProp.getValueDbl()),
     _computePotentialsOnly(_computePotentialsOnlyProp.getValueBool()),
-    _reportConstraintReactions(_reportConstraintReactionsProp.getValueBool())
+    _reportConstraintReactions(_reportConstraintReactionsProp.getValueBool()),
+    _solveContributorsTogether(_solveContributorsTogetherProp.getValueBool())
 {
     setNull();
     // COPY TYPE AND NAME
@@ -152,6 +155,7 @@ operator=(const InducedAccelerations &aInducedAccelerations)
     _forceThreshold = aInducedAccelerations._forceThreshold;
     _computePotentialsOnly = aInducedAccelerations._computePotentialsOnly;
     _reportConstraintReactions = aInducedAccelerations._reportConstraintReactions;
+    _solveContributorsTogether = aInducedAccelerations._solveContributorsTogether;
     _includeCOM = aInducedAccelerations._includeCOM;
     return(*this);
 }
@@ -171,6 +175,7 @@ void InducedAccelerations::setNull()
     _bodyNames[0] = CENTER_OF_MASS_NAME;
     _computePotentialsOnly = false;
     _reportConstraintReactions = false;
+    _solveContributorsTogether = true;
     // Analysis does not own contents of these sets
     _coordSet.setMemoryOwner(false);
     _bodySet.setMemoryOwner(false);
@@ -213,6 +218,13 @@ void InducedAccelerations::setupProperties()
     _reportConstraintReactionsProp.setName("report_constraint_reactions");
     _reportConstraintReactionsProp.setComment("Report individual contributions to constraint reactions in addition to accelerations.");
     _propertySet.append(&_reportConstraintReactionsProp);
+
+    _solveContributorsTogetherProp.setName("solve_contributors_together");
+    _solveContributorsTogetherProp.setComment("Solve for the accelerations induced by all the contributors "
+        "(except 'total') together, from a single evaluation of the model forces per time, instead of "
+        "realizing the model once per contributor. The results are the same. Ignored when "
+        "report_constraint_reactions is true.");
+    _propertySet.append(&_solveContributorsTogetherProp);
 }
 
 //=============================================================================
@@ -539,8 +551,19 @@ int InducedAccelerations::record(const SimTK::State& s)
     //Use same conditions on constraints
     s_analysis.setTime(aT);
 
+    // Constraint reactions are only available from a realized state.
+    const bool solveTogether =
+            _solveContributorsTogether && !_reportConstraintReactions;
+
     // Cycle through the force contributors to the system acceleration
     for(int c=0; c< _contributors.getSize(); c++){          
+        // "total" (if any) is first; the other contributors are linear in
+        // their applied forces and can be solved for together.
+        if(solveTogether && _contributors[c] != "total"){
+            recordContributorsTogether(s, s_analysis, c);
+            break;
+        }
+
         //cout << "Solving for contributor: " << _contributors[c] << endl;
         // Need to be at the dynamics stage to disable a force
         _model->getMultibodySystem().realize(s_analysis, SimTK::Stage::Dynamics);
@@ -787,6 +810,172 @@ int InducedAccelerations::record(const SimTK::State& s)
     return(0);
 }
 
+/**
+ * Solve for the accelerations induced by the contributors, starting with
+ * firstContributor, and append them to the work arrays. The model forces are
+ * evaluated once for zero velocity (and once more for the "velocity"
+ * contributor), and each contributor's applied mobility and body forces are
+ * then solved for the constrained accelerations with the same state, rather
+ * than realizing the model to Stage::Acceleration for each contributor.
+ *
+ * As in record(), every contributor's forces include those of the Forces
+ * that are neither actuators nor gravity.
+ *
+ * @param s State being analyzed.
+ * @param s_analysis State with the contact constraints enforced for s.
+ * @param firstContributor Index of the first contributor to solve for.
+ */
+void InducedAccelerations::recordContributorsTogether(const SimTK::State& s,
+        const SimTK::State& s_analysis, int firstContributor)
+{
+    const SimTK::MultibodySystem& system = _model->getMultibodySystem();
+    const SimTK::SimbodyMatterSubsystem& matter = _model->getMatterSubsystem();
+    const Set<Actuator>& actuators = _model->getActuators();
+    int nu = _model->getNumSpeeds();
+
+    // State at zero velocity with gravity and the actuators off. Each actuator
+    // has the same actuation as when it alone is applied in record().
+    SimTK::State s_zero = s_analysis;
+    _model->updForceSubsystem().setForceIsDisabled(s_zero,
+            _model->getGravityForce().getForceIndex(), true);
+    for(int f=0; f<actuators.getSize(); f++){
+        const Actuator& actuator = actuators.get(f);
+        actuator.setAppliesForce(s_zero, false);
+        const ScalarActuator* act = dynamic_cast<const ScalarActuator*>(&actuator);
+        if(act){
+            act->overrideActuation(s_zero, false);
+            if(_computePotentialsOnly && dynamic_cast<const Muscle*>(act)){
+                act->overrideActuation(s_zero, true);
+                act->setOverrideActuation(s_zero, 1.0);
+            }
+        }
+    }
+    s_zero.setQ(s.getQ());
+    s_zero.setU(SimTK::Vector(nu, 0.0));
+    s_zero.setZ(s.getZ());
+    system.realize(s_zero, SimTK::Stage::Dynamics);
+
+    // Forces applied with every zero-velocity contributor
+    const SimTK::Vector& otherMobilityForces =
+        system.getMobilityForces(s_zero, SimTK::Stage::Dynamics);
+    const SimTK::Vector_<SimTK::SpatialVec>& otherBodyForces =
+        system.getRigidBodyForces(s_zero, SimTK::Stage::Dynamics);
+
+    // Same forces, but with the actual velocity, for the "velocity" contributor
+    SimTK::State s_velocity = s_zero;
+    s_velocity.setU(s.getU());
+    system.realize(s_velocity, SimTK::Stage::Dynamics);
+
+    SimTK::Vector mobilityForces, contributorMobilityForces;
+    SimTK::Vector_<SimTK::SpatialVec> bodyForces, contributorBodyForces;
+    SimTK::Vector_<SimTK::Vec3> particleForces;
+    SimTK::Vector udot;
+    SimTK::Vector_<SimTK::SpatialVec> bodyAccelerations;
+
+    for(int c=firstContributor; c<_contributors.getSize(); c++){
+        const SimTK::State* s_contributor = &s_zero;
+        if(_contributors[c] == "velocity"){
+            s_contributor = &s_velocity;
+            mobilityForces = system.getMobilityForces(s_velocity,
+                                                      SimTK::Stage::Dynamics);
+            bodyForces = system.getRigidBodyForces(s_velocity,
+                                                   SimTK::Stage::Dynamics);
+        }
+        else{
+            if(_contributors[c] == "gravity"){
+                _model->getGravityForce().calcForceContribution(s_zero,
+                    contributorBodyForces, particleForces,
+                    contributorMobilityForces);
+            }
+            else{ //The rest are actuators
+                int ai = actuators.getIndex(_contributors[c]);
+                if(ai<0)
+                    throw Exception("InducedAcceleration: ERR- Could not find actuator '"+_contributors[c],__FILE__,__LINE__);
+                actuators.get(ai).calcForceContribution(s_zero,
+                    contributorBodyForces, contributorMobilityForces);
+            }
+            mobilityForces = otherMobilityForces + contributorMobilityForces;
+            bodyForces = otherBodyForces + contributorBodyForces;
+        }
+
+        // Constrained forward dynamics for this contributor's forces alone.
+        // The articulated body inertias computed for the first contributor
+        // are reused by the others.
+        matter.calcAcceleration(*s_contributor, mobilityForces, bodyForces,
+                                udot, bodyAccelerations);
+
+        appendInducedAccelerations(*s_contributor, udot, bodyAccelerations);
+    }
+}
+
+/**
+ * Append the coordinate, body and center of mass accelerations that
+ * correspond to the given generalized accelerations and body accelerations
+ * (in ground) to the work arrays, as record() does from a realized state.
+ *
+ * @param s State, realized to Stage::Velocity, in which the accelerations
+ * were computed.
+ * @param udot Generalized accelerations.
+ * @param bodyAccelerations Spatial acceleration of each mobilized body.
+ */
+void InducedAccelerations::appendInducedAccelerations(const SimTK::State& s,
+        const SimTK::Vector& udot,
+        const SimTK::Vector_<SimTK::SpatialVec>& bodyAccelerations)
+{
+    const SimTK::SimbodyMatterSubsystem& matter = _model->getMatterSubsystem();
+    SimTK::Vec3 vec,angVec;
+
+    for(int i=0;i<_coordSet.getSize();i++) {
+        const Coordinate& coord = _coordSet.get(i);
+        double acc = matter.getMobilizedBody(coord.getBodyIndex())
+                .getOneFromUPartition(s, coord.getMobilizerQIndex(), udot);
+
+        if(getInDegrees()) 
+            acc *= SimTK_RADIAN_TO_DEGREE;  
+        _coordIndAccs[i]->append(1, &acc);
+    }
+
+    // Same as Frame::findStationAccelerationInGround() for each body's
+    // center of mass.
+    for(int i=0;i<_bodySet.getSize();i++) {
+        const Body &body = _bodySet.get(i);
+        const SimTK::SpatialVec& A_GB =
+            bodyAccelerations[body.getMobilizedBodyIndex()];
+        const SimTK::SpatialVec& V_GB = body.getVelocityInGround(s);
+        SimTK::Vec3 r_G = body.expressVectorInGround(s, body.get_mass_center());
+
+        vec = A_GB[1] + SimTK::cross(A_GB[0], r_G) +
+            SimTK::cross(V_GB[0], SimTK::cross(V_GB[0], r_G));
+        angVec = A_GB[0];
+
+        if(getInDegrees()) 
+            angVec *= SimTK_RADIAN_TO_DEGREE;   
+
+        _bodyIndAccs[i]->append(3, &vec[0]);
+        _bodyIndAccs[i]->append(3, &angVec[0]);
+    }
+
+    if(_includeCOM){
+        // Mass-weighted average of the acceleration of each body's center of
+        // mass, as SimbodyMatterSubsystem computes it for a realized state.
+        SimTK::Real totalMass = 0;
+        SimTK::Vec3 massTimesAcc(0);
+        for(SimTK::MobilizedBodyIndex b(1); b < matter.getNumBodies(); ++b){
+            const SimTK::MobilizedBody& mobod = matter.getMobilizedBody(b);
+            const SimTK::Real mass = mobod.getBodyMass(s);
+            const SimTK::Vec3 r_G = mobod.getBodyRotation(s) *
+                mobod.getBodyMassCenterStation(s);
+            const SimTK::Vec3& w = mobod.getBodyAngularVelocity(s);
+            const SimTK::SpatialVec& A_GB = bodyAccelerations[b];
+            massTimesAcc += mass * (A_GB[1] + A_GB[0] % r_G + w % (w % r_G));
+            totalMass += mass;
+        }
+        vec = massTimesAcc / totalMass;
+
+        _comIndAccs.append(3, &vec[0]);
+    }
+}
+
 /**
  * This method is called at the beginning of an analysis so that any
  * necessary initializations may be performed.
@@ -102,6 +102,13 @@ protected:
     PropertyBool _reportConstraintReactionsProp;
     bool &_reportConstraintReactions;
 
+    /** Flag to solve for the accelerations induced by all the contributors
+        other than "total" together, from a single realization of the model
+        per time, rather than realizing the model to accelerations once per
+        contributor. Not used when constraint reactions are reported. */
+    PropertyBool _solveContributorsTogetherProp;
+    bool &_solveContributorsTogether;
+
     /** Storages for recording induced accelerations for specified coordinates and/or bodies. */
     Array<Storage *> _storeInducedAccelerations;
     Storage* _storeConstraintReactions;
@@ -193,6 +200,9 @@ public:
     int begin( const SimTK::State& s) override;
     int step( const SimTK::State& s, int stepNumber) override;
     int end( const SimTK::State& s) override;
+    /** Results are kept in per-coordinate storages that are not part of
+    getStorageList(). */
+    bool isOrderIndependent() const override { return false; }
 
     //-------------------------------------------------------------------------
     // IO
@@ -208,6 +218,11 @@ public:
 protected:
     //========================== Internal Methods =============================
     int record(const SimTK::State& s);
+    void recordContributorsTogether(const SimTK::State& s,
+            const SimTK::State& s_analysis, int firstContributor);
+    void appendInducedAccelerations(const SimTK::State& s,
+            const SimTK::Vector& udot,
+            const SimTK::Vector_<SimTK::SpatialVec>& bodyAccelerations);
     void constructDescription();
     void assembleContributors();
     Array<std::string> constructColumnLabelsForCoordinate();
@@ -355,9 +355,7 @@ record(const SimTK::State& s)
             }
         }
         Function& targetFunc = _statesSplineSet.get(ind);
-        std::vector<int> firstDerivComponents(1);
-        firstDerivComponents[0]=0;
-        double targetAcceleration = targetFunc.calcDerivative(firstDerivComponents, SimTK::Vector(1, sWorkingCopy.getTime()));
+        double targetAcceleration = targetFunc.calcDerivative(sWorkingCopy.getTime(), 1);
 //cout <<  coord.getName() << " t=" << sWorkingCopy.getTime() << "  acc=" << targetAcceleration << " index=" << _accelerationIndices[i] << endl; 
         _constraintVector[i] = targetAcceleration - _constraintVector[i];
     }
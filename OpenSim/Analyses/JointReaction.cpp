@@ -169,6 +169,8 @@ setNull()
 
     _storeActuation = NULL;
 
+    _storageList.setSize(0);
+    _storageList.append(&_storeReactionLoads);
 }
 //_____________________________________________________________________________
 /**
@@ -203,6 +203,8 @@ void MuscleAnalysis::allocateStorageObjects()
     _momentArmStorageArray.setSize(0);
     _muscleArray.setMemoryOwner(false);
     _muscleArray.setSize(0);
+    _momentArmRows.setSize(0);
+    _momentArmColumns.setSize(0);
 
     // FOR MOMENT ARMS AND MOMENTS
     if(_computeMoments) {
@@ -257,6 +259,7 @@ void MuscleAnalysis::allocateStorageObjects()
                 pair->momentArmStore = _storageList[i];
                 pair->momentStore = _storageList[i+nq];
                 _momentArmStorageArray.append(pair);
+                _momentArmColumns.append(found);
             }
         }
     }
@@ -360,6 +363,8 @@ void MuscleAnalysis::allocateStorageObjects()
             if(mus){
                 _muscleArray.append(mus);
                 tmpMuscleList.append(mus->getName());
+                _momentArmRows.append(
+                        _model->getMuscles().getIndex(mus->getName()));
             }
         }
     }
@@ -641,23 +646,23 @@ int MuscleAnalysis::record(const SimTK::State& s)
 
     if (_computeMoments){
         // LOOP OVER ACTIVE MOMENT ARM STORAGE OBJECTS
-        Coordinate *q = NULL;
         Storage *maStore=NULL, *mStore=NULL;
         int nq = _momentArmStorageArray.getSize();
         Array<double> ma(0.0,nm),m(0.0,nm);
 
+        // The moment arms of all muscles about all coordinates are computed
+        // together by the model and cached for this configuration.
+        const SimTK::Matrix& momentArms = _model->getMomentArmMatrix(s);
+
         for(int i=0; i<nq; i++) {
 
-            q = _momentArmStorageArray[i]->q;
             maStore = _momentArmStorageArray[i]->momentArmStore;
             mStore = _momentArmStorageArray[i]->momentStore;
-           
-            // bool locked = q->getLocked(s);
+            const int col = _momentArmColumns[i];
 
-            _model->getMultibodySystem().realize(s, s.getSystemStage());
             // LOOP OVER MUSCLES
             for(int j=0; j<nm; j++) {
-                ma[j] = _muscleArray[j]->computeMomentArm(s,*q);
+                ma[j] = momentArms(_momentArmRows[j], col);
                 m[j] = ma[j] * force[j];
             }
             maStore->append(s.getTime(),nm,&ma[0]);
@@ -141,6 +141,11 @@ private:
     /** Array of active muscles. */
     ArrayPtrs<Muscle> _muscleArray;
 
+    /** Rows of the model's moment-arm matrix for the muscles in _muscleArray
+    and its columns for the coordinates in _momentArmStorageArray. */
+    Array<int> _momentArmRows;
+    Array<int> _momentArmColumns;
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -146,6 +146,8 @@ public:
         step(const SimTK::State& s, int setNumber ) override;
     int
         end(const SimTK::State& s ) override;
+    /** Probes may integrate or take extrema over the reported states. */
+    bool isOrderIndependent() const override { return false; }
 protected:
     virtual int
         record(const SimTK::State& s );
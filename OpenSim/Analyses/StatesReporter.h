@@ -104,6 +104,9 @@ public:
         step(const SimTK::State& s, int setNumber ) override;
     int
         end(const SimTK::State& s ) override;
+    /** States are reported exactly as they are visited (e.g., by an
+    integrator), so the record is not split across copies. */
+    bool isOrderIndependent() const override { return false; }
 protected:
     virtual int
         record(const SimTK::State& s );
@@ -46,6 +46,8 @@ using namespace std;
  */
 StaticOptimization::~StaticOptimization()
 {
+    _optimizer.reset();
+    _target.reset();
     deleteStorage();
     delete _modelWorkingCopy;
     if(_ownsForceSet) delete _forceSet;
@@ -88,6 +90,8 @@ StaticOptimization::StaticOptimization(const StaticOptimization &aStaticOptimiza
     // COPY TYPE AND NAME
     *this = aStaticOptimization;
     _forceReporter = nullptr;
+    _target = nullptr;
+    _optimizer = nullptr;
 }
 
 //=============================================================================
@@ -115,6 +119,8 @@ operator=(const StaticOptimization &aStaticOptimization)
     _convergenceCriterion=aStaticOptimization._convergenceCriterion;
     _maximumIterations=aStaticOptimization._maximumIterations;
     _forceReporter = nullptr;
+    _optimizer = nullptr;
+    _target = nullptr;
     _useMusclePhysiology=aStaticOptimization._useMusclePhysiology;
     return(*this);
 }
@@ -333,36 +339,20 @@ record(const SimTK::State& s)
 
     // Optimization target
     _modelWorkingCopy->setAllControllersEnabled(false);
-    StaticOptimizationTarget target(sWorkingCopy,_modelWorkingCopy,na,nacc,_useMusclePhysiology);
-    target.setStatesStore(_statesStore);
-    target.setStatesSplineSet(_statesSplineSet);
-    target.setActivationExponent(_activationExponent);
-    target.setDX(_numericalDerivativeStepSize);
+    if(!_target) {
+        _target.reset(new StaticOptimizationTarget(sWorkingCopy,
+                _modelWorkingCopy,na,nacc,_useMusclePhysiology));
+        _target->setStatesStore(_statesStore);
+        _target->setStatesSplineSet(_statesSplineSet);
+        _target->setActivationExponent(_activationExponent);
+        _target->setDX(_numericalDerivativeStepSize);
+    }
+    StaticOptimizationTarget& target = *_target;
 
     // Pick optimizer algorithm
     SimTK::OptimizerAlgorithm algorithm = SimTK::InteriorPoint;
     //SimTK::OptimizerAlgorithm algorithm = SimTK::CFSQP;
 
-    // Optimizer
-    SimTK::Optimizer *optimizer = new SimTK::Optimizer(target, algorithm);
-
-    // Optimizer options
-    //cout<<"\nSetting optimizer print level to "<<_printLevel<<".\n";
-    optimizer->setDiagnosticsLevel(_printLevel);
-    //cout<<"Setting optimizer convergence criterion to "<<_convergenceCriterion<<".\n";
-    optimizer->setConvergenceTolerance(_convergenceCriterion);
-    //cout<<"Setting optimizer maximum iterations to "<<_maximumIterations<<".\n";
-    optimizer->setMaxIterations(_maximumIterations);
-    optimizer->useNumericalGradient(false);
-    optimizer->useNumericalJacobian(false);
-    if(algorithm == SimTK::InteriorPoint) {
-        // Some IPOPT-specific settings
-        optimizer->setLimitedMemoryHistory(500); // works well for our small systems
-        optimizer->setAdvancedBoolOption("warm_start",true);
-        optimizer->setAdvancedRealOption("obj_scaling_factor",1);
-        optimizer->setAdvancedRealOption("nlp_scaling_max_gradient",1);
-    }
-
     // Parameter bounds
     SimTK::Vector lowerBounds(na), upperBounds(na);
     for(int i=0,j=0;i<fs.getSize();i++) {
@@ -376,7 +366,30 @@ record(const SimTK::State& s)
     
     target.setParameterLimits(lowerBounds, upperBounds);
 
-    _parameters = 0; // Set initial guess to zeros
+    // Optimizer
+    if(!_optimizer) {
+        _optimizer.reset(new SimTK::Optimizer(target, algorithm));
+
+        // Optimizer options
+        //cout<<"\nSetting optimizer print level to "<<_printLevel<<".\n";
+        _optimizer->setDiagnosticsLevel(_printLevel);
+        //cout<<"Setting optimizer convergence criterion to "<<_convergenceCriterion<<".\n";
+        _optimizer->setConvergenceTolerance(_convergenceCriterion);
+        //cout<<"Setting optimizer maximum iterations to "<<_maximumIterations<<".\n";
+        _optimizer->setMaxIterations(_maximumIterations);
+        _optimizer->useNumericalGradient(false);
+        _optimizer->useNumericalJacobian(false);
+        if(algorithm == SimTK::InteriorPoint) {
+            // Some IPOPT-specific settings
+            _optimizer->setLimitedMemoryHistory(500); // works well for our small systems
+            _optimizer->setAdvancedBoolOption("warm_start",true);
+            _optimizer->setAdvancedRealOption("obj_scaling_factor",1);
+            _optimizer->setAdvancedRealOption("nlp_scaling_max_gradient",1);
+        }
+
+        _parameters = 0; // Fresh optimizer: set initial guess to zeros
+    }
+    // Otherwise the initial guess is the solution at the previous time point.
 
     // Static optimization
     _modelWorkingCopy->getMultibodySystem().realize(sWorkingCopy,SimTK::Stage::Velocity);
@@ -391,7 +404,7 @@ record(const SimTK::State& s)
 
     try {
         target.setCurrentState( &sWorkingCopy );
-        optimizer->optimize(_parameters);
+        _optimizer->optimize(_parameters);
     }
     catch (const SimTK::Exception::Base& ex) {
         log_warn(ex.getMessage());
@@ -400,6 +413,9 @@ record(const SimTK::State& s)
                  "solution at time = {}.",
                 s.getTime());
 
+        // Don't warm start the next time point from a failed solve.
+        _optimizer.reset();
+
         double tolBounds = 1e-1;
         bool weakModel = false;
         string msgWeak = "The model appears too weak for static optimization.\nTry increasing the strength and/or range of the following force(s):\n";
@@ -513,6 +529,8 @@ int StaticOptimization::begin(const SimTK::State& s )
     if(!proceed()) return(0);
 
     // Make a working copy of the model
+    _optimizer.reset();
+    _target.reset();
     delete _modelWorkingCopy;
     _modelWorkingCopy = _model->clone();
     // Remove disabled Actuators so we don't use them downstream (issue #2438)
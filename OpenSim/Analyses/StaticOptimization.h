@@ -41,6 +41,7 @@ namespace OpenSim {
 
 class Model;
 class ForceSet;
+class StaticOptimizationTarget;
 
 /**
  * This class implements static optimization to compute Muscle Forces and 
@@ -59,6 +60,12 @@ private:
 
     std::unique_ptr<ForceReporter> _forceReporter;
 
+    /** The optimization target and optimizer are kept alive between calls to
+    record() so that each time point is warm started from the solution (and
+    IPOPT multipliers) of the previous one. */
+    std::unique_ptr<StaticOptimizationTarget> _target;
+    std::unique_ptr<SimTK::Optimizer> _optimizer;
+
 protected:
     /** Use force set from model. */
     PropertyBool _useModelForceSetProp;
@@ -144,6 +151,9 @@ public:
         step(const SimTK::State& s, int setNumber ) override;
     int
         end(const SimTK::State& s ) override;
+    /** Each time point is warm started from the previous solution and
+    updates the default muscle activations. */
+    bool isOrderIndependent() const override { return false; }
 protected:
     virtual int
         record(const SimTK::State& s );
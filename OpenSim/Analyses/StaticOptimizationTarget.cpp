@@ -67,6 +67,11 @@ StaticOptimizationTarget(const SimTK::State& s, Model *aModel,int aNP,int aNC, b
     _useMusclePhysiology=useMusclePhysiology;
 
     setModel(*aModel);
+    const ForceSet& fSet = aModel->getForceSet();
+    for(int i=0;i<fSet.getSize();i++) {
+        const ScalarActuator* act = dynamic_cast<const ScalarActuator*>(&fSet.get(i));
+        if( act ) _actuators.push_back(act);
+    }
     setNumParams(aNP);
     setNumConstraints(aNC);
     setActivationExponent(2.0);
@@ -121,17 +126,38 @@ prepareToOptimize(SimTK::State& s, double *x)
     _constraintMatrix.resize(nc,np);
     _constraintVector.resize(nc);
 
-    Vector pVector(np), cVector(nc);
-
-    // Build linear constraint matrix and constant constraint vector
-    pVector = 0;
-    computeConstraintVector(s, pVector,_constraintVector);
-
+    // The target accelerations do not depend on the parameters, so the
+    // splines are evaluated once per time point rather than once per column.
+    Vector targetAcceleration(nc), aVector(nc);
+    computeTargetAcceleration(s, targetAcceleration);
+
+    // Constant constraint vector (all actuators off)
+    Vector pVector(np, 0.0);
+    computeAcceleration(s, pVector, aVector);
+    _constraintVector = targetAcceleration - aVector;
+
+    // Accelerations are linear in the actuations, so column p of the matrix
+    // is the change in acceleration due to a unit activation of actuator p.
+    // Only the applied forces change from column to column: realize through
+    // Dynamics to collect them and solve for udot directly, rather than
+    // realizing the whole system to Acceleration for every parameter.
+    const SimTK::MultibodySystem& system = _model->getMultibodySystem();
+    const SimTK::SimbodyMatterSubsystem& matter = _model->getMatterSubsystem();
+    const Vector udot0 = matter.getUDot(s);
+    Vector udot;
+    SimTK::Vector_<SimTK::SpatialVec> A_GB;
     for(int p=0; p<np; p++) {
-        pVector[p] = 1;
-        computeConstraintVector(s, pVector, cVector);
-        for(int c=0; c<nc; c++) _constraintMatrix(c,p) = (cVector[c] - _constraintVector[c]);
-        pVector[p] = 0;
+        _actuators[p]->setOverrideActuation(s, _optimalForce[p]);
+        system.realize(s, SimTK::Stage::Dynamics);
+        matter.calcAcceleration(s,
+                system.getMobilityForces(s, SimTK::Stage::Dynamics),
+                system.getRigidBodyForces(s, SimTK::Stage::Dynamics),
+                udot, A_GB);
+        for(int c=0; c<nc; c++) {
+            const int u = _accelerationIndices[c];
+            _constraintMatrix(c,p) = udot0[u] - udot[u];
+        }
+        _actuators[p]->setOverrideActuation(s, 0.0);
     }
 #endif
 
@@ -581,9 +607,27 @@ computeConstraintVector(SimTK::State& s, const Vector &parameters,Vector &constr
     Vector actualAcceleration(getNumConstraints());
     computeAcceleration(s, parameters, actualAcceleration);
 
+    // CONSTRAINTS
+    computeTargetAcceleration(s, constraints);
+    constraints -= actualAcceleration;
+
+    //QueryPerformanceCounter(&stop);
+    //double duration = (double)(stop.QuadPart-start.QuadPart)/(double)frequency.QuadPart;
+    //std::cout << "computeConstraintVector time = " << (duration*1.0e3) << " milliseconds" << std::endl;
+
+    // 1.5 ms
+}
+//______________________________________________________________________________
+/**
+ * Compute the desired accelerations of the unconstrained coordinates from the
+ * splined states at the time of the given state.
+ */
+void StaticOptimizationTarget::
+computeTargetAcceleration(const SimTK::State& s, Vector &rAccel) const
+{
     auto coordinates = _model->getCoordinatesInMultibodyTreeOrder();
 
-    // CONSTRAINTS
+    const double time = s.getTime();
     for(int i=0; i<getNumConstraints(); i++) {
         const Coordinate& coord = *coordinates[_accelerationIndices[i]];
         int ind = _statesStore->getStateIndex(coord.getSpeedName(), 0);
@@ -598,18 +642,9 @@ computeConstraintVector(SimTK::State& s, const Vector &parameters,Vector &constr
                 throw Exception(msg);
             }
         }
-        Function& targetFunc = _statesSplineSet.get(ind);
-        std::vector<int> derivComponents(1,0); //take first derivative
-        double targetAcceleration = targetFunc.calcDerivative(derivComponents, SimTK::Vector(1, s.getTime()));
-        //std::cout << "computeConstraintVector:" << targetAcceleration << " - " <<  actualAcceleration[i] << endl;
-        constraints[i] = targetAcceleration - actualAcceleration[i];
+        const Function& targetFunc = _statesSplineSet.get(ind);
+        rAccel[i] = targetFunc.calcDerivative(time, 1); //take first derivative
     }
-
-    //QueryPerformanceCounter(&stop);
-    //double duration = (double)(stop.QuadPart-start.QuadPart)/(double)frequency.QuadPart;
-    //std::cout << "computeConstraintVector time = " << (duration*1.0e3) << " milliseconds" << std::endl;
-
-    // 1.5 ms
 }
 //______________________________________________________________________________
 /**
@@ -660,14 +695,8 @@ computeAcceleration(SimTK::State& s, const SimTK::Vector &parameters,SimTK::Vect
     // double time = s.getTime();
     
 
-    const ForceSet& fs = _model->getForceSet();
-    for(int i=0,j=0;i<fs.getSize();i++)  {
-        ScalarActuator *act = dynamic_cast<ScalarActuator*>(&fs.get(i));
-         if( act ) {
-             act->setOverrideActuation(s, parameters[j] * _optimalForce[j]);
-             j++;
-         }
-    }
+    for(int j=0; j<(int)_actuators.size(); j++)
+        _actuators[j]->setOverrideActuation(s, parameters[j] * _optimalForce[j]);
 
     _model->getMultibodySystem().realize(s,SimTK::Stage::Acceleration);
 
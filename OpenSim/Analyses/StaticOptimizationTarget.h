@@ -35,6 +35,8 @@
 //=============================================================================
 namespace OpenSim { 
 
+class ScalarActuator;
+
 /**
  * This class provides an interface specification for static optimization Objective Function.
  *
@@ -61,6 +63,8 @@ private:
     Array<double> _recipOptForceSquared;
     /** Optimal force accounting for force-length curve if desired and if actuator is a muscle. */
     Array<double> _optimalForce;
+    /** Actuators corresponding to the parameters, in parameter order. */
+    SimTK::Array_<const ScalarActuator*> _actuators;
     
     SimTK::Matrix _constraintMatrix;
     SimTK::Vector _constraintVector;
@@ -123,6 +127,7 @@ public:
 
 private:
     void computeConstraintVector(SimTK::State& s, const SimTK::Vector &x, SimTK::Vector &c) const;
+    void computeTargetAcceleration(const SimTK::State& s, SimTK::Vector &rAccel) const;
     void computeAcceleration(SimTK::State& s, const SimTK::Vector &aF,SimTK::Vector &rAccel) const;
     void cumulativeTime(double &aTime, double aIncrement);
 };
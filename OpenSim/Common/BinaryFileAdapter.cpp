@@ -0,0 +1,506 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  BinaryFileAdapter.cpp                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "BinaryFileAdapter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+using namespace OpenSim;
+
+namespace {
+
+const char           magic[8]{'O', 'S', 'I', 'M', 'B', 'S', 'T', 'O'};
+const std::uint32_t  formatVersion{1};
+const std::size_t    dataTypeNameSize{16};
+const std::size_t    dataAlignment{64};
+
+// Element types that can be stored. Each element is stored as its components,
+// one after the other.
+template<typename T> struct Element;
+
+template<> struct Element<double> {
+    static const char* name() { return "double"; }
+    static constexpr int numComponents = 1;
+    static void get(const double& elem, double* comps) { comps[0] = elem; }
+    static void set(const double* comps, double& elem) { elem = comps[0]; }
+};
+
+template<> struct Element<SimTK::Vec3> {
+    static const char* name() { return "Vec3"; }
+    static constexpr int numComponents = 3;
+    static void get(const SimTK::Vec3& elem, double* comps) {
+        for(int i = 0; i < 3; ++i) comps[i] = elem[i];
+    }
+    static void set(const double* comps, SimTK::Vec3& elem) {
+        elem = SimTK::Vec3(comps[0], comps[1], comps[2]);
+    }
+};
+
+template<> struct Element<SimTK::Quaternion> {
+    static const char* name() { return "Quaternion"; }
+    static constexpr int numComponents = 4;
+    static void get(const SimTK::Quaternion& elem, double* comps) {
+        for(int i = 0; i < 4; ++i) comps[i] = elem[i];
+    }
+    static void set(const double* comps, SimTK::Quaternion& elem) {
+        // The stored quaternion was already normalized when it was written;
+        // don't normalize it again so that it round-trips exactly.
+        elem = SimTK::Quaternion(
+                SimTK::Vec4(comps[0], comps[1], comps[2], comps[3]), true);
+    }
+};
+
+template<> struct Element<SimTK::SpatialVec> {
+    static const char* name() { return "SpatialVec"; }
+    static constexpr int numComponents = 6;
+    static void get(const SimTK::SpatialVec& elem, double* comps) {
+        for(int i = 0; i < 3; ++i) {
+            comps[i]     = elem[0][i];
+            comps[i + 3] = elem[1][i];
+        }
+    }
+    static void set(const double* comps, SimTK::SpatialVec& elem) {
+        elem = SimTK::SpatialVec{{comps[0], comps[1], comps[2]},
+                                 {comps[3], comps[4], comps[5]}};
+    }
+};
+
+bool isLittleEndian() {
+    const std::uint16_t one{1};
+    unsigned char first{};
+    std::memcpy(&first, &one, 1);
+    return first == 1;
+}
+
+// Reverse the bytes of every value in the buffer.
+template<typename U>
+void swapBytes(U* values, std::size_t count) {
+    for(std::size_t i = 0; i < count; ++i) {
+        unsigned char bytes[sizeof(U)];
+        std::memcpy(bytes, &values[i], sizeof(U));
+        std::reverse(bytes, bytes + sizeof(U));
+        std::memcpy(&values[i], bytes, sizeof(U));
+    }
+}
+
+// Write/read values in little-endian byte order.
+template<typename U>
+void writeValues(std::ostream& stream, const U* values, std::size_t count) {
+    if(isLittleEndian()) {
+        stream.write(reinterpret_cast<const char*>(values),
+                     count * sizeof(U));
+    } else {
+        std::vector<U> swapped(values, values + count);
+        swapBytes(swapped.data(), count);
+        stream.write(reinterpret_cast<const char*>(swapped.data()),
+                     count * sizeof(U));
+    }
+}
+
+template<typename U>
+void writeValue(std::ostream& stream, const U& value) {
+    writeValues(stream, &value, 1);
+}
+
+void writeString(std::ostream& stream, const std::string& str) {
+    writeValue(stream, static_cast<std::uint32_t>(str.size()));
+    stream.write(str.data(), str.size());
+}
+
+template<typename U>
+void readValues(std::istream& stream, const std::string& fileName,
+                U* values, std::size_t count) {
+    stream.read(reinterpret_cast<char*>(values), count * sizeof(U));
+    OPENSIM_THROW_IF(
+            static_cast<std::size_t>(stream.gcount()) != count * sizeof(U),
+            IOError, "Unexpected end of file '" + fileName + "'.");
+    if(!isLittleEndian())
+        swapBytes(values, count);
+}
+
+template<typename U>
+U readValue(std::istream& stream, const std::string& fileName) {
+    U value{};
+    readValues(stream, fileName, &value, 1);
+    return value;
+}
+
+std::string readString(std::istream& stream, const std::string& fileName) {
+    const auto size = readValue<std::uint32_t>(stream, fileName);
+    std::string str(size, '\0');
+    if(size > 0)
+        readValues(stream, fileName, &str[0], size);
+    return str;
+}
+
+// Everything in the file that precedes the data section.
+struct Header {
+    std::string                         dataType;
+    std::uint32_t                       numComponents;
+    std::uint64_t                       numRows;
+    std::uint64_t                       numColumns;
+    std::uint64_t                       dataOffset;
+    AbstractDataTable::TableMetaData    tableMetaData;
+    AbstractDataTable::DependentsMetaData dependentsMetaData;
+    std::vector<std::string>            labels;
+};
+
+Header readHeader(std::istream& stream, const std::string& fileName) {
+    char fileMagic[sizeof(magic)]{};
+    stream.read(fileMagic, sizeof(magic));
+    OPENSIM_THROW_IF(
+            static_cast<std::size_t>(stream.gcount()) != sizeof(magic) ||
+            std::memcmp(fileMagic, magic, sizeof(magic)) != 0,
+            IOError, "File '" + fileName + "' is not a binary table file.");
+    const auto version = readValue<std::uint32_t>(stream, fileName);
+    OPENSIM_THROW_IF(version > formatVersion, IOError,
+            "File '" + fileName + "' has format version " +
+            std::to_string(version) + " but only versions up to " +
+            std::to_string(formatVersion) + " are supported.");
+
+    Header header{};
+    header.numComponents = readValue<std::uint32_t>(stream, fileName);
+    char dataType[dataTypeNameSize]{};
+    readValues(stream, fileName, dataType, dataTypeNameSize);
+    header.dataType = std::string(dataType,
+            std::find(dataType, dataType + dataTypeNameSize, '\0'));
+    header.numRows    = readValue<std::uint64_t>(stream, fileName);
+    header.numColumns = readValue<std::uint64_t>(stream, fileName);
+    header.dataOffset = readValue<std::uint64_t>(stream, fileName);
+    readValue<std::uint64_t>(stream, fileName); // Reserved.
+
+    const auto numTableMetaData = readValue<std::uint32_t>(stream, fileName);
+    for(std::uint32_t i = 0; i < numTableMetaData; ++i) {
+        const auto key = readString(stream, fileName);
+        header.tableMetaData.setValueForKey(key, readString(stream, fileName));
+    }
+    const auto numDependentsMetaData =
+            readValue<std::uint32_t>(stream, fileName);
+    for(std::uint32_t i = 0; i < numDependentsMetaData; ++i) {
+        const auto key = readString(stream, fileName);
+        ValueArray<std::string> values{};
+        values.upd().reserve(header.numColumns);
+        for(std::uint64_t col = 0; col < header.numColumns; ++col)
+            values.upd().push_back(
+                    SimTK::Value<std::string>{readString(stream, fileName)});
+        if(key == "labels")
+            for(const auto& value : values.get())
+                header.labels.push_back(value.get());
+        header.dependentsMetaData.setValueArrayForKey(key, values);
+    }
+    OPENSIM_THROW_IF(header.labels.size() != header.numColumns, IOError,
+            "File '" + fileName + "' does not contain column labels.");
+    return header;
+}
+
+std::streamoff columnOffset(const Header& header, std::uint64_t col) {
+    return static_cast<std::streamoff>(header.dataOffset + sizeof(double) *
+            header.numRows * (1 + col * header.numComponents));
+}
+
+// Read the time column and the given dependent columns of the data section.
+template<typename T>
+std::shared_ptr<TimeSeriesTable_<T>>
+readTable(std::istream& stream, const std::string& fileName,
+          const Header& header, const std::vector<std::uint64_t>& columns) {
+    OPENSIM_THROW_IF(header.numComponents != Element<T>::numComponents,
+            IOError, "File '" + fileName + "' has an unexpected number of "
+            "components for data type '" + header.dataType + "'.");
+    const auto nrow = static_cast<int>(header.numRows);
+    const int ncomp = Element<T>::numComponents;
+
+    std::vector<double> times(nrow);
+    stream.seekg(static_cast<std::streamoff>(header.dataOffset));
+    readValues(stream, fileName, times.data(), times.size());
+
+    // Read the whole data section at once if all the columns are requested
+    // in the order they are stored. Otherwise seek to each column.
+    bool allColumns = columns.size() == header.numColumns;
+    for(std::size_t i = 0; allColumns && i < columns.size(); ++i)
+        allColumns = columns[i] == i;
+
+    std::vector<double> data{};
+    if(allColumns) {
+        data.resize(std::size_t(nrow) * ncomp * columns.size());
+        readValues(stream, fileName, data.data(), data.size());
+    } else {
+        data.resize(std::size_t(nrow) * ncomp);
+    }
+
+    SimTK::Matrix_<T> matrix(nrow, static_cast<int>(columns.size()));
+    std::vector<std::string> labels{};
+    for(std::size_t i = 0; i < columns.size(); ++i) {
+        const double* column = data.data();
+        if(allColumns) {
+            column += i * std::size_t(nrow) * ncomp;
+        } else {
+            stream.seekg(columnOffset(header, columns[i]));
+            readValues(stream, fileName, data.data(), data.size());
+        }
+        for(int row = 0; row < nrow; ++row)
+            Element<T>::set(column + std::size_t(row) * ncomp,
+                            matrix.updElt(row, static_cast<int>(i)));
+        labels.push_back(header.labels[columns[i]]);
+    }
+
+    auto table = std::make_shared<TimeSeriesTable_<T>>(times, matrix, labels);
+    table->updTableMetaData() = header.tableMetaData;
+
+    // Restrict the rest of the dependents metadata to the requested columns.
+    AbstractDataTable::DependentsMetaData dependentsMetaData{};
+    for(const auto& key : header.dependentsMetaData.getKeys()) {
+        const auto& all = static_cast<const ValueArray<std::string>&>(
+                header.dependentsMetaData.getValueArrayForKey(key));
+        ValueArray<std::string> values{};
+        for(const auto col : columns)
+            values.upd().push_back(all.get()[col]);
+        dependentsMetaData.setValueArrayForKey(key, values);
+    }
+    table->setDependentsMetaData(dependentsMetaData);
+    return table;
+}
+
+std::shared_ptr<AbstractDataTable>
+readTable(std::istream& stream, const std::string& fileName,
+          const Header& header, const std::vector<std::uint64_t>& columns) {
+    if(header.dataType == Element<double>::name())
+        return readTable<double>(stream, fileName, header, columns);
+    if(header.dataType == Element<SimTK::Vec3>::name())
+        return readTable<SimTK::Vec3>(stream, fileName, header, columns);
+    if(header.dataType == Element<SimTK::Quaternion>::name())
+        return readTable<SimTK::Quaternion>(stream, fileName, header,
+                                            columns);
+    if(header.dataType == Element<SimTK::SpatialVec>::name())
+        return readTable<SimTK::SpatialVec>(stream, fileName, header,
+                                            columns);
+    OPENSIM_THROW(IOError, "File '" + fileName + "' has unsupported data "
+                  "type '" + header.dataType + "'.");
+}
+
+void openForReading(std::ifstream& stream, const std::string& fileName) {
+    OPENSIM_THROW_IF(fileName.empty(),
+                     EmptyFileName);
+    stream.open(fileName, std::ios::binary);
+    OPENSIM_THROW_IF(!stream.good(),
+                     FileDoesNotExist,
+                     fileName);
+}
+
+template<typename T>
+void writeTable(const TimeSeriesTable_<T>& table,
+                const std::string& fileName) {
+    OPENSIM_THROW_IF(fileName.empty(),
+                     EmptyFileName);
+    std::ofstream stream{fileName, std::ios::binary};
+    OPENSIM_THROW_IF(!stream.good(), IOError,
+                     "Could not open file '" + fileName + "' for writing.");
+
+    const std::size_t nrow = table.getNumRows();
+    const std::size_t ncol = table.getNumColumns();
+    const int ncomp = Element<T>::numComponents;
+
+    // Only the metadata whose values are strings is written.
+    std::vector<std::pair<std::string, std::string>> tableMetaData{};
+    for(const auto& key : table.getTableMetaDataKeys()) {
+        const auto values = dynamic_cast<const ValueArray<std::string>*>(
+                &table.getTableMetaData().getValueArrayForKey(key));
+        if(values && values->size() > 0)
+            tableMetaData.emplace_back(key, values->get()[0].get());
+    }
+    std::vector<std::pair<std::string, const ValueArray<std::string>*>>
+            dependentsMetaData{};
+    const auto& depMetaData = table.getDependentsMetaData();
+    for(const auto& key : depMetaData.getKeys()) {
+        const auto values = dynamic_cast<const ValueArray<std::string>*>(
+                &depMetaData.getValueArrayForKey(key));
+        if(values && values->size() == ncol)
+            dependentsMetaData.emplace_back(key, values);
+    }
+
+    // Fixed-size header. The offset of the data section is written once the
+    // size of the metadata section is known.
+    stream.write(magic, sizeof(magic));
+    writeValue(stream, formatVersion);
+    writeValue(stream, static_cast<std::uint32_t>(ncomp));
+    char dataType[dataTypeNameSize]{};
+    std::strncpy(dataType, Element<T>::name(), dataTypeNameSize - 1);
+    stream.write(dataType, dataTypeNameSize);
+    writeValue(stream, static_cast<std::uint64_t>(nrow));
+    writeValue(stream, static_cast<std::uint64_t>(ncol));
+    const auto dataOffsetPos = stream.tellp();
+    writeValue(stream, std::uint64_t{0});
+    writeValue(stream, std::uint64_t{0}); // Reserved.
+
+    // Metadata section.
+    writeValue(stream, static_cast<std::uint32_t>(tableMetaData.size()));
+    for(const auto& keyValue : tableMetaData) {
+        writeString(stream, keyValue.first);
+        writeString(stream, keyValue.second);
+    }
+    writeValue(stream, static_cast<std::uint32_t>(dependentsMetaData.size()));
+    for(const auto& keyValues : dependentsMetaData) {
+        writeString(stream, keyValues.first);
+        for(const auto& value : keyValues.second->get())
+            writeString(stream, value.get());
+    }
+
+    // Pad so that the data section is aligned.
+    const auto metaDataEnd = static_cast<std::uint64_t>(stream.tellp());
+    const std::uint64_t dataOffset =
+        (metaDataEnd + dataAlignment - 1) / dataAlignment * dataAlignment;
+    const std::vector<char> padding(dataOffset - metaDataEnd, '\0');
+    stream.write(padding.data(), padding.size());
+
+    // Data section: the time column, then each column in turn.
+    const auto& times = table.getIndependentColumn();
+    writeValues(stream, times.data(), times.size());
+    std::vector<double> column(nrow * ncomp);
+    for(std::size_t col = 0; col < ncol; ++col) {
+        const auto values = table.getDependentColumnAtIndex(col);
+        for(std::size_t row = 0; row < nrow; ++row)
+            Element<T>::get(values[static_cast<int>(row)],
+                            &column[row * ncomp]);
+        writeValues(stream, column.data(), column.size());
+    }
+
+    stream.seekp(dataOffsetPos);
+    writeValue(stream, dataOffset);
+
+    OPENSIM_THROW_IF(!stream.good(), IOError,
+                     "Failed to write file '" + fileName + "'.");
+}
+
+} // anonymous namespace
+
+BinaryFileAdapter*
+BinaryFileAdapter::clone() const {
+    return new BinaryFileAdapter{*this};
+}
+
+const std::string&
+BinaryFileAdapter::tableString() {
+    static const std::string table{"table"};
+    return table;
+}
+
+void
+BinaryFileAdapter::write(const TimeSeriesTable& table,
+                         const std::string& fileName) {
+    writeTable(table, fileName);
+}
+
+void
+BinaryFileAdapter::write(const TimeSeriesTableVec3& table,
+                         const std::string& fileName) {
+    writeTable(table, fileName);
+}
+
+void
+BinaryFileAdapter::write(const TimeSeriesTableQuaternion& table,
+                         const std::string& fileName) {
+    writeTable(table, fileName);
+}
+
+void
+BinaryFileAdapter::write(const TimeSeriesTable_<SimTK::SpatialVec>& table,
+                         const std::string& fileName) {
+    writeTable(table, fileName);
+}
+
+std::vector<std::string>
+BinaryFileAdapter::readColumnLabels(const std::string& fileName) {
+    std::ifstream stream{};
+    openForReading(stream, fileName);
+    return readHeader(stream, fileName).labels;
+}
+
+BinaryFileAdapter::OutputTables
+BinaryFileAdapter::readColumns(const std::string& fileName,
+        const std::vector<std::string>& columnLabels) const {
+    std::ifstream stream{};
+    openForReading(stream, fileName);
+    const auto header = readHeader(stream, fileName);
+
+    std::vector<std::uint64_t> columns{};
+    for(const auto& label : columnLabels) {
+        const auto found = std::find(header.labels.begin(),
+                                     header.labels.end(), label);
+        OPENSIM_THROW_IF(found == header.labels.end(),
+                         KeyNotFound, label);
+        columns.push_back(found - header.labels.begin());
+    }
+
+    OutputTables tables{};
+    tables.emplace(tableString(),
+                   readTable(stream, fileName, header, columns));
+    return tables;
+}
+
+BinaryFileAdapter::OutputTables
+BinaryFileAdapter::extendRead(const std::string& fileName) const {
+    std::ifstream stream{};
+    openForReading(stream, fileName);
+    const auto header = readHeader(stream, fileName);
+
+    std::vector<std::uint64_t> columns(header.numColumns);
+    for(std::uint64_t col = 0; col < header.numColumns; ++col)
+        columns[col] = col;
+
+    OutputTables tables{};
+    tables.emplace(tableString(),
+                   readTable(stream, fileName, header, columns));
+    return tables;
+}
+
+void
+BinaryFileAdapter::extendWrite(const InputTables& absTables,
+                               const std::string& fileName) const {
+    OPENSIM_THROW_IF(absTables.empty(),
+                     NoTableFound);
+
+    const AbstractDataTable* absTable{};
+    try {
+        absTable = absTables.at(tableString());
+    } catch(std::out_of_range&) {
+        OPENSIM_THROW(KeyMissing,
+                      tableString());
+    }
+
+    if(auto table = dynamic_cast<const TimeSeriesTable*>(absTable))
+        writeTable(*table, fileName);
+    else if(auto table = dynamic_cast<const TimeSeriesTableVec3*>(absTable))
+        writeTable(*table, fileName);
+    else if(auto table =
+            dynamic_cast<const TimeSeriesTableQuaternion*>(absTable))
+        writeTable(*table, fileName);
+    else if(auto table = dynamic_cast<
+            const TimeSeriesTable_<SimTK::SpatialVec>*>(absTable))
+        writeTable(*table, fileName);
+    else
+        OPENSIM_THROW(IncorrectTableType,
+                      "Supported types are TimeSeriesTable, "
+                      "TimeSeriesTableVec3, TimeSeriesTableQuaternion and "
+                      "TimeSeriesTable_<SpatialVec>.");
+}
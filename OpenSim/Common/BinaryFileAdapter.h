@@ -0,0 +1,128 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  BinaryFileAdapter.h                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#ifndef OPENSIM_BINARY_FILE_ADAPTER_H_
+#define OPENSIM_BINARY_FILE_ADAPTER_H_
+
+/** @file
+* BinaryFileAdapter is a concrete FileAdapter for reading and writing
+TimeSeriesTable_ objects in a binary, columnar format (extension ".bsto").
+Values are stored as IEEE 754 doubles, so they round-trip exactly and do not
+need to be formatted or parsed. All numbers are little-endian. The file is
+laid out as follows:
+
+\code
+offset  size  content
+0       8     magic string "OSIMBSTO"
+8       4     format version (uint32)
+12      4     number of components per element: 1, 3, 4 or 6 (uint32)
+16      16    data type name, NUL padded: double, Vec3, Quaternion, SpatialVec
+32      8     number of rows (uint64)
+40      8     number of columns (uint64)
+48      8     offset of the data section from the start of the file (uint64)
+56      8     reserved
+64      ...   metadata section
+\endcode
+
+The metadata section holds the table metadata and the dependents metadata
+(which includes the column labels). Only entries whose values are strings are
+stored. A string is its length (uint32) followed by its characters.
+
+\code
+uint32 number of table metadata entries, then for each: key, value
+uint32 number of dependents metadata entries, then for each: key, then one
+       string per column
+\endcode
+
+The data section starts at an offset that is a multiple of 64 bytes. It holds
+the independent (time) column followed by each of the dependent columns, one
+after the other. Each dependent column is stored row by row, with the
+components of an element next to each other. Since every column is
+contiguous and at a known offset, a subset of the columns can be read (or
+memory-mapped) without touching the rest of the file; see readColumns().   */
+
+#include "FileAdapter.h"
+#include "TimeSeriesTable.h"
+
+namespace OpenSim {
+
+/** BinaryFileAdapter is a FileAdapter that reads and writes binary, columnar
+".bsto" files. Tables of type double, SimTK::Vec3, SimTK::Quaternion and
+SimTK::SpatialVec are supported. The tables returned by read() and
+readColumns() and accepted by extendWrite() are keyed by tableString().     */
+class OSIMCOMMON_API BinaryFileAdapter : public FileAdapter {
+public:
+    BinaryFileAdapter()                                    = default;
+    BinaryFileAdapter(const BinaryFileAdapter&)            = default;
+    BinaryFileAdapter(BinaryFileAdapter&&)                 = default;
+    BinaryFileAdapter& operator=(const BinaryFileAdapter&) = default;
+    BinaryFileAdapter& operator=(BinaryFileAdapter&&)      = default;
+    ~BinaryFileAdapter()                                   = default;
+
+    BinaryFileAdapter* clone() const override;
+
+    /** Write a table to a binary file.                                       */
+    static
+    void write(const TimeSeriesTable& table, const std::string& fileName);
+    /** Write a table to a binary file.                                       */
+    static
+    void write(const TimeSeriesTableVec3& table, const std::string& fileName);
+    /** Write a table to a binary file.                                       */
+    static
+    void write(const TimeSeriesTableQuaternion& table,
+               const std::string& fileName);
+    /** Write a table to a binary file.                                       */
+    static
+    void write(const TimeSeriesTable_<SimTK::SpatialVec>& table,
+               const std::string& fileName);
+
+    /** Read the column labels of the table in a binary file without reading
+    any of its data.                                                          */
+    static
+    std::vector<std::string> readColumnLabels(const std::string& fileName);
+
+    /** Read only the columns with the given labels, in the given order, from
+    a binary file. The data of the other columns is not read. The returned
+    table has the same metadata as the table in the file, with the dependents
+    metadata restricted to the requested columns.
+
+    \throws KeyNotFound If a label is not a column of the table in the file.
+                                                                              */
+    OutputTables readColumns(const std::string& fileName,
+                       const std::vector<std::string>& columnLabels) const;
+
+    /** Key used for table associative array returned/accepted by
+    read/write.                                                               */
+    static const std::string& tableString();
+
+protected:
+    /** Implementation of the read functionality.                             */
+    OutputTables extendRead(const std::string& fileName) const override;
+
+    /** Implementation of the write functionality.                            */
+    void extendWrite(const InputTables& tables,
+                     const std::string& fileName) const override;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_BINARY_FILE_ADAPTER_H_
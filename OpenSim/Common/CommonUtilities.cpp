@@ -117,7 +117,7 @@ SimTK::Vector OpenSim::interpolate(const SimTK::Vector& x,
     for (int i = 0; i < newX.size(); ++i) {
         const auto& newXi = newX[i];
         if (x_no_nans[0] <= newXi && newXi <= x_no_nans[x_no_nans.size() - 1])
-            newY[i] = function.calcValue(SimTK::Vector(1, newXi));
+            newY[i] = function.calcValue(newXi);
     }
     return newY;
 }
@@ -26,6 +26,7 @@
 #include "Component.h"
 #include "OpenSim/Common/IO.h"
 #include "XMLDocument.h"
+#include <atomic>
 #include <unordered_map>
 #include <set>
 #include <regex>
@@ -301,6 +302,12 @@ void Component::finalizeConnections(Component& root)
         finalizeFromProperties();
     }
 
+    // The tree is now final, so the root can index the paths of its
+    // components for the Sockets and Inputs to look up their connectees.
+    if (!hasOwner()) {
+        buildPathIndex();
+    }
+
     for (auto& it : _socketsTable) {
         auto& socket = it.second;
         try {
@@ -337,6 +344,11 @@ void Component::finalizeConnections(Component& root)
     // Forming connections changes the Socket which is a property
     // Remark as upToDate.
     setObjectIsUpToDateWithProperties();
+
+    // Re-index if subcomponents were added or removed while connecting.
+    if (!hasOwner() && !isPathIndexCurrent()) {
+        buildPathIndex();
+    }
 }
 
 // invoke connect on all (sub)components of this component
@@ -392,6 +404,12 @@ void Component::addToSystem(SimTK::MultibodySystem& system) const
     extendAddToSystem(system);
     componentsAddToSystem(system);
     extendAddToSystemAfterSubcomponents(system);
+
+    // All the state variables of the tree have now been allocated.
+    if (!hasOwner()) {
+        if (!isPathIndexCurrent()) buildPathIndex();
+        buildStateVariablePathIndex();
+    }
 }
 
 // Base class implementation of virtual method.
@@ -776,6 +794,26 @@ const Component::StateVariable* Component::
             return it->second.stateVariable.get();
         }
     } else if (svPath.getNumPathLevels() > 1) {
+        // Use the root's index of the state variable paths, if it is up to
+        // date.
+        const PathIndex* index = getPathIndex();
+        std::string absolutePath;
+        if (index && index->hasStateVariables &&
+                index->stateVariablesGeneration == getComponentGeneration() &&
+                formAbsolutePathString(svPath, absolutePath)) {
+            const auto it = index->stateVariables.find(absolutePath);
+            // The owner or one of its ancestors may have been renamed since
+            // the index was built.
+            if (it != index->stateVariables.end()) {
+                const Component& owner = it->second->getOwner();
+                const std::string ownerPath = owner.getAbsolutePathString();
+                if ((ownerPath == "/" ? "" : ownerPath) + "/" +
+                        it->second->getName() == absolutePath) {
+                    return it->second;
+                }
+            }
+        }
+
         const auto& compPath = svPath.getParentPath();
         const Component* comp = traversePathToComponent<Component>(compPath);
         if (comp) {
@@ -787,6 +825,152 @@ const Component::StateVariable* Component::
     return found;
 }
 
+const Component* Component::findInPathIndex(const ComponentPath& path) const
+{
+    const PathIndex* index = getPathIndex();
+    std::string absolutePath;
+    if (!index || !formAbsolutePathString(path, absolutePath)) {
+        return nullptr;
+    }
+    const auto it = index->components.find(absolutePath);
+    if (it == index->components.end()) {
+        return nullptr;
+    }
+    // A component, or one of its ancestors, renamed since it was indexed must
+    // be searched for.
+    if (it->second->getAbsolutePathString() != absolutePath) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+bool Component::findInNameIndex(const std::string& name,
+        std::vector<const Component*>& found) const
+{
+    const PathIndex* index = getPathIndex();
+    if (!index) {
+        return false;
+    }
+    const auto it = index->componentsByName.find(name);
+    if (it == index->componentsByName.end()) {
+        return true;
+    }
+    for (const Component* comp : it->second) {
+        if (comp->getName() != name) {
+            continue;
+        }
+        // Keep the components in the subtree of this Component.
+        const Component* up = comp;
+        while (up->hasOwner()) {
+            up = &up->getOwner();
+            if (up == this) {
+                found.push_back(comp);
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+namespace {
+// See Component::getComponentGeneration().
+std::atomic<unsigned long long> componentGeneration{0};
+}
+
+unsigned long long Component::getComponentGeneration()
+{
+    return componentGeneration.load();
+}
+
+void Component::incrementComponentGeneration()
+{
+    ++componentGeneration;
+}
+
+bool Component::isPathIndexCurrent() const
+{
+    return _pathIndex.hasComponents &&
+            _pathIndex.componentsGeneration == getComponentGeneration();
+}
+
+void Component::buildPathIndex() const
+{
+    // Read the generation first, so that Components constructed or destroyed
+    // while indexing make the index out of date.
+    const unsigned long long generation = getComponentGeneration();
+    _pathIndex.clear();
+    _pathIndex.components.emplace("/", this);
+    for (const auto& comp : getComponentList<Component>()) {
+        _pathIndex.components.emplace(comp.getAbsolutePathString(), &comp);
+        _pathIndex.componentsByName[comp.getName()].push_back(&comp);
+    }
+    _pathIndex.componentsGeneration = generation;
+    _pathIndex.hasComponents = true;
+}
+
+void Component::buildStateVariablePathIndex() const
+{
+    const unsigned long long generation = getComponentGeneration();
+    _pathIndex.stateVariables.clear();
+    auto addStateVariables = [this](const Component& comp,
+                                    const std::string& prefix) {
+        for (const auto& it : comp._namedStateVariableInfo) {
+            _pathIndex.stateVariables.emplace(prefix + it.first,
+                    it.second.stateVariable.get());
+        }
+    };
+    addStateVariables(*this, "/");
+    for (const auto& comp : getComponentList<Component>()) {
+        addStateVariables(comp, comp.getAbsolutePathString() + "/");
+    }
+    _pathIndex.stateVariablesGeneration = generation;
+    _pathIndex.hasStateVariables = true;
+}
+
+void Component::clearPathIndex() const
+{
+    getRoot()._pathIndex.clear();
+}
+
+const Component::PathIndex* Component::getPathIndex() const
+{
+    const Component& root = getRoot();
+    if (!root.isPathIndexCurrent() ||
+            !root.isObjectUpToDateWithProperties()) {
+        return nullptr;
+    }
+    return &root._pathIndex;
+}
+
+bool Component::formAbsolutePathString(const ComponentPath& path,
+        std::string& absolutePath) const
+{
+    const size_t numLevels = path.getNumPathLevels();
+    size_t level = 0;
+    absolutePath.clear();
+    if (!path.isAbsolute()) {
+        const Component* start = this;
+        for (; level < numLevels &&
+                path.getSubcomponentNameAtLevel(level) == ".."; ++level) {
+            if (!start->hasOwner()) {
+                return false;
+            }
+            start = &start->getOwner();
+        }
+        if (start->hasOwner()) {
+            absolutePath = start->getAbsolutePathString();
+        }
+    }
+    for (; level < numLevels; ++level) {
+        absolutePath += '/';
+        absolutePath += path.getSubcomponentNameAtLevel(level);
+    }
+    if (absolutePath.empty()) {
+        absolutePath = "/";
+    }
+    return true;
+}
+
 // Get the names of "continuous" state variables maintained by the Component and
 // its subcomponents.
 Array<std::string> Component::getStateVariableNames() const
@@ -1284,6 +1468,7 @@ void Component::adoptSubcomponent(Component* subcomponent)
 
     subcomponent->setOwner(*this);
     _adoptedSubcomponents.push_back(SimTK::ClonePtr<Component>(subcomponent));
+    clearPathIndex();
 }
 
 std::vector<SimTK::ReferencePtr<const Component>> 
@@ -1828,6 +2013,7 @@ void Component::reset()
     _system.reset();
     _simTKcomponentIndex.invalidate();
     clearStateAllocations();
+    clearPathIndex();
 
     _propertySubcomponents.clear();
     _adoptedSubcomponents.clear();
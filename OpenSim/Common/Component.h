@@ -2462,9 +2462,11 @@ public:
     name is known. For example, "forearm/elbow/elbow_flexion" will find
     the Coordinate component of the elbow joint that connects the forearm body
     in linear time (linear search for name at each component level). Whereas
-    supplying "elbow_flexion" requires a tree search. Returns nullptr (None in
-    Python, empty array in Matlab) if Component of that specified name cannot
-    be found.
+    supplying "elbow_flexion" requires a tree search. Once the root component
+    has finalized its connections (e.g., in Model::initSystem()), names and
+    paths are looked up in an index kept by the root instead. Returns nullptr
+    (None in Python, empty array in Matlab) if Component of that specified
+    name cannot be found.
 
     NOTE: If the component name is ambiguous, an exception is thrown. To
     disambiguate, more information must be provided, such as the template
@@ -2497,6 +2499,31 @@ public:
                 foundCs.push_back(found);
         }
 
+        // Use the root's index of the component names, if it is up to date
+        // and has the name (a component may have been renamed since it was
+        // indexed).
+        std::vector<const Component*> namedComps;
+        if (findInNameIndex(subname, namedComps) && !namedComps.empty()) {
+            for (const Component* namedComp : namedComps) {
+                const C* comp = dynamic_cast<const C*>(namedComp);
+                if (!comp) continue;
+                foundCs.push_back(comp);
+                // As below, a child of this Component is an exact match.
+                if (&comp->getOwner() == this) break;
+                log_debug("{} Found '{}' as a match for: Component '{}' of "
+                          "type {}, but it is not on the specified path.",
+                          msg, comp->getAbsolutePathString(),
+                          comp->getConcreteClassName());
+            }
+            if (foundCs.size() == 1) return foundCs[0];
+            if (foundCs.size() > 1) {
+                msg += "Found multiple '" + name + "'s of type " +
+                    foundCs[0]->getConcreteClassName() + ".";
+                throw Exception(msg, __FILE__, __LINE__);
+            }
+            return nullptr;
+        }
+
         ComponentList<const C> compsList = this->template getComponentList<C>();
 
         for (const C& comp : compsList) {
@@ -2559,6 +2586,10 @@ protected:
         // Get rid of all the ".."'s that are not at the front of the path.
         path.trimDotAndDotDotElements();
 
+        // Use the root's index of the component paths, if it is up to date.
+        if (const Component* indexed = findInPathIndex(path))
+            return dynamic_cast<const C*>(indexed);
+
         // Move up either to the root component or just enough to resolve all
         // the ".."'s.
         size_t iPathEltStart = 0u;
@@ -2597,6 +2628,21 @@ protected:
         return nullptr;
     }
 
+    /** Look up a component by path in the index kept by the root component
+    (see finalizeConnections()). The path is relative to this component unless
+    it is absolute, and may only have ".." elements at its start. This returns
+    nullptr if the index is not up to date or does not contain the path; the
+    caller must then search the tree. */
+    const Component* findInPathIndex(const ComponentPath& path) const;
+
+    /** Append to `found` the components named `name` in the subtree of this
+    component (excluding this component), in the order of
+    getComponentList(), using the index kept by the root component.
+    Components renamed since they were indexed are not found. This returns
+    false, without modifying `found`, if the index is not up to date. */
+    bool findInNameIndex(const std::string& name,
+            std::vector<const Component*>& found) const;
+
 public:
 #ifndef SWIG // StateVariable is protected.
     /**
@@ -3194,6 +3240,75 @@ private:
     // cache information.
     mutable SimTK::ResetOnCopy<std::unordered_map<std::string, StoredCacheVariable>> _namedCacheVariables;
 
+    // The number of Components constructed (including by copy or
+    // assignment) and destroyed so far in the process. Editing a
+    // subcomponent through its properties (e.g., removing a PathPoint from
+    // its Set) does not mark the root as out of date, so the index below
+    // records this count when it is built and is not used once the count has
+    // changed: it then cannot hold a pointer to a deleted Component or miss
+    // a new one.
+    static unsigned long long getComponentGeneration();
+    static void incrementComponentGeneration();
+    struct ComponentGenerationCounter {
+        ComponentGenerationCounter() { incrementComponentGeneration(); }
+        ComponentGenerationCounter(const ComponentGenerationCounter&)
+        {   incrementComponentGeneration(); }
+        ComponentGenerationCounter& operator=(
+                const ComponentGenerationCounter&) {
+            incrementComponentGeneration();
+            return *this;
+        }
+        ~ComponentGenerationCounter() { incrementComponentGeneration(); }
+    };
+    ComponentGenerationCounter _componentGenerationCounter;
+
+    // Index of the components and state variables in the tree rooted at this
+    // Component, by absolute path, so that they can be looked up without
+    // searching the tree. Only the index of the root Component is used. The
+    // components are indexed by finalizeConnections() and addToSystem(), and
+    // the state variables by addToSystem(); the index is cleared by reset()
+    // (and so by finalizeFromProperties()) anywhere in the tree and when a
+    // subcomponent is added, and it is not used once a Component has been
+    // constructed or destroyed since it was built. Lookups that are not in
+    // the index (e.g., after renaming a component) fall back to searching
+    // the tree.
+    struct PathIndex {
+        std::unordered_map<std::string, const Component*> components;
+        std::unordered_map<std::string, std::vector<const Component*>>
+                componentsByName;
+        std::unordered_map<std::string, const StateVariable*> stateVariables;
+        bool hasComponents = false;
+        bool hasStateVariables = false;
+        // The component generation when each part was built.
+        unsigned long long componentsGeneration = 0;
+        unsigned long long stateVariablesGeneration = 0;
+        void clear() {
+            components.clear();
+            componentsByName.clear();
+            stateVariables.clear();
+            hasComponents = false;
+            hasStateVariables = false;
+        }
+    };
+    mutable SimTK::ResetOnCopy<PathIndex> _pathIndex;
+
+    // Build the index of the component paths (root only).
+    void buildPathIndex() const;
+    // Whether the index of the component paths of this Component (the root)
+    // has been built since a Component was last constructed or destroyed.
+    bool isPathIndexCurrent() const;
+    // Build the index of the state variable paths (root only).
+    void buildStateVariablePathIndex() const;
+    // Clear the index of the root of this Component.
+    void clearPathIndex() const;
+    // The index of the root of this Component, or nullptr if it is not up to
+    // date.
+    const PathIndex* getPathIndex() const;
+    // Form the absolute path of `path`, which is relative to this Component
+    // unless it is absolute. Return false if the path leads above the root.
+    bool formAbsolutePathString(const ComponentPath& path,
+            std::string& absolutePath) const;
+
     // Check that the list of _allStateVariables is valid
     bool isAllStatesVariablesListValid() const;
 
@@ -34,6 +34,7 @@ in-memory container for data access and manipulation.                         */
 #include "SimTKcommon/internal/Quaternion.h"
 #include <OpenSim/Common/IO.h>
 
+#include <algorithm>
 #include <iomanip>
 #include <numeric>
 
@@ -74,12 +75,46 @@ public:
     typedef SimTK::MatrixView_<ETY>    MatrixView;
 
     DataTable_()                             = default;
-    DataTable_(const DataTable_&)            = default;
-    DataTable_(DataTable_&&)                 = default;
-    DataTable_& operator=(const DataTable_&) = default;
-    DataTable_& operator=(DataTable_&&)      = default;
     ~DataTable_()                            = default;
 
+    // The dependent data may have spare rows for appending, so copies take
+    // only the rows in use, and moved-from tables are left empty.
+    DataTable_(const DataTable_& that) :
+        AbstractDataTable(that),
+        _indData(that._indData),
+        _depData(that.getDependentRowsInUse()) {}
+
+    DataTable_(DataTable_&& that) :
+        AbstractDataTable(std::move(that)),
+        _indData(std::move(that._indData)),
+        _depData(std::move(that._depData)),
+        _numSpareRows(that._numSpareRows) {
+        that._depData.resize(0, 0);
+        that._numSpareRows = 0;
+    }
+
+    DataTable_& operator=(const DataTable_& that) {
+        if(this != &that) {
+            AbstractDataTable::operator=(that);
+            _indData = that._indData;
+            _depData = that.getDependentRowsInUse();
+            _numSpareRows = 0;
+        }
+        return *this;
+    }
+
+    DataTable_& operator=(DataTable_&& that) {
+        if(this != &that) {
+            AbstractDataTable::operator=(std::move(that));
+            _indData = std::move(that._indData);
+            _depData = std::move(that._depData);
+            _numSpareRows = that._numSpareRows;
+            that._depData.resize(0, 0);
+            that._numSpareRows = 0;
+        }
+        return *this;
+    }
+
     std::shared_ptr<AbstractDataTable> clone() const override {
         return std::shared_ptr<AbstractDataTable>{new DataTable_{*this}};
     }
@@ -662,15 +697,106 @@ public:
                              static_cast<size_t>(depRow.ncol()));
         }
 
+        const int numRows = getNumDependentRows();
+        OPENSIM_THROW_IF(numRows != 0 && depRow.ncol() != _depData.ncol(),
+                         IncorrectNumColumns,
+                         static_cast<size_t>(_depData.ncol()),
+                         static_cast<size_t>(depRow.ncol()));
+
+        growDependentData(numRows + 1, depRow.ncol());
+        _depData.updRow(numRows) = depRow;
         _indData.push_back(indRow);
+    }
+
+    /** Append multiple rows to the DataTable_ at once. Row `r` of `depData`
+    is appended with entry `indCol[r]` in the independent column. The matrix
+    is grown only once, which is much cheaper than calling appendRow() for
+    each row.
+
+    \throws InvalidArgument If the length of indCol does not match the number
+                            of rows of depData.
+    \throws IncorrectNumColumns If the rows added are invalid.
+    \throws InvalidRow If any of the rows is invalid. Validity of the rows
+                       added is decided by the derived class. If a row is
+                       invalid, none of the rows are appended.               */
+    void appendRows(const std::vector<ETX>& indCol,
+                    const MatrixView& depData) {
+        OPENSIM_THROW_IF(static_cast<int>(indCol.size()) != depData.nrow(),
+                         InvalidArgument,
+                         "Length of independent column does not match number "
+                         "of rows of dependent data.");
+        if(indCol.empty())
+            return;
+
+        size_t numCols = getNumDependentRows() == 0 ? depData.ncol() 
+                                                    : _depData.ncol();
+        if(_dependentsMetaData.hasKey("labels"))
+            numCols = _dependentsMetaData.getValueArrayForKey("labels").size();
+        OPENSIM_THROW_IF(static_cast<size_t>(depData.ncol()) != numCols,
+                         IncorrectNumColumns,
+                         numCols, static_cast<size_t>(depData.ncol()));
+
+        // Validate each row against the rows before it, and roll back the
+        // independent column if any row is rejected.
+        const size_t numRows = _indData.size();
+        try {
+            for(int r = 0; r < depData.nrow(); ++r) {
+                validateRow(_indData.size(), indCol[r], depData.row(r));
+                _indData.push_back(indCol[r]);
+            }
+        } catch(...) {
+            _indData.resize(numRows);
+            throw;
+        }
 
-        if(_depData.nrow() == 0) {
-            _depData.resize(1, depRow.size());
+        growDependentData(static_cast<int>(_indData.size()),
+                          depData.ncol());
+        _depData.updBlock(static_cast<int>(numRows), 0,
+                          depData.nrow(), depData.ncol()) = depData;
+    }
+
+    /** Append multiple rows to the DataTable_ at once. See
+    appendRows(const std::vector<ETX>&, const MatrixView&).                   */
+    void appendRows(const std::vector<ETX>& indCol,
+                    const Matrix& depData) {
+        appendRows(indCol, depData.getAsMatrixView());
+    }
+
+    /** Append multiple rows to the DataTable_ from a range of rows. Each
+    element of the range must be a row accepted by appendRow().               */
+    template<typename IndIter, typename RowIter>
+    void appendRows(IndIter indBegin, IndIter indEnd, RowIter rowBegin) {
+        reserve(getNumRows() + std::distance(indBegin, indEnd));
+        for(auto it = indBegin; it != indEnd; ++it, ++rowBegin)
+            appendRow(*it, *rowBegin);
+    }
+
+    /** Reserve storage so that the table can hold at least `numRows` rows
+    without reallocating while rows are appended one at a time. Without a
+    reservation, the storage grows geometrically, so building a table row by
+    row already takes time linear in the number of rows; reserving avoids the
+    intermediate reallocations.
+
+    The spare rows are released (with one copy of the matrix) the next time
+    the matrix, a block or a column of it is accessed, or a column or row is
+    removed, so that the matrix is always seen stored contiguously. Rows can
+    be read and updated with getRowAtIndex() and updRowAtIndex() while
+    appending without releasing the spare rows. Because getMatrix() and the
+    other const accessors may release them, call shrinkToFit() before
+    sharing a table that has been appended to between threads.               */
+    void reserve(size_t numRows) {
+        _indData.reserve(numRows);
+        if(static_cast<int>(numRows) > _depData.nrow()) {
+            const int numRowsInUse = getNumDependentRows();
+            _depData.resizeKeep(static_cast<int>(numRows), _depData.ncol());
+            _numSpareRows = static_cast<int>(numRows) - numRowsInUse;
         }
-        else 
-            _depData.resizeKeep(_depData.nrow() + 1, _depData.ncol());
-            
-        _depData.updRow(_depData.nrow() - 1) = depRow;
+    }
+
+    /** Release any storage reserved for appending rows that is not in use. */
+    void shrinkToFit() {
+        releaseSpareRows();
+        _indData.shrink_to_fit();
     }
 
     /** Get row at index.                                                     
@@ -785,6 +911,7 @@ public:
                          RowIndexOutOfRange, 
                          index, 0, static_cast<unsigned>(_indData.size() - 1));
 
+        releaseSpareRows();
         if(index < getNumRows() - 1)
             for(size_t r = index; r < getNumRows() - 1; ++r)
                 _depData.updRow((int)r) = _depData.row((int)(r + 1));
@@ -943,6 +1070,7 @@ public:
                          static_cast<size_t>(getNumRows()),
                          static_cast<size_t>(depCol.nrow()));
         
+        releaseSpareRows();
         _depData.resizeKeep(_depData.nrow(), _depData.ncol() + 1);
         _depData.updCol(_depData.ncol() - 1) = depCol;
         appendColumnLabel(columnLabel);
@@ -956,6 +1084,8 @@ public:
             ColumnIndexOutOfRange,
             index, 0, static_cast<unsigned>(_depData.ncol() - 1));
 
+        releaseSpareRows();
+
         // get copy of labels
         auto labels = getColumnLabels();
 
@@ -998,6 +1128,7 @@ public:
                          ColumnIndexOutOfRange, index, 0,
                          static_cast<size_t>(_depData.ncol() - 1));
 
+        releaseSpareRows();
         return _depData.col(static_cast<int>(index));
     }
 
@@ -1006,6 +1137,7 @@ public:
     \throws KeyNotFound If columnLabel is not found to be label of any existing
                         column.                                               */
     VectorView getDependentColumn(const std::string& columnLabel) const {
+        releaseSpareRows();
         return _depData.col(static_cast<int>(getColumnIndex(columnLabel)));
     }
 
@@ -1020,6 +1152,7 @@ public:
                          ColumnIndexOutOfRange, index, 0,
                          static_cast<size_t>(_depData.ncol() - 1));
 
+        releaseSpareRows();
         return _depData.updCol(static_cast<int>(index));
     }
 
@@ -1028,6 +1161,7 @@ public:
     \throws KeyNotFound If columnLabel is not found to be label of any existing
                         column.                                               */
     VectorView updDependentColumn(const std::string& columnLabel) {
+        releaseSpareRows();
         return _depData.updCol(static_cast<int>(getColumnIndex(columnLabel)));
     }
 
@@ -1057,6 +1191,7 @@ public:
 
     /** Get a read-only view to the underlying matrix.                        */
     const MatrixView& getMatrix() const {
+        releaseSpareRows();
         return _depData.getAsMatrixView();
     }
 
@@ -1076,6 +1211,7 @@ public:
                          InvalidArgument,
                          "Either numRows or numColumns is zero.");
         OPENSIM_THROW_IF(isEmpty(), EmptyTable);
+        releaseSpareRows();
         OPENSIM_THROW_IF(isRowIndexOutOfRange(rowStart),
                          RowIndexOutOfRange,
                          rowStart, 0, 
@@ -1101,6 +1237,7 @@ public:
 
     /** Get a writable view to the underlying matrix.                         */
     MatrixView& updMatrix() {
+        releaseSpareRows();
         return _depData.updAsMatrixView();
     }
 
@@ -1120,6 +1257,7 @@ public:
                          InvalidArgument,
                          "Either numRows or numColumns is zero.");
         OPENSIM_THROW_IF(isEmpty(), EmptyTable);
+        releaseSpareRows();
         OPENSIM_THROW_IF(isRowIndexOutOfRange(rowStart),
                          RowIndexOutOfRange,
                          rowStart, 0, 
@@ -1557,7 +1695,7 @@ protected:
 
     /** Get number of rows.                                                   */
     size_t implementGetNumRows() const override {
-        return _depData.nrow();
+        return static_cast<size_t>(getNumDependentRows());
     }
 
     /** Get number of columns.                                                */
@@ -1661,8 +1799,45 @@ protected:
         return M * N;
     }
 
-    std::vector<ETX>    _indData;
-    SimTK::Matrix_<ETY> _depData;
+    /** Number of rows of the dependent data in use, not counting the spare
+    rows.                                                                     */
+    int getNumDependentRows() const {
+        return _depData.nrow() - _numSpareRows;
+    }
+
+    /** The rows of the dependent data in use.                               */
+    MatrixView getDependentRowsInUse() const {
+        return _depData.block(0, 0, getNumDependentRows(), _depData.ncol());
+    }
+
+    /** Make room for `numRows` rows (at least the number in use) and
+    `numColumns` columns, keeping the existing elements. The storage grows
+    geometrically, so appending rows one at a time copies each row only a
+    constant number of times on average.                                      */
+    void growDependentData(int numRows, int numColumns) {
+        int capacity = _depData.nrow();
+        if(numRows > capacity)
+            capacity = std::max(numRows, 2 * capacity);
+        if(capacity != _depData.nrow() || numColumns != _depData.ncol())
+            _depData.resizeKeep(capacity, numColumns);
+        _numSpareRows = capacity - numRows;
+    }
+
+    /** Release the spare rows, so that _depData holds exactly the rows in use
+    and is stored contiguously.                                               */
+    void releaseSpareRows() const {
+        if(_numSpareRows != 0) {
+            _depData.resizeKeep(getNumDependentRows(), _depData.ncol());
+            _numSpareRows = 0;
+        }
+    }
+
+    std::vector<ETX>            _indData;
+    // The dependent data. After rows are appended, it may have spare rows at
+    // the end, which are released before the matrix is exposed.
+    mutable SimTK::Matrix_<ETY> _depData;
+    // The number of spare rows at the end of _depData.
+    mutable int                 _numSpareRows{0};
 };  // DataTable_
 
 
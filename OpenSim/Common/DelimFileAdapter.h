@@ -124,10 +124,11 @@ protected:
     void extendWrite(const InputTables& tables,
                      const std::string& filename) const override;
 
-    /** Read elements of type T (template parameter) from a sequence of 
-    tokens.                                                                   */
-    inline SimTK::RowVector_<T> 
-    readElems(const std::vector<std::string>& tokens) const;
+    /** Read an element of type T (template parameter) from a token. `comps`
+    is scratch space for splitting the token into components.                 */
+    inline void readElem(const TextRange& token,
+                         std::vector<TextRange>& comps,
+                         T& elem) const;
 
     /** Write an element of type T (template parameter) to stream with the
     specified precision.                                                      */
@@ -144,23 +145,29 @@ private:
     template<int M>
     static inline std::string dataTypeName_impl(SimTK::Vec<M>);
 
-    /** Following overloads implement readElems().                            */
-    inline SimTK::RowVector_<double>
-    readElems_impl(const std::vector<std::string>& tokens,
-                   double) const;
-    inline SimTK::RowVector_<SimTK::UnitVec3>
-    readElems_impl(const std::vector<std::string>& tokens,
-                   SimTK::UnitVec3) const;
-    inline SimTK::RowVector_<SimTK::Quaternion>
-    readElems_impl(const std::vector<std::string>& tokens,
-                   SimTK::Quaternion) const;
-    inline SimTK::RowVector_<SimTK::SpatialVec>
-    readElems_impl(const std::vector<std::string>& tokens,
-                   SimTK::SpatialVec) const;
+    /** Following overloads implement readElem().                             */
+    inline void readElem_impl(const TextRange& token,
+                              std::vector<TextRange>& comps,
+                              double& elem) const;
+    inline void readElem_impl(const TextRange& token,
+                              std::vector<TextRange>& comps,
+                              SimTK::UnitVec3& elem) const;
+    inline void readElem_impl(const TextRange& token,
+                              std::vector<TextRange>& comps,
+                              SimTK::Quaternion& elem) const;
+    inline void readElem_impl(const TextRange& token,
+                              std::vector<TextRange>& comps,
+                              SimTK::SpatialVec& elem) const;
     template<int M>
-    inline SimTK::RowVector_<SimTK::Vec<M>>
-    readElems_impl(const std::vector<std::string>& tokens,
-                   SimTK::Vec<M>) const;
+    inline void readElem_impl(const TextRange& token,
+                              std::vector<TextRange>& comps,
+                              SimTK::Vec<M>& elem) const;
+
+    /** Split a token into exactly N components using the component
+    delimiters.                                                               */
+    inline void readComps(const TextRange& token,
+                          std::vector<TextRange>& comps,
+                          size_t numComps) const;
 
     /** Following overloads implement writeElem().                            */
     inline void writeElem_impl(std::ostream& stream,
@@ -401,56 +408,44 @@ DelimFileAdapter<T>::extendRead(const std::string& fileName) const {
                      column_labels[0]);
     column_labels.erase(column_labels.begin());
 
-    // Read the rows one at a time and fill up the time column container and
-    // the data container. Start with a reasonable initial capacity for
-    // tradeoff between a small file and larger files. 100 worked well for
-    // a 50 MB file with ~80000 lines.
-    std::vector<double> timeVec;
-    int initCapacity = 100;
-    int ncol = static_cast<int>(column_labels.size());
-    timeVec.reserve(initCapacity);
-    SimTK::Matrix_<T> matrix(initCapacity, ncol);
-    
-    // Initialize current row and capacity
-    int curCapacity = initCapacity;
-    int curRow = 0;
-
-    // Start looping through each line
-    auto row = nextLine();
-    while (!row.empty()) {
+    // Read the rest of the file with a single read and parse the rows in
+    // place. An empty line denotes the end of the data. Counting the rows
+    // first allows the time column and the matrix to be allocated once, at
+    // their final size.
+    const std::string data = readRemaining(in_stream);
+    const char* const dataEnd = data.data() + data.size();
+    TextRange line{};
+    int nrow = 0;
+    for(const char* pos = data.data();
+            getNextLine(pos, dataEnd, line) && !line.empty(); )
+        ++nrow;
+
+    const int ncol = static_cast<int>(column_labels.size());
+    std::vector<double> timeVec(nrow);
+    SimTK::Matrix_<T> matrix(nrow, ncol);
+
+    std::vector<TextRange> row{};
+    std::vector<TextRange> comps{};
+    const char* pos = data.data();
+    for(int curRow = 0; curRow < nrow; ++curRow) {
+        getNextLine(pos, dataEnd, line);
         ++line_num;
-        
-        // Double capacity if we reach the end of the containers.
-        // This is necessary until Simbody issue #401 is addressed.
-        if (curRow+1 > curCapacity) {
-            curCapacity *= 2;
-            timeVec.reserve(curCapacity);
-            matrix.resizeKeep(curCapacity, ncol);
-        }
+        tokenize(line, _delimitersRead, row);
 
         // Time is column 0.
-        timeVec.push_back(std::stod(row.front()));
-        row.erase(row.begin());
-
-        auto row_vector = readElems(row);
+        timeVec[curRow] = parseDouble(row.front());
 
-        OPENSIM_THROW_IF(row_vector.size() != (int)column_labels.size(),
+        OPENSIM_THROW_IF(row.size() - 1 != column_labels.size(),
             RowLengthMismatch,
             fileName,
             line_num,
             column_labels.size(),
-            static_cast<size_t>(row_vector.size()));
-        
-        matrix.updRow(curRow) = std::move(row_vector);
+            row.size() - 1);
 
-        row = nextLine();
-        ++curRow;
+        for(int col = 0; col < ncol; ++col)
+            readElem(row[col + 1], comps, matrix.updElt(curRow, col));
     }
 
-    // Resize the matrix down to the correct number of rows.
-    // This is necessary until Simbody issue #401 is addressed.
-    matrix.resizeKeep(curRow, ncol);
-
     // Create the table and update other metadata from above
     auto table = 
         std::make_shared<TimeSeriesTable_<T>>(timeVec, matrix, column_labels);
@@ -463,99 +458,80 @@ DelimFileAdapter<T>::extendRead(const std::string& fileName) const {
 }
 
 template<typename T>
-SimTK::RowVector_<T>
-DelimFileAdapter<T>::readElems(const std::vector<std::string>& tokens) const {
-    return readElems_impl(tokens, T{});
+void
+DelimFileAdapter<T>::readElem(const TextRange& token,
+                              std::vector<TextRange>& comps,
+                              T& elem) const {
+    readElem_impl(token, comps, elem);
 }
 
 template<typename T>
-SimTK::RowVector_<double>
-DelimFileAdapter<T>::readElems_impl(const std::vector<std::string>& tokens,
-                                    double) const {
-    SimTK::RowVector_<double> elems{static_cast<int>(tokens.size())};
-    for(auto i = 0u; i < tokens.size(); ++i)
-        elems[static_cast<int>(i)] = std::stod(tokens[i]);
-
-    return elems;
+void
+DelimFileAdapter<T>::readComps(const TextRange& token,
+                               std::vector<TextRange>& comps,
+                               size_t numComps) const {
+    tokenize(token, _compDelimRead, comps);
+    OPENSIM_THROW_IF(comps.size() != numComps,
+                     IncorrectNumTokens,
+                     "Expected " + std::to_string(numComps) +
+                     "x (multiple of " + std::to_string(numComps) +
+                     ") number of tokens.");
 }
 
 template<typename T>
-SimTK::RowVector_<SimTK::UnitVec3>
-DelimFileAdapter<T>::readElems_impl(const std::vector<std::string>& tokens,
-                                    SimTK::UnitVec3) const {
-    SimTK::RowVector_<SimTK::UnitVec3> elems{static_cast<int>(tokens.size())};
-    for(auto i = 0u; i < tokens.size(); ++i) {
-        auto comps = tokenize(tokens[i], _compDelimRead);
-        OPENSIM_THROW_IF(comps.size() != 3, 
-                         IncorrectNumTokens,
-                         "Expected 3x (multiple of 3) number of tokens.");
-        elems[i] = SimTK::UnitVec3{std::stod(comps[0]),
-                                   std::stod(comps[1]),
-                                   std::stod(comps[2])};
-    }
-
-    return elems;
+void
+DelimFileAdapter<T>::readElem_impl(const TextRange& token,
+                                   std::vector<TextRange>&,
+                                   double& elem) const {
+    elem = parseDouble(token);
 }
 
 template<typename T>
-SimTK::RowVector_<SimTK::Quaternion>
-DelimFileAdapter<T>::readElems_impl(const std::vector<std::string>& tokens,
-                                    SimTK::Quaternion) const {
-    SimTK::RowVector_<SimTK::Quaternion> elems{static_cast<int>(tokens.size())};
-    for(auto i = 0u; i < tokens.size(); ++i) {
-        auto comps = tokenize(tokens[i], _compDelimRead);
-        OPENSIM_THROW_IF(comps.size() != 4, 
-                         IncorrectNumTokens,
-                         "Expected 4x (multiple of 4) number of tokens.");
-        elems[i] = SimTK::Quaternion{std::stod(comps[0]),
-                                     std::stod(comps[1]),
-                                     std::stod(comps[2]),
-                                     std::stod(comps[3])};
-    }
-
-    return elems;
+void
+DelimFileAdapter<T>::readElem_impl(const TextRange& token,
+                                   std::vector<TextRange>& comps,
+                                   SimTK::UnitVec3& elem) const {
+    readComps(token, comps, 3);
+    elem = SimTK::UnitVec3{parseDouble(comps[0]),
+                           parseDouble(comps[1]),
+                           parseDouble(comps[2])};
 }
 
 template<typename T>
-SimTK::RowVector_<SimTK::SpatialVec>
-DelimFileAdapter<T>::readElems_impl(const std::vector<std::string>& tokens,
-                                    SimTK::SpatialVec) const {
-    SimTK::RowVector_<SimTK::SpatialVec> elems{static_cast<int>(tokens.size())};
-    for(auto i = 0u; i < tokens.size(); ++i) {
-        auto comps = tokenize(tokens[i], _compDelimRead);
-        OPENSIM_THROW_IF(comps.size() != 6, 
-                         IncorrectNumTokens,
-                         "Expected 6x (multiple of 6) number of tokens.");
-        elems[i] = SimTK::SpatialVec{{std::stod(comps[0]),
-                                      std::stod(comps[1]),
-                                      std::stod(comps[2])},
-                                     {std::stod(comps[3]),
-                                      std::stod(comps[4]),
-                                      std::stod(comps[5])}};
-    }
+void
+DelimFileAdapter<T>::readElem_impl(const TextRange& token,
+                                   std::vector<TextRange>& comps,
+                                   SimTK::Quaternion& elem) const {
+    readComps(token, comps, 4);
+    elem = SimTK::Quaternion{parseDouble(comps[0]),
+                             parseDouble(comps[1]),
+                             parseDouble(comps[2]),
+                             parseDouble(comps[3])};
+}
 
-    return elems;
+template<typename T>
+void
+DelimFileAdapter<T>::readElem_impl(const TextRange& token,
+                                   std::vector<TextRange>& comps,
+                                   SimTK::SpatialVec& elem) const {
+    readComps(token, comps, 6);
+    elem = SimTK::SpatialVec{{parseDouble(comps[0]),
+                              parseDouble(comps[1]),
+                              parseDouble(comps[2])},
+                             {parseDouble(comps[3]),
+                              parseDouble(comps[4]),
+                              parseDouble(comps[5])}};
 }
 
 template<typename T>
 template<int M>
-SimTK::RowVector_<SimTK::Vec<M>>
-DelimFileAdapter<T>::readElems_impl(const std::vector<std::string>& tokens,
-                                    SimTK::Vec<M>) const {
-    SimTK::RowVector_<SimTK::Vec<M>> elems{static_cast<int>(tokens.size())};
-    for(auto i = 0u; i < tokens.size(); ++i) {
-        auto comps = tokenize(tokens[i], _compDelimRead);
-        OPENSIM_THROW_IF(comps.size() != M, 
-                         IncorrectNumTokens,
-                         "Expected " + std::to_string(M) +
-                         "x (multiple of " + std::to_string(M) +
-                         ") number of tokens.");
-        for(int j = 0; j < M; ++j) {
-            elems[i][j] = std::stod(comps[j]);
-        }
-    }
-
-    return elems;
+void
+DelimFileAdapter<T>::readElem_impl(const TextRange& token,
+                                   std::vector<TextRange>& comps,
+                                   SimTK::Vec<M>& elem) const {
+    readComps(token, comps, M);
+    for(int j = 0; j < M; ++j)
+        elem[j] = parseDouble(comps[j]);
 }
   
 template<typename T>
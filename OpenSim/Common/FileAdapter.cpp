@@ -2,6 +2,12 @@
 #include <OpenSim/Common/IO.h>
 #include "STOFileAdapter.h"
 
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <stdexcept>
+
 namespace OpenSim {
 
 std::shared_ptr<DataAdapter>
@@ -80,6 +86,97 @@ FileAdapter::getNextLine(std::istream& stream,
     return {};
 }
 
+std::string
+FileAdapter::readRemaining(std::istream& stream) {
+    std::string buffer{};
+    const auto start = stream.tellg();
+    if(start != std::istream::pos_type(-1)) {
+        stream.seekg(0, std::ios::end);
+        const auto stop = stream.tellg();
+        stream.seekg(start);
+        if(stop != std::istream::pos_type(-1) && stop > start) {
+            buffer.resize(static_cast<std::size_t>(stop - start));
+            stream.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+            // Fewer characters may be read than expected if the stream
+            // translates line endings.
+            buffer.resize(static_cast<std::size_t>(stream.gcount()));
+            return buffer;
+        }
+    }
+    // The stream is not seekable; fall back to reading it in blocks.
+    char block[1 << 16];
+    while(stream.read(block, sizeof(block)) || stream.gcount() > 0)
+        buffer.append(block, static_cast<std::size_t>(stream.gcount()));
+    return buffer;
+}
+
+bool
+FileAdapter::getNextLine(const char*& pos, const char* end, TextRange& line) {
+    if(pos >= end)
+        return false;
+
+    const char* eol = static_cast<const char*>(
+            std::memchr(pos, '\n', static_cast<std::size_t>(end - pos)));
+    if(eol == nullptr)
+        eol = end;
+    line.begin = pos;
+    line.end = eol;
+    // Get rid of the extra \r if parsing a file with CRLF line endings.
+    if(line.end > line.begin && *(line.end - 1) == '\r')
+        --line.end;
+    pos = eol < end ? eol + 1 : end;
+    return true;
+}
+
+void
+FileAdapter::tokenize(const TextRange& str,
+                      const std::string& delims,
+                      std::vector<TextRange>& tokens) {
+    // Same characters as removed by IO::TrimWhitespace().
+    auto isWhitespace = [](char c) {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    };
+    auto trimmed = [&](const char* begin, const char* end) {
+        while(begin < end && isWhitespace(*begin))
+            ++begin;
+        while(end > begin && isWhitespace(*(end - 1)))
+            --end;
+        return TextRange{begin, end};
+    };
+
+    tokens.clear();
+    const char* token_start = str.begin;
+    for(const char* c = str.begin; c < str.end; ++c) {
+        if(delims.find(*c) != std::string::npos) {
+            tokens.push_back(trimmed(token_start, c));
+            token_start = c + 1;
+        }
+    }
+    // Capture from the last delimiter to the end of the string if not empty.
+    if(str.end > token_start)
+        tokens.push_back(trimmed(token_start, str.end));
+}
+
+double
+FileAdapter::parseDouble(const TextRange& token) {
+    if(token.empty())
+        throw std::invalid_argument{"stod"};
+
+    // strtod() stops at the first character that cannot be part of a
+    // number, which is normally the delimiter following the token.
+    char* stop{};
+    errno = 0;
+    const double value = std::strtod(token.begin, &stop);
+    if(stop > token.end)
+        // The token is followed by characters that continue the number.
+        return std::stod(token.str());
+    if(stop == token.begin)
+        throw std::invalid_argument{"stod"};
+    if(errno == ERANGE)
+        throw std::out_of_range{"stod"};
+    return value;
+}
+
 std::shared_ptr<DataAdapter>
 FileAdapter::createAdapterFromExtension(const std::string& fileName) {
     auto extension = FileAdapter::findExtension(fileName);
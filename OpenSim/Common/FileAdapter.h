@@ -213,6 +213,41 @@ public:
     specifies that either a space or a tab can act as the delimiter.          */
     static std::vector<std::string> tokenize(const std::string& str, 
                                       const std::string& delims);
+
+#ifndef SWIG
+    /** A range [begin, end) of characters within a buffer. Used to split and
+    parse delimited text in place, without allocating a string for every
+    line and token.                                                           */
+    struct TextRange {
+        const char* begin;
+        const char* end;
+
+        bool empty() const { return begin == end; }
+        std::string str() const { return std::string(begin, end); }
+    };
+
+    /** Read everything that is left in the stream into memory with a single
+    read, rather than line by line.                                           */
+    static std::string readRemaining(std::istream& stream);
+
+    /** Get the next line from the characters in [pos, end) without its line
+    ending ("\n" or "\r\n") and advance pos past it. Returns false if there
+    are no characters left.                                                   */
+    static bool getNextLine(const char*& pos, const char* end,
+                            TextRange& line);
+
+    /** Same as tokenize() but operates in place on a range of characters.
+    The resulting tokens are written to `tokens`, which is cleared first so
+    that it can be reused from one line to the next.                          */
+    static void tokenize(const TextRange& str, const std::string& delims,
+                         std::vector<TextRange>& tokens);
+
+    /** Convert a token to a double exactly as std::stod() would, without
+    first copying it into a string. Throws std::invalid_argument if no
+    conversion can be performed and std::out_of_range if the value is out of
+    the range of a double.                                                    */
+    static double parseDouble(const TextRange& token);
+#endif
     /** Create a concerte FileAdapter based on the extension of the passed in file and return it.
      This serves as a Factory of FileAdapters so clients don't need to know specific concrete 
      subclasses, as long as the generic base class read interface is used */
@@ -29,6 +29,8 @@
 // INCLUDES
 #include "Function.h"
 
+#include <atomic>
+
 
 using namespace OpenSim;
 using namespace std;
@@ -38,6 +40,12 @@ using SimTK::Vector;
 //=============================================================================
 // STATICS
 //=============================================================================
+namespace {
+    // The last definition version given to a function.
+    std::atomic<unsigned long long> lastDefinitionVersion{0};
+    unsigned long long nextDefinitionVersion()
+    {   return ++lastDefinitionVersion; }
+}
 
 
 //=============================================================================
@@ -57,7 +65,8 @@ Function::~Function()
  * Default constructor.
  */
 Function::Function() :
-    _function(NULL)
+    _function(NULL),
+    _definitionVersion(nextDefinitionVersion())
 {
     setNull();
 }
@@ -69,7 +78,8 @@ Function::Function() :
  */
 Function::Function(const Function &aFunction) :
     Object(aFunction),
-    _function(NULL)
+    _function(NULL),
+    _definitionVersion(nextDefinitionVersion())
 {
 }
 
@@ -101,6 +111,7 @@ operator=(const Function &aFunction)
     // BASE CLASS
     Object::operator=(aFunction);
 
+    _definitionVersion = nextDefinitionVersion();
     return(*this);
 }
 
@@ -173,6 +184,18 @@ double Function::calcDerivative(const std::vector<int>& derivComponents, const V
     return _function->calcDerivative(derivComponents, x);
 }
 
+double Function::calcValue(double x) const
+{
+    return calcValue(Vector(1, x));
+}
+
+double Function::calcDerivative(double x, int order) const
+{
+    if (order == 0)
+        return calcValue(x);
+    return calcDerivative(std::vector<int>(order, 0), Vector(1, x));
+}
+
 int Function::getArgumentSize() const
 {
     if (_function == NULL)
@@ -192,4 +215,5 @@ void Function::resetFunction()
     if (_function != NULL)
         delete _function;
     _function = NULL;
+    _definitionVersion = nextDefinitionVersion();
 }
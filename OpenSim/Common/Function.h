@@ -114,6 +114,21 @@ public:
      * @param x                the Vector of input arguments.  Its size must equal the value returned by getArgumentSize().
      */
     virtual double calcDerivative(const std::vector<int>& derivComponents, const SimTK::Vector& x) const;
+    /**
+     * Calculate the value of this function of a single variable at x. This is
+     * the same as calcValue(SimTK::Vector(1, x)), but functions of a single
+     * variable override it to avoid constructing a Vector for every
+     * evaluation.
+     */
+    virtual double calcValue(double x) const;
+    /**
+     * Calculate the derivative of the given order of this function of a
+     * single variable at x; an order of 0 gives the value. This is the same as
+     * calcDerivative() with `order` zeros as the derivative components, but
+     * functions of a single variable override it to avoid constructing a
+     * Vector for every evaluation.
+     */
+    virtual double calcDerivative(double x, int order) const;
     /**
      * Get the number of components expected in the input vector.
      */
@@ -127,14 +142,27 @@ public:
      * underlying SimTK::System and its elements.
      */
     virtual SimTK::Function* createSimTKFunction() const = 0;
+    /**
+     * Get a number that changes whenever this function is modified through
+     * its methods (see resetFunction()) or assigned. No two functions, and no
+     * two definitions of the same function, have the same number, so an
+     * object that holds data computed from a function can tell from this
+     * number whether the data is still up to date.
+     */
+    unsigned long long getDefinitionVersion() const
+    {   return _definitionVersion; }
 
 protected:
     /**
      * This should be called whenever this object has been modified.  It clears 
-     * the internal SimTK::Function object used to evaluate it.
+     * the internal SimTK::Function object used to evaluate it, and changes
+     * the definition version.
      */
     void resetFunction();
 
+private:
+    unsigned long long _definitionVersion;
+
 //=============================================================================
 };  // END class Function
 
@@ -110,15 +110,10 @@ evaluate(int aIndex,int aDerivOrder,double aX) const
 {
     Function& func = get(aIndex);
 
-    SimTK::Vector arg = SimTK::Vector(1, aX);
     if (aDerivOrder==0)
-        return (func.calcValue(arg));
+        return (func.calcValue(aX));
 
-    std::vector<int> derivComponents;
-    for(int i=0; i<aDerivOrder; i++)
-        derivComponents.push_back(0);
-
-    return( func.calcDerivative(derivComponents, arg) );
+    return( func.calcDerivative(aX, aDerivOrder) );
 }
 
 //_____________________________________________________________________________
@@ -144,13 +139,8 @@ evaluate(Array<double> &rValues,int aDerivOrder,double aX) const
     for(i=0;i<size;i++) {
         Function& func = get(i);
         if (aDerivOrder==0)
-            rValues[i] = func.calcValue(SimTK::Vector(1,aX));
-        else {
-            std::vector<int> derivComponents;
-            for(int j=0; j<aDerivOrder; j++)
-                derivComponents.push_back(0);
-            rValues[i] = func.calcDerivative(derivComponents, SimTK::Vector(1,aX));
-
-        }
+            rValues[i] = func.calcValue(aX);
+        else
+            rValues[i] = func.calcDerivative(aX, aDerivOrder);
     }
 }
@@ -255,6 +255,8 @@ void GCVSpline::updateFromXMLNode(SimTK::Xml::Element& aNode, int versionNumber)
     // Coefficients may not have been specified in the XML file.
     if (_coefficients.getSize() < _x.getSize())
         _coefficients.setSize(_x.getSize());
+
+    resetFunction();
 }   
 
 //_____________________________________________________________________________
@@ -372,6 +374,8 @@ setDegree(int aDegree)
                 _halfOrder);
         _halfOrder = 4;
     }
+
+    resetFunction();
 }
 //_____________________________________________________________________________
 int GCVSpline::
@@ -580,6 +584,24 @@ addPoint(double aX, double aY)
     return i;
 }
 
+// The SimTK::Spline evaluates a single argument without a Vector.
+double GCVSpline::calcValue(double x) const
+{
+    if (_function == NULL)
+        _function = createSimTKFunction();
+    return static_cast<const SimTK::Spline*>(_function)->calcValue(x);
+}
+
+double GCVSpline::calcDerivative(double x, int order) const
+{
+    if (order == 0)
+        return calcValue(x);
+    if (_function == NULL)
+        _function = createSimTKFunction();
+    return static_cast<const SimTK::Spline*>(_function)->
+            calcDerivative(order, x);
+}
+
 SimTK::Function* GCVSpline::createSimTKFunction() const {
     int degree = _halfOrder*2-1;
     Vector x(_x.getSize());
@@ -174,3 +174,19 @@ SimTK::Function* LinearFunction::createSimTKFunction() const
     SimTK::Vector coeffs(_coefficients.getSize(), &_coefficients[0]);
     return new SimTK::Function::Linear(coeffs);
 }
+
+//=============================================================================
+// EVALUATION
+//=============================================================================
+// Same as SimTK::Function::Linear with one argument.
+double LinearFunction::calcValue(double x) const
+{
+    return x*_coefficients[0] + _coefficients[1];
+}
+
+double LinearFunction::calcDerivative(double x, int order) const
+{
+    if (order == 0)
+        return calcValue(x);
+    return order == 1 ? _coefficients[0] : 0.0;
+}
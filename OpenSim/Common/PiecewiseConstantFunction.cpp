@@ -184,7 +184,7 @@ void PiecewiseConstantFunction::init(Function* aFunction)
                   double x[2] = {0.0, 1.0}, y[2];
                   Constant* cons = dynamic_cast<Constant*>(aFunction);
                   if (cons != NULL) {
-                      y[0] = y[1] = cons->calcValue(SimTK::Vector(1, 0.));
+                      y[0] = y[1] = cons->calcValue(0.);
                   } else {
                       y[0] = y[1] = 1.0;
                   }
@@ -400,9 +400,13 @@ int PiecewiseConstantFunction::addPoint(double aX, double aY)
 }
 
 double PiecewiseConstantFunction::calcValue(const Vector& x) const
+{
+    return calcValue(x[0]);
+}
+
+double PiecewiseConstantFunction::calcValue(double aX) const
 {
     int n = _x.getSize();
-    double aX = x[0];
 
     if (aX < _x[0] || EQUAL_WITHIN_ERROR(aX,_x[0]))
         return _y[0];
@@ -431,6 +435,11 @@ double PiecewiseConstantFunction::calcDerivative(const std::vector<int>& derivCo
     return 0.0;
 }
 
+double PiecewiseConstantFunction::calcDerivative(double x, int order) const
+{
+    return order == 0 ? calcValue(x) : 0.0;
+}
+
 int PiecewiseConstantFunction::getArgumentSize() const
 {
     return 1;
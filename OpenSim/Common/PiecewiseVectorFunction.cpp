@@ -0,0 +1,372 @@
+/* -------------------------------------------------------------------------- *
+ *                   OpenSim:  PiecewiseVectorFunction.cpp                    *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "PiecewiseVectorFunction.h"
+
+#include "Exception.h"
+#include "GCVSpline.h"
+#include "PiecewiseLinearFunction.h"
+#include "SimmMacros.h"
+#include "SimTKmath.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace OpenSim;
+
+PiecewiseVectorFunction PiecewiseVectorFunction::createLinear(
+        const SimTK::Vector& x, const SimTK::Matrix& y) {
+    const int n = x.size();
+    OPENSIM_THROW_IF(n < 1, Exception,
+            "Expected at least one knot.");
+    OPENSIM_THROW_IF(y.nrow() != n, Exception,
+            "Expected y to have " + std::to_string(n) + " rows, but it has " +
+            std::to_string(y.nrow()) + ".");
+
+    PiecewiseVectorFunction f;
+    f._interpolation = Interpolation::Linear;
+    f._numChannels = y.ncol();
+    f._x.resize(n);
+    for (int i = 0; i < n; ++i) f._x[i] = x[i];
+    f._coefficients.resize(n * f._numChannels);
+    f._slopes.resize(n * f._numChannels);
+    for (int i = 0; i < n; ++i)
+        for (int c = 0; c < f._numChannels; ++c)
+            f._coefficients[i * f._numChannels + c] = y(i, c);
+
+    // Same slopes as PiecewiseLinearFunction::calcCoefficients().
+    if (n > 1) {
+        for (int i = 0; i < n - 1; ++i) {
+            const double range = MAX(TINY_NUMBER, x[i + 1] - x[i]);
+            for (int c = 0; c < f._numChannels; ++c)
+                f._slopes[i * f._numChannels + c] =
+                        (y(i + 1, c) - y(i, c)) / range;
+        }
+        for (int c = 0; c < f._numChannels; ++c)
+            f._slopes[(n - 1) * f._numChannels + c] =
+                    f._slopes[(n - 2) * f._numChannels + c];
+    }
+    return f;
+}
+
+PiecewiseVectorFunction PiecewiseVectorFunction::createSpline(int degree,
+        const SimTK::Vector& x, const SimTK::Matrix& y) {
+    const int n = x.size();
+    OPENSIM_THROW_IF(degree < 1 || degree > 7 || degree % 2 == 0, Exception,
+            "Expected the degree to be 1, 3, 5 or 7, but it is " +
+            std::to_string(degree) + ".");
+    OPENSIM_THROW_IF(n < degree + 1, Exception,
+            "Expected at least " + std::to_string(degree + 1) +
+            " knots, but there are " + std::to_string(n) + ".");
+    OPENSIM_THROW_IF(y.nrow() != n, Exception,
+            "Expected y to have " + std::to_string(n) + " rows, but it has " +
+            std::to_string(y.nrow()) + ".");
+
+    PiecewiseVectorFunction f;
+    f._interpolation = Interpolation::Spline;
+    f._numChannels = y.ncol();
+    f._halfOrder = (degree + 1) / 2;
+    f._x.resize(n);
+    for (int i = 0; i < n; ++i) f._x[i] = x[i];
+    f._coefficients.resize(n * f._numChannels);
+    // Fit each channel exactly as GCVSpline::createSimTKFunction() does for
+    // an error variance of zero.
+    for (int c = 0; c < f._numChannels; ++c) {
+        const SimTK::Vector column = y.col(c);
+        const SimTK::Spline spline = SimTK::SplineFitter<double>::
+                fitFromErrorVariance(degree, x, column, 0.0).getSpline();
+        const SimTK::Vector& coefficients = spline.getControlPointValues();
+        for (int i = 0; i < n; ++i)
+            f._coefficients[i * f._numChannels + c] = coefficients[i];
+    }
+    return f;
+}
+
+bool PiecewiseVectorFunction::createFromFunctions(
+        const std::vector<const Function*>& functions,
+        PiecewiseVectorFunction& result) {
+    if (functions.empty()) return false;
+
+    // All the functions must be of the same kind and share their knots.
+    std::vector<const GCVSpline*> splines;
+    std::vector<const PiecewiseLinearFunction*> linears;
+    for (const auto* function : functions) {
+        if (const auto* spline = dynamic_cast<const GCVSpline*>(function))
+            splines.push_back(spline);
+        else if (const auto* linear =
+                dynamic_cast<const PiecewiseLinearFunction*>(function))
+            linears.push_back(linear);
+        else
+            return false;
+    }
+    if (splines.size() != functions.size() &&
+            linears.size() != functions.size())
+        return false;
+
+    auto sameKnots = [](int n, const double* x, int otherN,
+                        const double* otherX) {
+        return n == otherN && std::equal(x, x + n, otherX);
+    };
+
+    const int numChannels = int(functions.size());
+    if (!linears.empty()) {
+        const int n = linears[0]->getNumberOfPoints();
+        const double* x = linears[0]->getXValues();
+        if (n < 2) return false;
+        SimTK::Matrix y(n, numChannels);
+        for (int c = 0; c < numChannels; ++c) {
+            if (!sameKnots(n, x, linears[c]->getNumberOfPoints(),
+                           linears[c]->getXValues()))
+                return false;
+            for (int i = 0; i < n; ++i) y(i, c) = linears[c]->getYValues()[i];
+        }
+        result = createLinear(SimTK::Vector(n, x), y);
+        return true;
+    }
+
+    const int n = splines[0]->getNumberOfPoints();
+    const double* x = splines[0]->getXValues();
+    const int halfOrder = splines[0]->getHalfOrder();
+    if (n < 2 * halfOrder) return false;
+    PiecewiseVectorFunction f;
+    f._interpolation = Interpolation::Spline;
+    f._numChannels = numChannels;
+    f._halfOrder = halfOrder;
+    f._x.assign(x, x + n);
+    f._coefficients.resize(n * numChannels);
+    for (int c = 0; c < numChannels; ++c) {
+        if (splines[c]->getHalfOrder() != halfOrder ||
+                !sameKnots(n, x, splines[c]->getNumberOfPoints(),
+                           splines[c]->getXValues()))
+            return false;
+        // GCVSpline fits its coefficients the first time it is evaluated.
+        splines[c]->calcValue(x[0]);
+        const Array<double>& coefficients = splines[c]->getCoefficients();
+        for (int i = 0; i < n; ++i)
+            f._coefficients[i * numChannels + c] = coefficients[i];
+    }
+    result = f;
+    return true;
+}
+
+void PiecewiseVectorFunction::calcValue(double x, int firstChannel,
+        int numChannels, double* values) const {
+    assert(firstChannel >= 0 && numChannels >= 0 &&
+           firstChannel + numChannels <= _numChannels);
+    if (numChannels == 0) return;
+    if (_interpolation == Interpolation::Linear)
+        calcLinear(x, firstChannel, numChannels, values);
+    else
+        calcSpline(x, 0, firstChannel, numChannels, values);
+}
+
+void PiecewiseVectorFunction::calcValueAndDerivatives(double x, int maxOrder,
+        double* values) const {
+    assert(maxOrder >= 0);
+    if (_numChannels == 0) return;
+    if (_interpolation == Interpolation::Spline) {
+        calcSpline(x, maxOrder, 0, _numChannels, values);
+        return;
+    }
+    calcLinear(x, 0, _numChannels, values);
+    if (maxOrder < 1) return;
+    calcLinearSlope(x, 0, _numChannels, values + _numChannels);
+    std::fill(values + 2 * _numChannels,
+              values + (maxOrder + 1) * _numChannels, 0.0);
+}
+
+// Same as PiecewiseLinearFunction::calcValue(), for every channel.
+void PiecewiseVectorFunction::calcLinear(double t, int firstChannel,
+        int numChannels, double* values) const {
+    const int n = int(_x.size());
+    const double* y = &_coefficients[firstChannel];
+    const double* b = &_slopes[firstChannel];
+
+    int k;
+    double dt = 0;
+    if (n == 1) {
+        k = 0;
+    } else if (t < _x[0]) {
+        k = 0;
+        dt = t - _x[0];
+    } else if (t > _x[n - 1]) {
+        k = n - 1;
+        dt = t - _x[n - 1];
+    } else if (EQUAL_WITHIN_ERROR(t, _x[0])) {
+        k = 0;
+    } else if (EQUAL_WITHIN_ERROR(t, _x[n - 1])) {
+        k = n - 1;
+    } else {
+        k = int(std::upper_bound(_x.begin(), _x.end(), t) - _x.begin()) - 1;
+        k = std::min(std::max(k, 0), n - 2);
+        dt = t - _x[k];
+    }
+
+    const int row = k * _numChannels;
+    if (dt == 0) {
+        for (int c = 0; c < numChannels; ++c) values[c] = y[row + c];
+    } else {
+        for (int c = 0; c < numChannels; ++c)
+            values[c] = y[row + c] + dt * b[row + c];
+    }
+}
+
+// Same as PiecewiseLinearFunction::calcDerivative() with an order of 1, for
+// every channel.
+void PiecewiseVectorFunction::calcLinearSlope(double t, int firstChannel,
+        int numChannels, double* values) const {
+    const int n = int(_x.size());
+    const double* b = &_slopes[firstChannel];
+
+    int k;
+    if (n == 1) {
+        std::fill(values, values + numChannels, 0.0);
+        return;
+    } else if (t < _x[0] || EQUAL_WITHIN_ERROR(t, _x[0])) {
+        k = 0;
+    } else if (t > _x[n - 1] || EQUAL_WITHIN_ERROR(t, _x[n - 1])) {
+        k = n - 1;
+    } else {
+        // The same binary search, so that the slope of the interval to the
+        // left or right of an interior knot is chosen the same way.
+        int i = 0;
+        int j = n;
+        while (true) {
+            k = (i + j) / 2;
+            if (t < _x[k])
+                j = k;
+            else if (t > _x[k + 1])
+                i = k;
+            else
+                break;
+        }
+    }
+
+    const int row = k * _numChannels;
+    for (int c = 0; c < numChannels; ++c) values[c] = b[row + c];
+}
+
+// Evaluate the natural B-splines of order 2*m and their derivatives as in
+// splder() (see gcvspl.c), for every channel. The interval is located once,
+// and the tableau of each channel only reads the 2*m rows of coefficients
+// around that interval. For a derivative of order ider, the coefficients are
+// first differenced ider times and the tableau is then of order 2*m-ider.
+void PiecewiseVectorFunction::calcSpline(double t, int maxOrder,
+        int firstChannel, int numChannels, double* values) const {
+    const int n = int(_x.size());
+    const double* x = _x.data();
+    const int m = _halfOrder;
+    const int m2 = 2 * m;
+    const int mp1 = m + 1;
+    const int npm = n + m;
+
+    // x[l-1] <= t < x[l]; l is 0 to the left of the first knot and n at or to
+    // the right of the last knot.
+    const int l = int(std::upper_bound(_x.begin(), _x.end(), t) - _x.begin());
+
+    double coefficients[8];
+    double q[8];
+    for (int c = firstChannel; c < firstChannel + numChannels; ++c) {
+        for (int j = l + 1; j <= l + m2; ++j) {
+            coefficients[j - l - 1] = (j >= mp1 && j <= npm)
+                    ? _coefficients[(j - m - 1) * _numChannels + c]
+                    : 0.0;
+        }
+
+        for (int ider = 0; ider <= maxOrder; ++ider) {
+            double& value = values[ider * numChannels + c - firstChannel];
+            // Derivatives of order 2*m or more are zero.
+            const int k = m2 - ider;
+            if (k < 1) {
+                value = 0.0;
+                continue;
+            }
+            std::copy(coefficients, coefficients + m2, q);
+
+            if (ider > 0) {
+                // q[ml + j - 1] holds the coefficient of the j-th B-spline.
+                const int ml = m2 - l;
+                int jl = l + 1 - m2;
+                int ii = n - m2;
+                for (int i = 1; i <= ider; ++i) {
+                    ++jl;
+                    ++ii;
+                    const int j1 = std::max(1, jl);
+                    const int j2 = std::min(l, ii);
+                    const int mi = m2 - i;
+                    for (int j = j2; j >= j1; --j) {
+                        const int jm = ml + j;
+                        q[jm - 1] = (q[jm - 1] - q[jm - 2]) /
+                                (x[j + mi - 1] - x[j - 1]);
+                    }
+                    if (jl < 1) {
+                        for (int j = ml; j >= i + 1; --j) q[j - 1] = -q[j - 2];
+                    }
+                }
+                for (int j = 0; j < k; ++j) q[j] = q[j + ider];
+            }
+
+            const int nk = n - k;
+            const int lk1 = l - k + 1;
+            for (int i = 1; i <= k - 1; ++i) {
+                const int nki = nk + i;
+                const int ki = k - i;
+                int ir = k;
+                int jj = l;
+
+                // Right hand B-splines.
+                for (int j = nki + 1; j <= l; ++j) {
+                    q[ir - 1] = q[ir - 2] + (t - x[jj - 1]) * q[ir - 1];
+                    --jj;
+                    --ir;
+                }
+
+                // Middle B-splines.
+                const int lk1i = lk1 + i;
+                const int j1 = std::max(1, lk1i);
+                const int j2 = std::min(l, nki);
+                for (int j = j1; j <= j2; ++j) {
+                    const double xjki = x[jj + ki - 1];
+                    const double z = q[ir - 1];
+                    q[ir - 1] = z + (xjki - t) * (q[ir - 2] - z) /
+                            (xjki - x[jj - 1]);
+                    --ir;
+                    --jj;
+                }
+
+                // Left hand B-splines.
+                if (lk1i <= 0) {
+                    jj = ki;
+                    for (int j = 1; j <= 1 - lk1i; ++j) {
+                        q[ir - 1] = q[ir - 1] + (x[jj - 1] - t) * q[ir - 2];
+                        --jj;
+                        --ir;
+                    }
+                }
+            }
+
+            double z = q[k - 1];
+            for (int j = k; j <= m2 - 1 && ider > 0; ++j) z *= j;
+            value = z;
+        }
+    }
+}
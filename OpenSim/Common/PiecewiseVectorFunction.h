@@ -0,0 +1,132 @@
+#ifndef OPENSIM_PIECEWISE_VECTOR_FUNCTION_H_
+#define OPENSIM_PIECEWISE_VECTOR_FUNCTION_H_
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  PiecewiseVectorFunction.h                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+// INCLUDES
+#include "osimCommonDLL.h"
+#include "SimTKcommon.h"
+
+#include <vector>
+
+namespace OpenSim {
+
+class Function;
+
+/**
+ * A vector-valued function of one independent variable (typically time) whose
+ * components, or channels, are interpolated over the same knots. Each channel
+ * evaluates to the same value as the equivalent PiecewiseLinearFunction or
+ * GCVSpline, but the interval containing the independent variable is located
+ * once for all the channels, and the data of all the channels for one knot
+ * are stored next to each other.
+ *
+ * This is used, for example, by ExternalForce and PrescribedForce to evaluate
+ * the force, point and torque components together.
+ */
+class OSIMCOMMON_API PiecewiseVectorFunction {
+public:
+    PiecewiseVectorFunction() = default;
+
+    /** Create a function that interpolates each column of y linearly, as
+    PiecewiseLinearFunction does. y must have a row for each element of x. If
+    x has a single element, each channel is constant.                        */
+    static PiecewiseVectorFunction createLinear(const SimTK::Vector& x,
+                                                const SimTK::Matrix& y);
+
+    /** Create a function that interpolates each column of y with a natural
+    spline of the given (odd) degree that passes through the data points, as
+    a GCVSpline with zero error variance does. x must have at least degree+1
+    elements.                                                                 */
+    static PiecewiseVectorFunction createSpline(int degree,
+                                                const SimTK::Vector& x,
+                                                const SimTK::Matrix& y);
+
+    /** Combine the given functions into a single vector function, with one
+    channel per function, in order. This succeeds only if the functions are
+    all PiecewiseLinearFunction or all GCVSpline of the same degree, and they
+    all share the same knots.
+
+    @returns false if the functions cannot be combined; `result` is then left
+    unchanged.                                                                */
+    static bool createFromFunctions(
+            const std::vector<const Function*>& functions,
+            PiecewiseVectorFunction& result);
+
+    /** The number of channels; 0 for a default-constructed function.         */
+    int getNumChannels() const { return _numChannels; }
+
+    /** Evaluate all the channels at x. `values` must have room for
+    getNumChannels() values.                                                  */
+    void calcValue(double x, double* values) const {
+        calcValue(x, 0, _numChannels, values);
+    }
+
+    /** Evaluate `numChannels` channels, starting at `firstChannel`, at x.    */
+    void calcValue(double x, int firstChannel, int numChannels,
+                   double* values) const;
+
+    /** Evaluate the value and the first `maxOrder` derivatives of all the
+    channels at x, in one pass. `values` must have room for
+    (maxOrder+1)*getNumChannels() values; the values of all the channels come
+    first, followed by all their first derivatives, and so on. Each derivative
+    is the same as that of the equivalent PiecewiseLinearFunction or
+    GCVSpline.                                                                */
+    void calcValueAndDerivatives(double x, int maxOrder,
+                                 double* values) const;
+
+    /** Evaluate 3 consecutive channels, starting at `firstChannel`, at x.    */
+    SimTK::Vec3 calcVec3(double x, int firstChannel) const {
+        SimTK::Vec3 values;
+        calcValue(x, firstChannel, 3, &values[0]);
+        return values;
+    }
+
+private:
+    enum class Interpolation { Linear, Spline };
+
+    void calcLinear(double x, int firstChannel, int numChannels,
+                    double* values) const;
+    void calcLinearSlope(double x, int firstChannel, int numChannels,
+                         double* values) const;
+    /** Evaluate the derivatives of orders 0 to maxOrder (0 is the value); the
+    channels of each order are stored after those of the previous order.    */
+    void calcSpline(double x, int maxOrder, int firstChannel,
+                    int numChannels, double* values) const;
+
+    Interpolation _interpolation{Interpolation::Linear};
+    int _numChannels{0};
+    /** Half of the order of the spline (order = degree + 1).                 */
+    int _halfOrder{0};
+    /** The knots.                                                            */
+    std::vector<double> _x;
+    /** For each knot, the value (linear) or B-spline coefficient (spline) of
+    every channel.                                                            */
+    std::vector<double> _coefficients;
+    /** For each knot, the slope of every channel on the interval that starts
+    at that knot (linear only).                                               */
+    std::vector<double> _slopes;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_PIECEWISE_VECTOR_FUNCTION_H_
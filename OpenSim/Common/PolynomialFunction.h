@@ -100,6 +100,35 @@ public:
         return new SimTK::Function::Polynomial(get_coefficients());
     }
 
+    using Function::calcValue;
+    using Function::calcDerivative;
+
+    /** Evaluate the polynomial at x, as SimTK::Function::Polynomial does. */
+    double calcValue(double x) const override
+    {
+        const SimTK::Vector& coefficients = get_coefficients();
+        double value = 0;
+        for (int i = 0; i < coefficients.size(); ++i)
+            value = value*x + coefficients[i];
+        return value;
+    }
+
+    /** Evaluate the derivative of the given order of the polynomial at x, as
+     * SimTK::Function::Polynomial does. */
+    double calcDerivative(double x, int order) const override
+    {
+        const SimTK::Vector& coefficients = get_coefficients();
+        const int polyOrder = coefficients.size() - 1;
+        double value = 0;
+        for (int i = 0; i <= polyOrder - order; ++i) {
+            double coeff = coefficients[i];
+            for (int j = 0; j < order; ++j)
+                coeff *= polyOrder - i - j;
+            value = value*x + coeff;
+        }
+        return value;
+    }
+
 private:
     /**
     * Construct the serializable property member variables and
@@ -509,6 +509,11 @@ int SimmSpline::addPoint(double aX, double aY)
 }
 
 double SimmSpline::calcValue(const Vector& x) const
+{
+    return calcValue(x[0]);
+}
+
+double SimmSpline::calcValue(double aX) const
 {
     // NOT A NUMBER
     if(!_y.getSize()) return(SimTK::NaN);
@@ -520,7 +525,6 @@ double SimmSpline::calcValue(const Vector& x) const
     double dx;
 
     int n = _x.getSize();
-    double aX = x[0];
 
    /* Check if the abscissa is out of range of the function. If it is,
     * then use the slope of the function at the appropriate end point to
@@ -576,6 +580,13 @@ double SimmSpline::calcValue(const Vector& x) const
 }
 
 double SimmSpline::calcDerivative(const std::vector<int>& derivComponents, const Vector& x) const
+{
+    if (derivComponents.empty())
+        throw Exception("SimmSpline::calcDerivative(): derivative order must be 1 or 2.");
+    return calcDerivative(x[0], (int)derivComponents.size());
+}
+
+double SimmSpline::calcDerivative(double aX, int aDerivOrder) const
 {
     // NOT A NUMBER
     if(!_y.getSize()) return(SimTK::NaN);
@@ -587,8 +598,8 @@ double SimmSpline::calcDerivative(const std::vector<int>& derivComponents, const
     double dx;
 
     int n = _x.getSize();
-    double aX = x[0];
-    int aDerivOrder = (int)derivComponents.size();
+    if (aDerivOrder == 0)
+        return calcValue(aX);
     if (aDerivOrder < 1 || aDerivOrder > 2)
         throw Exception("SimmSpline::calcDerivative(): derivative order must be 1 or 2.");
 
@@ -86,15 +86,24 @@ public:
     // EVALUATION
     //--------------------------------------------------------------------------
     double calcValue(const SimTK::Vector& x) const override {
-        return get_amplitude()*sin(get_omega()*x[0] + get_phase())
+        return calcValue(x[0]);
+    }
+
+    double calcValue(double x) const override {
+        return get_amplitude()*sin(get_omega()*x + get_phase())
             + get_offset();
     }
     
     double calcDerivative(const std::vector<int>& derivComponents,
         const SimTK::Vector& x) const override {
-        int n = (int)derivComponents.size();
-        return get_amplitude()*pow(get_omega(),n) * 
-            sin(get_omega()*x[0] + get_phase() + n*SimTK::Pi/2);
+        return calcDerivative(x[0], (int)derivComponents.size());
+    }
+
+    double calcDerivative(double x, int order) const override {
+        if (order == 0)
+            return calcValue(x);
+        return get_amplitude()*pow(get_omega(),order) * 
+            sin(get_omega()*x + get_phase() + order*SimTK::Pi/2);
     }
 
     SimTK::Function* createSimTKFunction() const override {
@@ -24,6 +24,8 @@
 // INCLUDES
 //=============================================================================
 #include "SmoothSegmentedFunction.h"
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include "simmath/internal/SplineFitter.h"
 
@@ -39,6 +41,13 @@ static double UTOL = (double)SimTK::Eps*1e2;
 static double INTTOL = (double)SimTK::Eps*1e2;
 static int MAXITER = 20;
 static int NUM_SAMPLE_PTS = 100;
+//Limit on the number of times precompile() bisects a Bezier section
+static int MAX_PRECOMPILE_DEPTH = 20;
+//Number of equally spaced buckets per precompiled interval
+static int PRECOMPILE_BUCKETS_PER_INTERVAL = 4;
+//Number of equally spaced interior points of an interval at which precompile()
+//compares the polynomial to the Bezier curve
+static int PRECOMPILE_SAMPLES_PER_INTERVAL = 15;
 //=============================================================================
 // UTILITY FUNCTIONS
 //=============================================================================
@@ -95,7 +104,9 @@ SmoothSegmentedFunction::
           double x0, double x1, double y0, double y1,double dydx0, double dydx1,
           bool computeIntegral, bool intx0x1, const std::string& name):
 _x0(x0),_x1(x1),_y0(y0),_y1(y1),_dydx0(dydx0),_dydx1(dydx1),
-     _computeIntegral(computeIntegral),_intx0x1(intx0x1),_name(name)
+     _computeIntegral(computeIntegral),_intx0x1(intx0x1),_name(name),
+     _precompiledBucketX0(SimTK::NaN),_precompiledInvBucketWidth(SimTK::NaN),
+     _precompiledMaxError(SimTK::NaN)
 {
     
 
@@ -166,7 +177,9 @@ _x0(x0),_x1(x1),_y0(y0),_y1(y1),_dydx0(dydx0),_dydx1(dydx1),
  SmoothSegmentedFunction::SmoothSegmentedFunction():
  _x0(SimTK::NaN),_x1(SimTK::NaN),_y0(SimTK::NaN)
      ,_y1(SimTK::NaN),_dydx0(SimTK::NaN),_dydx1(SimTK::NaN),
-     _computeIntegral(false),_intx0x1(false),_name("NOT_YET_SET")
+     _computeIntegral(false),_intx0x1(false),_name("NOT_YET_SET"),
+     _precompiledBucketX0(SimTK::NaN),_precompiledInvBucketWidth(SimTK::NaN),
+     _precompiledMaxError(SimTK::NaN)
  {
         _arraySplineUX.resize(0);        
         _mXVec.resize(0);
@@ -200,7 +213,11 @@ ________________________________________________________________________
 double SmoothSegmentedFunction::calcValue(double x) const
 {
     double yVal = 0;
-    if(x >= _x0 && x <= _x1 )
+    if(x >= _x0 && x <= _x1 && !_precompiledKnots.empty())
+    {
+        double dydx, d2ydx2;
+        calcPrecompiledValueAndDerivatives(x, yVal, dydx, d2ydx2);
+    }else if(x >= _x0 && x <= _x1 )
     {
         int idx  = SegmentedQuinticBezierToolkit::calcIndex(x,_mXVec);
         double u = SegmentedQuinticBezierToolkit::
@@ -269,7 +286,12 @@ double SmoothSegmentedFunction::calcDerivative(double x, int order) const
     if(order==0){
                 yVal = calcValue(x);
     }else{
-            if(x >= _x0 && x <= _x1){        
+            if(x >= _x0 && x <= _x1 && order <= 2
+                    && !_precompiledKnots.empty()){
+                double y, dydx, d2ydx2;
+                calcPrecompiledValueAndDerivatives(x, y, dydx, d2ydx2);
+                yVal = order == 1 ? dydx : d2ydx2;
+            }else if(x >= _x0 && x <= _x1){        
                 int idx  = SegmentedQuinticBezierToolkit::calcIndex(x,_mXVec);
                 double u = SegmentedQuinticBezierToolkit::
                                 calcU(x,_mXVec[idx], _arraySplineUX[idx], 
@@ -353,7 +375,7 @@ double SmoothSegmentedFunction::calcIntegral(double x) const
 
     double yVal = 0;    
     if(x >= _x0 && x <= _x1){
-        yVal = _splineYintX.calcValue(SimTK::Vector(1,x));
+        yVal = _splineYintX.calcValue(x);
     }else{
         //LINEAR EXTRAPOLATION         
         if(x < _x0){
@@ -431,6 +453,244 @@ SimTK::Vec2 SmoothSegmentedFunction::getCurveDomain() const
     return xrange;
 }
 
+/*Coefficients, lowest order first, of the quintic polynomial p(t) on
+t in [0,1] whose value, first and second derivatives with respect to x, with
+x = x0 + t*width, are f0 at t=0 and f1 at t=1.*/
+static void calcQuinticHermiteCoefficients(const SimTK::Vec3& f0,
+    const SimTK::Vec3& f1, double width, double* c)
+{
+    const double dy = f1[0] - f0[0];
+    const double d0 = f0[1]*width;
+    const double d1 = f1[1]*width;
+    const double s0 = f0[2]*width*width;
+    const double s1 = f1[2]*width*width;
+
+    c[0] = f0[0];
+    c[1] = d0;
+    c[2] = 0.5*s0;
+    c[3] =  10*dy - 6*d0 - 4*d1 - 1.5*s0 + 0.5*s1;
+    c[4] = -15*dy + 8*d0 + 7*d1 + 1.5*s0 -     s1;
+    c[5] =   6*dy - 3*d0 - 3*d1 - 0.5*s0 + 0.5*s1;
+}
+
+/*Evaluates the value and first 2 derivatives with respect to x of the
+quintic polynomial with coefficients c at t = (x - x0)*invWidth.*/
+static inline void calcQuinticValueAndDerivatives(const double* c, double t,
+    double invWidth, double& y, double& dydx, double& d2ydx2)
+{
+    y = c[0] + t*(c[1] + t*(c[2] + t*(c[3] + t*(c[4] + t*c[5]))));
+    dydx = (c[1] + t*(2*c[2] + t*(3*c[3] + t*(4*c[4] + t*5*c[5]))))
+            *invWidth;
+    d2ydx2 = (2*c[2] + t*(6*c[3] + t*(12*c[4] + t*20*c[5])))
+            *invWidth*invWidth;
+}
+
+SimTK::Vec3 SmoothSegmentedFunction::
+    calcBezierValueAndDerivatives(int s, double x) const
+{
+    const SimTK::Vector& xPts = _mXVec[s];
+    const SimTK::Vector& yPts = _mYVec[s];
+    double u = 0;
+    if(x <= xPts(0)){
+        u = 0;
+    }else if(x >= xPts(xPts.size()-1)){
+        u = 1;
+    }else{
+        u = SegmentedQuinticBezierToolkit::
+                calcU(x, xPts, _arraySplineUX[s], UTOL, MAXITER);
+    }
+    return SimTK::Vec3(
+        SegmentedQuinticBezierToolkit::calcQuinticBezierCurveVal(u, yPts),
+        SegmentedQuinticBezierToolkit::
+            calcQuinticBezierCurveDerivDYDX(u, xPts, yPts, 1),
+        SegmentedQuinticBezierToolkit::
+            calcQuinticBezierCurveDerivDYDX(u, xPts, yPts, 2));
+}
+
+/*Detailed Computational Costs
+________________________________________________________________________
+Per interval tested for acceptance (15 samples):
+                        Name     Comp.   Div.    Mult.   Add.    Assign.
+                        *calcU     15      2      82      42      60
+      calcQuinticBezierCurveVal                   21      20      13
+   calcQuinticBezierCurveDYDX                     78      73      23
+                 Hermite coefs           1       20      20       6
+                         total ~15*(15    2       200     150     100)
+
+*Approximate. Uses iteration
+________________________________________________________________________
+*/
+void SmoothSegmentedFunction::precompile(double valueTolerance,
+                                         double slopeTolerance)
+{
+    SimTK_ERRCHK3_ALWAYS(valueTolerance > 0 && slopeTolerance > 0,
+        "SmoothSegmentedFunction::precompile",
+        "%s: The tolerances must be positive, but valueTolerance is %f and "
+        "slopeTolerance is %f", _name.c_str(), valueTolerance, 
+        slopeTolerance);
+
+    struct Interval {
+        double x0, x1;
+        SimTK::Vec3 f0, f1;
+    };
+
+    std::vector<double> knots, invWidth, coefficients;
+    SimTK::Vec3 maxError(0);
+    std::vector<Interval> toDo;
+
+    for(int s=0; s < _numBezierSections; s++){
+        const SimTK::Vector& xPts = _mXVec[s];
+        const double xStart = xPts(0);
+        const double xEnd   = xPts(xPts.size()-1);
+        if(!(xEnd > xStart)) continue;
+        const double minWidth = 
+            (xEnd - xStart)*std::ldexp(1.0, -MAX_PRECOMPILE_DEPTH);
+
+        //Bisect the section until every interval is accurate enough. The
+        //left half is always processed first, so that the accepted 
+        //intervals are in order.
+        toDo.push_back({xStart, xEnd, 
+                        calcBezierValueAndDerivatives(s, xStart),
+                        calcBezierValueAndDerivatives(s, xEnd)});
+        while(!toDo.empty()){
+            const Interval interval = toDo.back();
+            toDo.pop_back();
+            const double width = interval.x1 - interval.x0;
+
+            double c[6];
+            calcQuinticHermiteCoefficients(interval.f0, interval.f1, width, c);
+
+            SimTK::Vec3 error(0);
+            for(int k=1; k <= PRECOMPILE_SAMPLES_PER_INTERVAL; k++){
+                const double t = k/(PRECOMPILE_SAMPLES_PER_INTERVAL + 1.0);
+                const SimTK::Vec3 exact = 
+                    calcBezierValueAndDerivatives(s, interval.x0 + t*width);
+                SimTK::Vec3 approx;
+                calcQuinticValueAndDerivatives(c, t, 1/width,
+                                               approx[0], approx[1], approx[2]);
+                for(int d=0; d < 3; d++){
+                    error[d] = std::max(error[d], std::abs(approx[d]-exact[d]));
+                }
+            }
+
+            if((error[0] <= valueTolerance && error[1] <= slopeTolerance)
+                || width <= minWidth){
+                knots.push_back(interval.x0);
+                invWidth.push_back(1/width);
+                coefficients.insert(coefficients.end(), c, c+6);
+                for(int d=0; d < 3; d++){
+                    maxError[d] = std::max(maxError[d], error[d]);
+                }
+            }else{
+                const double xMid = interval.x0 + 0.5*width;
+                const SimTK::Vec3 fMid = calcBezierValueAndDerivatives(s, xMid);
+                toDo.push_back({xMid, interval.x1, fMid, interval.f1});
+                toDo.push_back({interval.x0, xMid, interval.f0, fMid});
+            }
+        }
+    }
+
+    const int numIntervals = (int)invWidth.size();
+    SimTK_ERRCHK1_ALWAYS(numIntervals > 0,
+        "SmoothSegmentedFunction::precompile",
+        "%s: The curve has no Bezier section to precompile", _name.c_str());
+    knots.push_back(_mXVec[_numBezierSections-1](
+                            _mXVec[_numBezierSections-1].size()-1));
+
+    //Each bucket points to the interval that contains its start.
+    const int numBuckets = PRECOMPILE_BUCKETS_PER_INTERVAL*numIntervals;
+    const double bucketWidth = (knots.back() - knots.front())/numBuckets;
+    std::vector<int> buckets(numBuckets);
+    int i = 0;
+    for(int b=0; b < numBuckets; b++){
+        const double xBucket = knots.front() + b*bucketWidth;
+        while(i < numIntervals-1 && knots[i+1] <= xBucket) i++;
+        buckets[b] = i;
+    }
+
+    _precompiledKnots.swap(knots);
+    _precompiledInvWidth.swap(invWidth);
+    _precompiledCoefficients.swap(coefficients);
+    _precompiledBuckets.swap(buckets);
+    _precompiledBucketX0 = _precompiledKnots.front();
+    _precompiledInvBucketWidth = 1/bucketWidth;
+    _precompiledMaxError = maxError;
+}
+
+bool SmoothSegmentedFunction::isPrecompiled() const
+{
+    return !_precompiledKnots.empty();
+}
+
+SimTK::Vec3 SmoothSegmentedFunction::getPrecompiledMaxError() const
+{
+    return _precompiledMaxError;
+}
+
+void SmoothSegmentedFunction::
+    calcPrecompiledValueAndDerivatives(double x, double& y, double& dydx,
+                                       double& d2ydx2) const
+{
+    const int numBuckets = (int)_precompiledBuckets.size();
+    int b = (int)((x - _precompiledBucketX0)*_precompiledInvBucketWidth);
+    if(b < 0)           b = 0;
+    if(b >= numBuckets) b = numBuckets-1;
+
+    //x lies in one of the intervals lo to hi that overlap bucket b. The
+    //intervals are adaptive, so there can be many of them; binary search.
+    const int lo = _precompiledBuckets[b];
+    const int hi = b+1 < numBuckets ? _precompiledBuckets[b+1]
+                                    : (int)_precompiledInvWidth.size()-1;
+    const std::vector<double>::const_iterator knots = 
+        _precompiledKnots.begin();
+    const int i = (int)(std::upper_bound(knots+lo+1, knots+hi+1, x) 
+                        - knots) - 1;
+
+    const double invWidth = _precompiledInvWidth[i];
+    calcQuinticValueAndDerivatives(&_precompiledCoefficients[6*i],
+        (x - _precompiledKnots[i])*invWidth, invWidth, y, dydx, d2ydx2);
+}
+
+void SmoothSegmentedFunction::calcValueAndDerivatives(int n, const double* x,
+    double* y, double* dydx, double* d2ydx2) const
+{
+    const bool precompiled = !_precompiledKnots.empty();
+    for(int i=0; i < n; i++){
+        const double xi = x[i];
+        double yi = 0, dydxi = 0, d2ydx2i = 0;
+        if(xi >= _x0 && xi <= _x1){
+            if(precompiled){
+                calcPrecompiledValueAndDerivatives(xi, yi, dydxi, d2ydx2i);
+            }else{
+                int idx  = SegmentedQuinticBezierToolkit::calcIndex(xi,_mXVec);
+                double u = SegmentedQuinticBezierToolkit::
+                    calcU(xi,_mXVec[idx], _arraySplineUX[idx], UTOL,MAXITER);
+                yi = SegmentedQuinticBezierToolkit::
+                    calcQuinticBezierCurveVal(u,_mYVec[idx]);
+                if(dydx){
+                    dydxi = SegmentedQuinticBezierToolkit::
+                        calcQuinticBezierCurveDerivDYDX(u, _mXVec[idx],
+                                                        _mYVec[idx], 1);
+                }
+                if(d2ydx2){
+                    d2ydx2i = SegmentedQuinticBezierToolkit::
+                        calcQuinticBezierCurveDerivDYDX(u, _mXVec[idx],
+                                                        _mYVec[idx], 2);
+                }
+            }
+        }else if(xi < _x0){
+            yi    = _y0 + _dydx0*(xi-_x0);
+            dydxi = _dydx0;
+        }else{
+            yi    = _y1 + _dydx1*(xi-_x1);
+            dydxi = _dydx1;
+        }
+        y[i] = yi;
+        if(dydx)   dydx[i]   = dydxi;
+        if(d2ydx2) d2ydx2[i] = d2ydx2i;
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Utility functions
 ///////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,8 @@
 #include "osimCommonDLL.h"
 #include "SegmentedQuinticBezierToolkit.h"
 
+#include <vector>
+
 namespace OpenSim { 
 
     /**
@@ -197,6 +199,74 @@ namespace OpenSim {
                   derivative) linear extrapolation*/
        SimTK::Vec2 getCurveDomain() const;
 
+       /**Builds a precompiled representation of the curve, which calcValue(),
+       calcDerivative() (up to the second derivative) and
+       calcValueAndDerivatives() use from then on instead of the quintic
+       Bezier curves.
+
+       The precompiled curve is piecewise quintic in x: on each interval it is
+       the quintic polynomial that matches the value, first and second
+       derivatives of the Bezier curve at both ends of the interval, and so it
+       is C2 continuous. Each Bezier section is bisected until, on every
+       interval, the precompiled curve is within valueTolerance of the value
+       and slopeTolerance of the first derivative of the Bezier curve, at
+       15 equally spaced points within the interval. The largest differences found are
+       returned by getPrecompiledMaxError().
+
+       Evaluating the precompiled curve requires no iteration to find u(x):
+       a table of equally spaced buckets gives the first and last intervals
+       that overlap x's bucket, a binary search between them finds the
+       interval containing x, and its polynomial is evaluated with Horner's
+       method. The search takes a single step wherever the intervals are no
+       narrower than the buckets, and only where the curve needed much
+       narrower intervals does it take more.
+
+       @param valueTolerance The largest acceptable difference between the
+                             values of the precompiled and Bezier curves.
+       @param slopeTolerance The largest acceptable difference between the
+                             first derivatives of the precompiled and Bezier
+                             curves.
+       @throws OpenSim::Exception
+        -If either tolerance is not positive
+
+       <B>Computational Costs</B>
+       \verbatim
+            precompile         : ~5,000 flops per interval
+            x in curve domain  :    ~30 flops (value and 2 derivatives)
+                                    + log2(intervals in the bucket) compares
+       \endverbatim
+       */
+       void precompile(double valueTolerance = 1e-9,
+                       double slopeTolerance = 1e-6);
+
+       /**@return true if precompile() has been called on this curve (or on
+       the curve it was copied from).*/
+       bool isPrecompiled() const;
+
+       /**@return The largest differences found by precompile() between the
+       precompiled and the Bezier curves in the value (element 0), the first
+       derivative (element 1) and the second derivative (element 2). NaN if
+       the curve has not been precompiled.*/
+       SimTK::Vec3 getPrecompiledMaxError() const;
+
+       /**Calculates the value, and optionally the first and second
+       derivatives, of the curve at each of n domain points. If the curve has
+       been precompiled, this is much cheaper than calling calcValue() and
+       calcDerivative() for each point, since each point is located and
+       evaluated once for all three quantities; otherwise the Bezier curves
+       are evaluated.
+
+       @param n      The number of points.
+       @param x      The n domain points of interest.
+       @param y      The n values of the curve (output).
+       @param dydx   The n first derivatives of the curve (output), or
+                     nullptr if they are not needed.
+       @param d2ydx2 The n second derivatives of the curve (output), or
+                     nullptr if they are not needed.
+       */
+       void calcValueAndDerivatives(int n, const double* x, double* y,
+                                    double* dydx, double* d2ydx2) const;
+
        /**This function will generate a csv file (of 'name_curveName.csv', where 
        name is the one used in the constructor) of the muscle curve, and 
        'curveName' corresponds to the function that was called from
@@ -344,6 +414,33 @@ namespace OpenSim {
         bool _intx0x1;
         /**The name of the function**/
         std::string _name;
+
+        /**The precompiled curve (see precompile()); empty if the curve has
+        not been precompiled. The knots are the start of each interval,
+        followed by the end of the last interval.*/
+        std::vector<double> _precompiledKnots;
+        /**The inverse of the width of each interval*/
+        std::vector<double> _precompiledInvWidth;
+        /**The 6 coefficients of the polynomial of each interval, lowest order
+        first, in terms of t = (x - knot)/width, one interval after the
+        other*/
+        std::vector<double> _precompiledCoefficients;
+        /**For each of the equally spaced buckets that span the curve domain,
+        the index of the interval that contains the start of the bucket*/
+        std::vector<int> _precompiledBuckets;
+        /**The start of the first bucket and the inverse of a bucket's width*/
+        double _precompiledBucketX0;
+        double _precompiledInvBucketWidth;
+        /**The largest errors found in the value and first 2 derivatives*/
+        SimTK::Vec3 _precompiledMaxError;
+
+        /**Evaluates the value and first 2 derivatives of the Bezier section
+        s at x.*/
+        SimTK::Vec3 calcBezierValueAndDerivatives(int s, double x) const;
+        /**Evaluates the value and first 2 derivatives of the precompiled
+        curve at x, which must be within the curve domain.*/
+        void calcPrecompiledValueAndDerivatives(double x, double& y,
+                double& dydx, double& d2ydx2) const;
             
         /**No human should be constructing a SmoothSegmentedFunction, so the
         constructor is made private so that mere mortals cannot look at it. 
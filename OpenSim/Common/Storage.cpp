@@ -29,6 +29,7 @@
 // INCLUDES
 #include "Storage.h"
 
+#include "BinaryFileAdapter.h"
 #include "CommonUtilities.h"
 #include "GCVSpline.h"
 #include "GCVSplineSet.h"
@@ -41,6 +42,7 @@
 #include "StateVector.h"
 #include "TableUtilities.h"
 #include "TimeSeriesTable.h"
+#include <algorithm>
 #include <iostream>
 
 using namespace OpenSim;
@@ -50,10 +52,11 @@ void convertTableToStorage(const AbstractDataTable* table, Storage& sto)
 {
     sto.purge();
     TimeSeriesTable out;
+    const TimeSeriesTable* flat = nullptr;
 
     if (auto td = dynamic_cast<const TimeSeriesTable*>(table))
-        // Table is already flattened, so clone for further processing
-        out = TimeSeriesTable{ *td };
+        // Table is already flattened, so use it as is.
+        flat = td;
     else if (auto tst = dynamic_cast<const TimeSeriesTable_<SimTK::Vec2>*>(table))
         out = tst->flatten();
     else if (auto tst = dynamic_cast<const TimeSeriesTable_<SimTK::Vec3>*>(table))
@@ -85,20 +88,16 @@ void convertTableToStorage(const AbstractDataTable* table, Storage& sto)
     else {
         OPENSIM_THROW( STODataTypeNotSupported, typeid(table).name());
     }
+    if (!flat) flat = &out;
 
-    OpenSim::Array<std::string> labels("", (int)out.getNumColumns() + 1);
+    OpenSim::Array<std::string> labels("", (int)flat->getNumColumns() + 1);
     labels[0] = "time";
-    for (int i = 0; i < (int)out.getNumColumns(); ++i) {
-        labels[i + 1] = out.getColumnLabel(i);
+    for (int i = 0; i < (int)flat->getNumColumns(); ++i) {
+        labels[i + 1] = flat->getColumnLabel(i);
     }
     sto.setColumnLabels(labels);
 
-    const auto& times = out.getIndependentColumn();
-    for (unsigned i_time = 0; i_time < out.getNumRows(); ++i_time) {
-        const SimTK::Vector rowVector =
-            out.getRowAtIndex(i_time).transpose().getAsVector();
-        sto.append(times[i_time], rowVector);
-    }
+    sto.replaceData(flat->getIndependentColumn(), flat->getMatrix());
 }
 
 
@@ -1046,7 +1045,7 @@ getDataAtTime(double aT,int aN,double **rData) const
 {
 
     // FIND THE CORRECT INTERVAL FOR aT
-    int i = findIndex(_lastI,aT);
+    int i = findIndex(_lastI.load(std::memory_order_relaxed),aT);
     if((i<0)||(_storage.getSize()<=0)) {
         *rData = NULL;
         return(0);
@@ -1332,6 +1331,25 @@ Storage::getColumnIndicesForIdentifier(const std::string& identifier) const
 TimeSeriesTable Storage::exportToTable() const {
     TimeSeriesTable table{};
 
+    // Rows that do not have a value per column label are appended one at a
+    // time, so that the table reports the mismatch. Otherwise, the data is
+    // gathered into a matrix from which the table is made at once.
+    const int nr = _storage.getSize();
+    const int nc = _columnLabels.getSize() - 1;
+    bool rectangular = nc > 0;
+    for(int i = 0; rectangular && i < nr; ++i)
+        rectangular = _storage[i].getSize() == nc;
+
+    if(rectangular) {
+        std::vector<double> times(nr);
+        for(int i = 0; i < nr; ++i) times[i] = _storage[i].getTime();
+        // Exclude the first column label. It is 'time'. Time is a separate
+        // column in TimeSeriesTable.
+        table = TimeSeriesTable{times, getDataMatrix(nc),
+                std::vector<std::string>(_columnLabels.get() + 1,
+                        _columnLabels.get() + _columnLabels.getSize())};
+    }
+
     table.addTableMetaData("header", getName());
     table.addTableMetaData("inDegrees", std::string{_inDegrees ? "yes" : "no"});
     table.addTableMetaData("nRows", std::to_string(_storage.getSize()));
@@ -1339,6 +1357,8 @@ TimeSeriesTable Storage::exportToTable() const {
     if(!getDescription().empty())
         table.addTableMetaData("description", getDescription());
 
+    if(rectangular) return table;
+
     // Exclude the first column label. It is 'time'. Time is a separate column
     // in TimeSeriesTable and column label is optional.
     if (_columnLabels.size() > 1) {
@@ -1357,6 +1377,60 @@ TimeSeriesTable Storage::exportToTable() const {
     return table;
 }
 
+SimTK::Matrix Storage::getDataMatrix(int aN) const
+{
+    int nc = getSmallestNumberOfStates();
+    if(aN>=0 && aN<nc) nc = aN;
+    const int nr = _storage.getSize();
+
+    SimTK::Matrix data(nr,nc);
+    for(int i=0;i<nr;i++) {
+        const double *row = _storage[i].getData().get();
+        for(int j=0;j<nc;j++) data(i,j) = row[j];
+    }
+    return data;
+}
+
+void Storage::setDataMatrix(const SimTK::MatrixBase<double>& aData)
+{
+    const int nr = _storage.getSize();
+    if(nr!=aData.nrow()) {
+        log_error("Storage.setDataMatrix: sizes don't match.");
+        return;
+    }
+
+    for(int i=0;i<nr;i++) {
+        Array<double>& row = _storage[i].getData();
+        const int nc = std::min(aData.ncol(), row.getSize());
+        double *y = row.get();
+        for(int j=0;j<nc;j++) y[j] = aData(i,j);
+    }
+}
+
+void Storage::replaceData(const std::vector<double>& aTimes,
+                          const SimTK::MatrixBase<double>& aData)
+{
+    OPENSIM_THROW_IF((int)aTimes.size() != aData.nrow(), InvalidArgument,
+            "Expected a row of data per time, but got " +
+            std::to_string(aData.nrow()) + " rows and " +
+            std::to_string(aTimes.size()) + " times.");
+
+    const int nr = aData.nrow();
+    const int nc = aData.ncol();
+    _storage.setSize(0);
+    _storage.ensureCapacity(nr);
+
+    // Each row is allocated once, when it is copied into the storage.
+    StateVector vec;
+    vec.getData().setSize(nc);
+    double *y = vec.getData().get();
+    for(int i=0;i<nr;i++) {
+        vec.setTime(aTimes[i]);
+        for(int j=0;j<nc;j++) y[j] = aData(i,j);
+        _storage.append(vec);
+    }
+}
+
 
 //=============================================================================
 // RESET
@@ -2330,26 +2404,18 @@ pad(int aPadSize)
     int newSize = paddedTime.getSize();
 
     // PAD EACH COLUMN
-    int nc = getSmallestNumberOfStates();
-    Array<double> paddedSignal(0.0,size);
-    StateVector *vecs = new StateVector[newSize];
-    for(int j=0;j<newSize;j++) {
-        vecs[j].getData().setSize(nc);
-        vecs[j].setTime(paddedTime[j]);
-    }
+    SimTK::Matrix data = getDataMatrix();
+    const int nc = data.ncol();
+    SimTK::Matrix padded(newSize,nc);
     for(int i=0;i<nc;i++) {
-        getDataColumn(i,paddedSignal);
-        Signal::Pad(aPadSize,paddedSignal);
-        for(int j=0;j<newSize;j++)
-            vecs[j].setDataValue(i,paddedSignal[j]);
+        const std::vector<double> paddedSignal =
+                Signal::Pad(aPadSize,size,&data(0,i));
+        std::copy(paddedSignal.begin(),paddedSignal.end(),&padded(0,i));
     }
 
-    // APPEND THE STATEVECTORS
-    _storage.setSize(0);
-    for(int i=0;i<newSize;i++) _storage.append(vecs[i]);
-
-    // CLEANUP
-    delete[] vecs;
+    // REPLACE THE STATEVECTORS
+    replaceData(std::vector<double>(paddedTime.get(),
+                                    paddedTime.get()+newSize), padded);
 }
 
 void Storage::
@@ -2377,19 +2443,18 @@ smoothSpline(int aOrder,double aCutoffFrequency)
 
     // LOOP OVER COLUMNS
     double *times=NULL;
-    int nc = getSmallestNumberOfStates();
-    double *signal=NULL;
-    Array<double> filt(0.0,size);
     getTimeColumn(times,0);
-    for(int i=0;i<nc;i++) {
-        getDataColumn(i,signal);
-        Signal::SmoothSpline(aOrder,dtmin,aCutoffFrequency,size,times,signal,&filt[0]);
-        setDataColumn(i,filt);
+    SimTK::Matrix data = getDataMatrix();
+    std::vector<double> filt(size);
+    for(int i=0;i<data.ncol();i++) {
+        Signal::SmoothSpline(aOrder,dtmin,aCutoffFrequency,size,times,
+                             &data(0,i),filt.data());
+        std::copy(filt.begin(),filt.end(),&data(0,i));
     }
+    setDataMatrix(data);
 
     // CLEANUP
     delete[] times;
-    delete[] signal;
 }
 
 void Storage::
@@ -2416,17 +2481,14 @@ lowpassIIR(double aCutoffFrequency)
     }
 
     // LOOP OVER COLUMNS
-    int nc = getSmallestNumberOfStates();
-    double *signal=NULL;
-    Array<double> filt(0.0,size);
-    for(int i=0;i<nc;i++) {
-        getDataColumn(i,signal);
-        Signal::LowpassIIR(dtmin,aCutoffFrequency,size,signal,&filt[0]);
-        setDataColumn(i,filt);
+    SimTK::Matrix data = getDataMatrix();
+    std::vector<double> filt(size);
+    for(int i=0;i<data.ncol();i++) {
+        Signal::LowpassIIR(dtmin,aCutoffFrequency,size,
+                &data(0,i),filt.data());
+        std::copy(filt.begin(),filt.end(),&data(0,i));
     }
-
-    // CLEANUP
-    delete[] signal;
+    setDataMatrix(data);
 }
 
 void Storage::
@@ -2453,17 +2515,14 @@ lowpassFIR(int aOrder,double aCutoffFrequency)
     }
 
     // LOOP OVER COLUMNS
-    int nc = getSmallestNumberOfStates();
-    double *signal=NULL;
-    Array<double> filt(0.0,size);
-    for(int i=0;i<nc;i++) {
-        getDataColumn(i,signal);
-        Signal::LowpassFIR(aOrder,dtmin,aCutoffFrequency,size,signal,&filt[0]);
-        setDataColumn(i,filt);
+    SimTK::Matrix data = getDataMatrix();
+    std::vector<double> filt(size);
+    for(int i=0;i<data.ncol();i++) {
+        Signal::LowpassFIR(aOrder,dtmin,aCutoffFrequency,size,
+                &data(0,i),filt.data());
+        std::copy(filt.begin(),filt.end(),&data(0,i));
     }
-
-    // CLEANUP
-    delete[] signal;
+    setDataMatrix(data);
 }
 
 
@@ -2499,9 +2558,9 @@ findIndex(int aI,double aT) const
     for(i=aI;i<_storage.getSize();i++) {
         if(aT<getStateVector(i)->getTime()) break;
     }
-    _lastI = i-1;
-    if(_lastI<0) _lastI=0;
-    return(_lastI);
+    const int index = std::max(i-1, 0);
+    _lastI.store(index, std::memory_order_relaxed);
+    return(index);
 }
 //_____________________________________________________________________________
 /**
@@ -2523,9 +2582,9 @@ findIndex(double aT) const
     for(i=0;i<_storage.getSize();i++) {
         if(aT<getStateVector(i)->getTime()) break;
     }
-    _lastI = i-1;
-    if(_lastI<0) _lastI=0;
-    return(_lastI);
+    const int index = std::max(i-1, 0);
+    _lastI.store(index, std::memory_order_relaxed);
+    return(index);
 }
 //_____________________________________________________________________________
 /**
@@ -2602,30 +2661,46 @@ resampleLinear(double aDT)
         aDT = newDT;
     }
 
-    Array<std::string> saveLabels = getColumnLabels();
-
     // HOW MANY TIME STEPS?
     double ti = getFirstTime();
     double tf = getLastTime();
     int nr = IO::ComputeNumberOfSteps(ti,tf,aDT);
 
-    Storage *newStorage = new Storage(nr);
-
     // LOOP THROUGH THE DATA
-    int ny=0;
-    double *y=NULL;
-    StateVector vec;
+    // The new times increase, so the interval that brackets each of them is
+    // found by moving forward from the previous one. Values are interpolated
+    // as in getDataAtTime().
+    const SimTK::Matrix data = getDataMatrix();
+    const int nc = data.ncol();
+    SimTK::Matrix resampled(nr,nc);
+    std::vector<double> times(nr);
+    int k = 0;
     for(int i=0; i<nr; i++) {
         double t = ti+aDT*(double)i;
+        while(k+1<numDataRows && _storage[k+1].getTime()<=t) k++;
+
+        // CHECK FOR k AT END POINTS
+        int i1=k,i2=k+1;
+        if(i2==numDataRows) {
+            i1--;
+            i2--;
+        }
+
         // INTERPOLATE THE STATES
-        ny = getDataAtTime(t,ny,&y);
-        newStorage->append(t,ny,y);
+        double t1 = _storage[i1].getTime();
+        double den = _storage[i2].getTime()-t1;
+        double pct = (den<SimTK::Eps) ? 0.0 : (t-t1)/den;
+        times[i] = t;
+        for(int j=0; j<nc; j++) {
+            if(pct==0.0) {
+                resampled(i,j) = data(i1,j);
+            } else {
+                resampled(i,j) = data(i1,j) + pct*(data(i2,j)-data(i1,j));
+            }
+        }
     }
 
-    copyData(*newStorage);
-
-    delete newStorage;
-    delete[] y;
+    replaceData(times,resampled);
 
     return aDT;
 }
@@ -2698,6 +2773,10 @@ setOutputFileName(const std::string& aFileName)
  * The total number of characters written is returned.  If an error occurred,
  * a negative number is returned.
  *
+ * If the file name has the extension ".bsto", the storage is written in the
+ * binary format of BinaryFileAdapter instead, and aMode and aComment are
+ * ignored.
+ *
  * @param aFileName Name of file to which to save.
  * @param aMode Writing mode: "w" means write and "a" means append.  The
  * default is "w".
@@ -2707,6 +2786,23 @@ setOutputFileName(const std::string& aFileName)
 bool Storage::
 print(const string &aFileName,const string &aMode, const string& aComment) const
 {
+    // BINARY FILES
+    // These are written from a TimeSeriesTable; there is no text header.
+    const string lowerFileName = SimTK::String::toLower(aFileName);
+    const string binaryExtension = ".bsto";
+    if (lowerFileName.size() > binaryExtension.size() &&
+            lowerFileName.compare(lowerFileName.size() - binaryExtension.size(),
+                    binaryExtension.size(), binaryExtension) == 0) {
+        try {
+            BinaryFileAdapter::write(exportToTable(), aFileName);
+        } catch (const std::exception& x) {
+            log_error("Storage.print: failed to write binary file {}.\n{}",
+                    aFileName, x.what());
+            return false;
+        }
+        return true;
+    }
+
     // OPEN THE FILE
     FILE *fp = IO::OpenFile(aFileName,aMode);
     if(fp==NULL) return(false);
@@ -32,6 +32,8 @@
 #include "StorageInterface.h"
 #include "TimeSeriesTable.h"
 
+#include <atomic>
+
 const int Storage_DEFAULT_CAPACITY = 256;
 //=============================================================================
 //=============================================================================
@@ -85,8 +87,10 @@ protected:
     /** Step interval at which states in a simulation are stored. See
     store(). */
     int _stepInterval;
-    /** Last index at which a search was started. */
-    mutable int _lastI;
+    /** Last index at which a search was started. This is only a hint, so
+    searches of a const Storage from multiple threads may update it without
+    synchronization. */
+    mutable std::atomic<int> _lastI;
     /** Flag for whether or not to insert a SIMM style header. */
     bool _writeSIMMHeader;
     /** Units in which the data is represented. */
@@ -206,6 +210,23 @@ public:
     int getDataColumn(const std::string& columnName,double *&rData) const;
     void getDataColumn(const std::string& columnName, Array<double>& data, double startTime=0.0) override;
 
+    /** Get the first aN columns of data (by default, as many columns as
+    every row has; see getSmallestNumberOfStates()) as a matrix with one row
+    per time. The matrix is column-major, so that each column is contiguous,
+    and is filled in a single pass over the rows. Operations on whole
+    columns (e.g., filtering) should work on this matrix rather than on one
+    column at a time. */
+    SimTK::Matrix getDataMatrix(int aN=-1) const;
+    /** Set the first aData.ncol() columns of data of every row from a matrix
+    with one row per time, as returned by getDataMatrix(). */
+    void setDataMatrix(const SimTK::MatrixBase<double>& aData);
+    /** Replace all the rows of this storage with one row per element of
+    aTimes, whose data is the corresponding row of aData. The column labels
+    are not changed.
+    @throws InvalidArgument if aData does not have a row per time. */
+    void replaceData(const std::vector<double>& aTimes,
+                     const SimTK::MatrixBase<double>& aData);
+
     /** Convert to a TimeSeriesTable. This may be useful if you need to use
     parts of the API that require a TimeSeriesTable instead of a Storage. */
     TimeSeriesTable exportToTable() const;
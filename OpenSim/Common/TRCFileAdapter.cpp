@@ -156,27 +156,42 @@ TRCFileAdapter::extendRead(const std::string& fileName) const {
         }
     }
 
-    // Read the rows one at a time and fill up the time column container and
-    // the data container.
+    // Read the rest of the file with a single read and parse the rows in
+    // place.
+    const std::string data = readRemaining(in_stream);
+    const char* pos = data.data();
+    const char* const dataEnd = pos + data.size();
+    std::vector<TextRange> row{};
+    TextRange line{};
+
     std::size_t line_num{_dataStartsAtLine};
-    std::vector<std::string> row = nextLine();
     // skip immediate blank lines between header and data.
-    while(row.empty() || row.at(0).empty()) {
-        row = nextLine();
+    const char* dataStart = pos;
+    while(getNextLine(pos, dataEnd, line)) {
+        tokenize(line, _delimitersRead, row);
+        if(!(row.empty() || row.front().empty()))
+            break;
+        dataStart = pos;
         ++line_num;
     }
-    
+
+    // An empty line during data parsing denotes end of data. Count the rows
+    // first so that the time column and the marker data can be allocated
+    // once, at their final size, rather than grown as rows are read.
+    int numRows = 0;
+    for(pos = dataStart; getNextLine(pos, dataEnd, line) && !line.empty(); )
+        ++numRows;
+
     const size_t expected{ column_labels.size() * 3 + 2 };
-    // Will first store data in a SimTK::Matrix to avoid expensive calls 
-    // to the table's appendRow() which reallocates and copies the whole table.
-    int rowNumber = 0;
-    int last_size = 1024; 
-    SimTK::Matrix_<SimTK::Vec3> markerData{last_size, static_cast<int>(num_markers_expected)};
-    std::vector<double> times;
-    times.resize(last_size);
-
-    // An empty line during data parsing denotes end of data
-    while (!row.empty()) {
+    // Markers with a missing component remain NaN.
+    SimTK::Matrix_<SimTK::Vec3> markerData{numRows,
+            static_cast<int>(num_markers_expected), SimTK::Vec3(SimTK::NaN)};
+    std::vector<double> times(numRows);
+
+    pos = dataStart;
+    for(int rowNumber = 0; rowNumber < numRows; ++rowNumber) {
+        getNextLine(pos, dataEnd, line);
+        tokenize(line, _delimitersRead, row);
         OPENSIM_THROW_IF(row.size() != expected,
                          RowLengthMismatch,
                          fileName,
@@ -185,38 +200,22 @@ TRCFileAdapter::extendRead(const std::string& fileName) const {
                          row.size());
 
         // Columns 2 till the end are data.
-        TimeSeriesTableVec3::RowVector 
-            row_vector{static_cast<int>(num_markers_expected), 
-                       SimTK::Vec3(SimTK::NaN)};
         int ind{0};
-        for (std::size_t c = 2; c < column_labels.size() * 3 + 2; c += 3) {
+        for (std::size_t c = 2; c < expected; c += 3) {
             //only if each component is specified read process as a Vec3
-            if ( !(row.at(c).empty() || row.at(c + 1).empty() 
-                                     || row.at(c + 2).empty()) ) {
-                row_vector[ind] = SimTK::Vec3{ std::stod(row.at(c)),
-                                               std::stod(row.at(c + 1)),
-                                               std::stod(row.at(c + 2)) };
-            } // otherwise the value will remain NaN (default)
+            if ( !(row[c].empty() || row[c + 1].empty() 
+                                  || row[c + 2].empty()) ) {
+                markerData(rowNumber, ind) =
+                        SimTK::Vec3{ parseDouble(row[c]),
+                                     parseDouble(row[c + 1]),
+                                     parseDouble(row[c + 2]) };
+            }
             ++ind;
         }
-        markerData[rowNumber] = row_vector;
         // Column 1 is time.
-        times[rowNumber] = std::stod(row.at(1));
-        rowNumber++;
-        if (rowNumber== last_size) {
-            // resize all Data/Matrices, double the size  while keeping data
-            int newSize = last_size * 2;
-            times.resize(newSize);
-            // Repeat for Data matrices in use
-            markerData.resizeKeep(newSize, (int)num_markers_expected);
-            last_size = newSize;
-        }
-        row = nextLine();
+        times[rowNumber] = parseDouble(row[1]);
         ++line_num;
     }
-    // Trim Matrices in use to actual data and move into tables
-    times.resize(rowNumber);
-    markerData.resizeKeep(rowNumber, (int)num_markers_expected);
 
     // Set the column labels of the table.
     std::vector<std::string> labels{};
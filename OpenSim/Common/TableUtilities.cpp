@@ -181,7 +181,7 @@ void TableUtilities::pad(
         newMatrix.updCol((int)icol) =
                 SimTK::Vector((int)newColumn.size(), newColumn.data(), true);
     }
-    table.updMatrix() = newMatrix;
+    table.assignDependentData(newMatrix);
 }
 
 namespace {
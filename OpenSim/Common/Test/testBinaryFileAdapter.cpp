@@ -0,0 +1,130 @@
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  testBinaryFileAdapter.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "OpenSim/Common/Adapters.h"
+#include "OpenSim/Common/Storage.h"
+
+#define CATCH_CONFIG_MAIN
+#include <OpenSim/Auxiliary/catch.hpp>
+
+using namespace OpenSim;
+
+namespace {
+// The binary format stores doubles as-is, so the tables must be identical.
+template<typename T>
+void compareTables(const TimeSeriesTable_<T>& expected,
+                   const TimeSeriesTable_<T>& found,
+                   bool compareMetaData = true) {
+    REQUIRE(found.getNumRows() == expected.getNumRows());
+    REQUIRE(found.getNumColumns() == expected.getNumColumns());
+    CHECK(found.getColumnLabels() == expected.getColumnLabels());
+    CHECK(found.getIndependentColumn() == expected.getIndependentColumn());
+    for(size_t row = 0; row < expected.getNumRows(); ++row)
+        for(size_t col = 0; col < expected.getNumColumns(); ++col)
+            CHECK(found.getMatrix()(int(row), int(col)) ==
+                  expected.getMatrix()(int(row), int(col)));
+    if(!compareMetaData) return;
+    for(const auto& key : expected.getTableMetaDataKeys())
+        CHECK(found.getTableMetaDataAsString(key) ==
+              expected.getTableMetaDataAsString(key));
+}
+}
+
+TEST_CASE("BinaryFileAdapter round-trips tables exactly") {
+    SECTION("double") {
+        TimeSeriesTable table{"std_walking2_grfs.sto"};
+        BinaryFileAdapter::write(table, "std_walking2_grfs.bsto");
+        compareTables(table, TimeSeriesTable{"std_walking2_grfs.bsto"});
+    }
+    SECTION("Vec3") {
+        TimeSeriesTableVec3 table{"sampleOutputsVec3.sto"};
+        BinaryFileAdapter::write(table, "sampleOutputsVec3.bsto");
+        compareTables(table, TimeSeriesTableVec3{"sampleOutputsVec3.bsto"});
+    }
+    SECTION("SpatialVec") {
+        TimeSeriesTable_<SimTK::SpatialVec> table{
+                "sampleOutputsSpatialVec.sto"};
+        BinaryFileAdapter::write(table, "sampleOutputsSpatialVec.bsto");
+        compareTables(table, TimeSeriesTable_<SimTK::SpatialVec>{
+                "sampleOutputsSpatialVec.bsto"});
+    }
+    SECTION("Quaternion") {
+        TimeSeriesTableQuaternion table{};
+        table.setColumnLabels({"pelvis", "femur_r"});
+        table.addTableMetaData("inDegrees", std::string{"no"});
+        SimTK::Random::Uniform random(-1, 1);
+        for(int i = 0; i < 10; ++i) {
+            SimTK::RowVector_<SimTK::Quaternion> row(2);
+            for(int col = 0; col < 2; ++col)
+                row[col] = SimTK::Quaternion(SimTK::Vec4(random.getValue(),
+                        random.getValue(), random.getValue(),
+                        random.getValue()));
+            table.appendRow(0.01 * i, row);
+        }
+        BinaryFileAdapter::write(table, "quaternions.bsto");
+        compareTables(table, TimeSeriesTableQuaternion{"quaternions.bsto"});
+    }
+    SECTION("Through FileAdapter and Storage") {
+        TimeSeriesTable table{"sampleOutputs.sto"};
+        DataAdapter::InputTables tables{};
+        tables.emplace(BinaryFileAdapter::tableString(), &table);
+        FileAdapter::writeFile(tables, "sampleOutputs.bsto");
+        compareTables(table, TimeSeriesTable{"sampleOutputs.bsto"});
+
+        Storage sto{"sampleOutputs.bsto"};
+        CHECK(sto.getSize() == int(table.getNumRows()));
+        CHECK(sto.print("sampleOutputsFromStorage.bsto"));
+        // Storage keeps its own metadata.
+        compareTables(table,
+                TimeSeriesTable{"sampleOutputsFromStorage.bsto"}, false);
+    }
+}
+
+TEST_CASE("BinaryFileAdapter reads a subset of the columns") {
+    TimeSeriesTable table{"std_walking2_grfs.sto"};
+    BinaryFileAdapter::write(table, "std_walking2_grfs.bsto");
+
+    CHECK(BinaryFileAdapter::readColumnLabels("std_walking2_grfs.bsto") ==
+          table.getColumnLabels());
+
+    const auto& labels = table.getColumnLabels();
+    const std::vector<std::string> subset{labels[4], labels[1]};
+    auto tables = BinaryFileAdapter{}.readColumns("std_walking2_grfs.bsto",
+                                                  subset);
+    const auto& found = dynamic_cast<const TimeSeriesTable&>(
+            *tables.at(BinaryFileAdapter::tableString()));
+    REQUIRE(found.getNumColumns() == 2);
+    CHECK(found.getColumnLabels() == subset);
+    CHECK(found.getIndependentColumn() == table.getIndependentColumn());
+    for(size_t i = 0; i < subset.size(); ++i) {
+        const auto expected = table.getDependentColumn(subset[i]);
+        const auto column = found.getDependentColumnAtIndex(i);
+        for(int row = 0; row < expected.size(); ++row)
+            CHECK(column[row] == expected[row]);
+    }
+
+    CHECK_THROWS_AS(BinaryFileAdapter{}.readColumns("std_walking2_grfs.bsto",
+                                                    {"not_a_column"}),
+                    KeyNotFound);
+    CHECK_THROWS_AS(BinaryFileAdapter::readColumnLabels("sampleOutputs.sto"),
+                    IOError);
+}
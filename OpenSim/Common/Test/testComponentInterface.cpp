@@ -1205,6 +1205,90 @@ void testTraversePathToComponent() {
     SimTK_TEST(&top.getComponent<Component>("tx/tx") == btx);
 }
 
+void testPathIndex() {
+    class A : public Component {
+        OpenSim_DECLARE_CONCRETE_OBJECT(A, Component);
+    public:
+        A(const std::string& name) { setName(name); }
+    };
+    class B : public Component {
+        OpenSim_DECLARE_CONCRETE_OBJECT(B, Component);
+    public:
+        B(const std::string& name) { setName(name); }
+    };
+
+    A top("top");
+    A* a1 = new A("a1");
+    top.addComponent(a1);
+    B* b1 = new B("b1");
+    top.addComponent(b1);
+    A* a2 = new A("a2");
+    a1->addComponent(a2);
+    B* b2 = new B("b2");
+    a1->addComponent(b2);
+    B* duplicate1 = new B("duplicate");
+    a1->addComponent(duplicate1);
+    B* duplicate2 = new B("duplicate");
+    b1->addComponent(duplicate2);
+
+    // finalizeConnections() indexes the paths; lookups must give the same
+    // results as searching the tree.
+    top.finalizeFromProperties();
+    top.finalizeConnections(top);
+
+    SimTK_TEST(&top.getComponent<A>("") == &top);
+    SimTK_TEST(&top.getComponent<A>("/") == &top);
+    SimTK_TEST(&top.getComponent<A>("a1/a2") == a2);
+    SimTK_TEST(&top.getComponent<B>("/a1/b2") == b2);
+    SimTK_TEST(&a2->getComponent<A>("../../") == &top);
+    SimTK_TEST(&a2->getComponent<B>("../b2") == b2);
+    SimTK_TEST(&b2->getComponent<B>("../../b1") == b1);
+    SimTK_TEST_MUST_THROW(top.getComponent<B>("a1/a2"));
+    SimTK_TEST_MUST_THROW(top.getComponent<A>("oops/a2"));
+    SimTK_TEST_MUST_THROW(a1->getComponent<A>("../../"));
+
+    SimTK_TEST(top.findComponent("a2") == a2);
+    SimTK_TEST(a1->findComponent<B>("duplicate") == duplicate1);
+    SimTK_TEST(b1->findComponent("duplicate") == duplicate2);
+    SimTK_TEST(b1->findComponent("a2") == nullptr);
+    SimTK_TEST(top.findComponent<B>("a2") == nullptr);
+    SimTK_TEST_MUST_THROW_EXC(top.findComponent("duplicate"),
+            OpenSim::Exception);
+
+    // Renaming an ancestor changes the paths of its descendants.
+    a1->setName("x");
+    SimTK_TEST_MUST_THROW(top.getComponent<B>("/a1/b2"));
+    SimTK_TEST_MUST_THROW(top.getComponent<A>("a1/a2"));
+    SimTK_TEST(&top.getComponent<B>("/x/b2") == b2);
+    SimTK_TEST(&b2->getComponent<A>("../a2") == a2);
+    a1->setName("a1");
+    SimTK_TEST(&top.getComponent<B>("/a1/b2") == b2);
+
+    // A renamed component is found by its new path only.
+    b2->setName("b2renamed");
+    SimTK_TEST(&top.getComponent<B>("a1/b2renamed") == b2);
+    SimTK_TEST_MUST_THROW(top.getComponent<B>("a1/b2"));
+    SimTK_TEST(top.findComponent("b2renamed") == b2);
+    SimTK_TEST(top.findComponent("b2") == nullptr);
+
+    // Adding a component clears the index.
+    A* a3 = new A("a3");
+    a2->addComponent(a3);
+    SimTK_TEST(&top.getComponent<A>("a1/a2/a3") == a3);
+    top.finalizeFromProperties();
+    top.finalizeConnections(top);
+    SimTK_TEST(&top.getComponent<A>("a1/a2/a3") == a3);
+    SimTK_TEST(&a3->getComponent<B>("../../b2renamed") == b2);
+    SimTK_TEST(top.findComponent("a3") == a3);
+
+    // A copy does not share the index of the original.
+    A copy(top);
+    copy.finalizeFromProperties();
+    const auto& a3InCopy = copy.getComponent<A>("a1/a2/a3");
+    SimTK_TEST(&a3InCopy != a3);
+    SimTK_TEST(&a3InCopy.getRoot() == &copy);
+}
+
 void testGetStateVariableValue() {
 
     TheWorld top;
@@ -1238,6 +1322,17 @@ void testGetStateVariableValue() {
     SimTK_TEST_MUST_THROW_EXC(
             top.getStateVariableValue(s, "typo/b/subState"),
             OpenSim::Exception);
+
+    // Renaming an ancestor changes the paths of its state variables.
+    a->setName("x");
+    SimTK_TEST(top.getStateVariableValue(s, "x/b/subState") == 30);
+    SimTK_TEST(top.getStateVariableValue(s, "/x/subState") == 20);
+    SimTK_TEST_MUST_THROW_EXC(
+            top.getStateVariableValue(s, "a/b/subState"),
+            OpenSim::Exception);
+    SimTK_TEST_MUST_THROW_EXC(
+            top.getStateVariableValue(s, "/a/subState"),
+            OpenSim::Exception);
 }
 
 void testInputOutputConnections()
@@ -2518,6 +2613,7 @@ int main() {
         SimTK_SUBTEST(testComponentPathNames);
         SimTK_SUBTEST(testFindComponent);
         SimTK_SUBTEST(testTraversePathToComponent);
+        SimTK_SUBTEST(testPathIndex);
         SimTK_SUBTEST(testGetStateVariableValue);
         SimTK_SUBTEST(testInputOutputConnections);
         SimTK_SUBTEST(testInputConnecteePaths);
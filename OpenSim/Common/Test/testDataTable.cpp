@@ -785,6 +785,91 @@ TEST_CASE("DataTable") {
     }
 }
 
+TEST_CASE("DataTable reserve and appendRows") {
+    const int nr = 100;
+    const int nc = 4;
+    SimTK::Matrix data(nr, nc);
+    std::vector<double> time(nr);
+    for (int r = 0; r < nr; ++r) {
+        time[r] = 0.01 * r;
+        for (int c = 0; c < nc; ++c) data(r, c) = r + 0.1 * c;
+    }
+
+    // Rows appended one at a time into reserved storage must be identical to
+    // rows appended in bulk.
+    TimeSeriesTable rowByRow;
+    rowByRow.setColumnLabels({"a", "b", "c", "d"});
+    rowByRow.reserve(nr);
+    for (int r = 0; r < nr; ++r) {
+        rowByRow.appendRow(time[r], data.row(r));
+        CHECK(rowByRow.getNumRows() == (size_t)(r + 1));
+        // Interleaving reads with appends must see every row.
+        if (r % 10 == 0)
+            CHECK(rowByRow.getRowAtIndex(r)[nc - 1] == data(r, nc - 1));
+    }
+    rowByRow.shrinkToFit();
+
+    // Without a reservation, the storage has spare rows; copies and moves
+    // must see only the rows in use and not share storage.
+    TimeSeriesTable grown;
+    grown.setColumnLabels({"a", "b", "c", "d"});
+    for (int r = 0; r < nr / 2 + 1; ++r) grown.appendRow(time[r], data.row(r));
+    TimeSeriesTable copy(grown);
+    CHECK(copy.getMatrix().nrow() == nr / 2 + 1);
+    copy.appendRow(time[nr / 2 + 1], data.row(nr / 2 + 1));
+    copy.updMatrix()(0, 0) = -1;
+    CHECK(grown.getNumRows() == (size_t)(nr / 2 + 1));
+    CHECK(grown.getMatrix()(0, 0) == data(0, 0));
+    TimeSeriesTable moved(std::move(copy));
+    CHECK(moved.getNumRows() == (size_t)(nr / 2 + 2));
+    CHECK(moved.getMatrix()(nr / 2 + 1, nc - 1) == data(nr / 2 + 1, nc - 1));
+    grown = moved;
+    CHECK(grown.getMatrix()(0, 0) == -1);
+    grown.removeRowAtIndex(0);
+    CHECK(grown.getMatrix().nrow() == nr / 2 + 1);
+    CHECK(grown.getMatrix()(0, 0) == data(1, 0));
+
+    // The matrix exposed after appending is contiguous, and assigning to it
+    // can still resize the table.
+    TimeSeriesTable appended;
+    appended.setColumnLabels({"a", "b", "c", "d"});
+    for (int r = 0; r < 3; ++r) appended.appendRow(time[r], data.row(r));
+    CHECK(appended.getMatrix().hasContiguousData());
+    CHECK(appended.getMatrix().nrow() == 3);
+    appended.appendRow(time[3], data.row(3));
+    CHECK(appended.getDependentColumnAtIndex(0).size() == 4);
+    appended.updMatrix() = SimTK::Matrix(2, nc, 1.0);
+    CHECK(appended.getNumRows() == 2);
+    CHECK(appended.getMatrix()(1, nc - 1) == 1.0);
+
+    TimeSeriesTable bulk;
+    bulk.setColumnLabels({"a", "b", "c", "d"});
+    bulk.appendRows(std::vector<double>(time.begin(), time.begin() + nr / 2),
+            data(0, 0, nr / 2, nc));
+    bulk.appendRows(std::vector<double>(time.begin() + nr / 2, time.end()),
+            data(nr / 2, 0, nr - nr / 2, nc));
+
+    CHECK(bulk.getNumRows() == (size_t)nr);
+    CHECK(rowByRow.getIndependentColumn() == bulk.getIndependentColumn());
+    for (int r = 0; r < nr; ++r) {
+        for (int c = 0; c < nc; ++c) {
+            CHECK(rowByRow.getMatrix()(r, c) == data(r, c));
+            CHECK(bulk.getMatrix()(r, c) == data(r, c));
+        }
+    }
+
+    // A rejected row leaves the table unchanged.
+    SimTK::Matrix extra(2, nc, 0.0);
+    CHECK_THROWS_AS(bulk.appendRows({2.0, 1.5}, extra),
+            TimestampLessThanEqualToPrevious);
+    CHECK(bulk.getNumRows() == (size_t)nr);
+    CHECK_THROWS_AS(bulk.appendRows({2.0}, SimTK::Matrix(1, nc + 1, 0.0)),
+            IncorrectNumColumns);
+    CHECK_THROWS_AS(rowByRow.appendRow(2.0, SimTK::RowVector(nc + 1, 0.0)),
+            IncorrectNumColumns);
+    CHECK(bulk.getNumRows() == (size_t)nr);
+}
+
 TEST_CASE("TableUtilities::checkNonUniqueLabels") {
     CHECK_THROWS_AS(TableUtilities::checkNonUniqueLabels({"a", "a"}),
                     NonUniqueLabels);
@@ -24,6 +24,15 @@
 #include "ComponentsForTesting.h"
 
 #include <OpenSim/Common/CommonUtilities.h>
+#include <OpenSim/Common/Constant.h>
+#include <OpenSim/Common/GCVSpline.h>
+#include <OpenSim/Common/LinearFunction.h>
+#include <OpenSim/Common/MultiplierFunction.h>
+#include <OpenSim/Common/PiecewiseConstantFunction.h>
+#include <OpenSim/Common/PiecewiseLinearFunction.h>
+#include <OpenSim/Common/PolynomialFunction.h>
+#include <OpenSim/Common/SimmSpline.h>
+#include <OpenSim/Common/PiecewiseVectorFunction.h>
 #include <OpenSim/Common/Reporter.h>
 #include <OpenSim/Common/SignalGenerator.h>
 #include <OpenSim/Common/Sine.h>
@@ -90,6 +99,168 @@ TEST_CASE("Interpolate using PiecewiseLinearFunction") {
     SimTK_TEST(SimTK::isNaN(newY[3]));
 }
 
+TEST_CASE("PiecewiseVectorFunction matches scalar functions") {
+    // Unevenly spaced knots and a few channels of smooth data.
+    const int n = 25;
+    const int numChannels = 4;
+    SimTK::Vector x(n);
+    SimTK::Matrix y(n, numChannels);
+    for (int i = 0; i < n; ++i) {
+        x[i] = 0.1 * i + 0.02 * std::sin(3.0 * i);
+        for (int c = 0; c < numChannels; ++c)
+            y(i, c) = std::cos((c + 1) * x[i]) + 0.5 * c;
+    }
+
+    std::vector<std::unique_ptr<Function>> linears;
+    std::vector<std::unique_ptr<Function>> splines;
+    std::vector<const Function*> linearPtrs;
+    std::vector<const Function*> splinePtrs;
+    for (int c = 0; c < numChannels; ++c) {
+        const SimTK::Vector column = y.col(c);
+        linears.emplace_back(
+                new PiecewiseLinearFunction(n, &x[0], &column[0]));
+        splines.emplace_back(new GCVSpline(3, n, &x[0], &column[0]));
+        linearPtrs.push_back(linears.back().get());
+        splinePtrs.push_back(splines.back().get());
+    }
+
+    PiecewiseVectorFunction linear;
+    PiecewiseVectorFunction spline;
+    REQUIRE(PiecewiseVectorFunction::createFromFunctions(linearPtrs, linear));
+    REQUIRE(PiecewiseVectorFunction::createFromFunctions(splinePtrs, spline));
+    REQUIRE(linear.getNumChannels() == numChannels);
+    REQUIRE(spline.getNumChannels() == numChannels);
+    const auto fittedSpline = PiecewiseVectorFunction::createSpline(3, x, y);
+
+    // Include points outside of the knots, on the knots and in between.
+    std::vector<double> ts{x[0] - 0.3, x[0], x[n - 1], x[n - 1] + 0.3, x[7]};
+    for (int i = 0; i < 200; ++i) ts.push_back(x[0] + i * 0.0123);
+
+    std::vector<double> linearValues(numChannels);
+    std::vector<double> splineValues(numChannels);
+    std::vector<double> fittedValues(numChannels);
+    for (const double t : ts) {
+        linear.calcValue(t, linearValues.data());
+        spline.calcValue(t, splineValues.data());
+        fittedSpline.calcValue(t, fittedValues.data());
+        const SimTK::Vector tv(1, t);
+        for (int c = 0; c < numChannels; ++c) {
+            SimTK_TEST_EQ_TOL(linearValues[c], linears[c]->calcValue(tv),
+                    1e-12);
+            SimTK_TEST_EQ_TOL(splineValues[c], splines[c]->calcValue(tv),
+                    1e-12);
+            SimTK_TEST_EQ_TOL(fittedValues[c], splines[c]->calcValue(tv),
+                    1e-12);
+        }
+        // A subset of the channels.
+        const SimTK::Vec3 last3 = spline.calcVec3(t, 1);
+        for (int c = 1; c < 4; ++c)
+            CHECK(last3[c - 1] == splineValues[c]);
+    }
+
+    // Functions with different knots cannot be combined.
+    SimTK::Vector shifted = x;
+    for (int i = 0; i < n; ++i) shifted[i] += 0.01;
+    const SimTK::Vector column = y.col(0);
+    GCVSpline other(3, n, &shifted[0], &column[0]);
+    PiecewiseVectorFunction combined;
+    CHECK_FALSE(PiecewiseVectorFunction::createFromFunctions(
+            {splinePtrs[0], &other}, combined));
+    CHECK_FALSE(PiecewiseVectorFunction::createFromFunctions(
+            {splinePtrs[0], linearPtrs[1]}, combined));
+}
+
+TEST_CASE("PiecewiseVectorFunction derivatives match scalar functions") {
+    const int n = 30;
+    const int numChannels = 3;
+    SimTK::Vector x(n);
+    SimTK::Matrix y(n, numChannels);
+    for (int i = 0; i < n; ++i) {
+        x[i] = 0.05 * i + 0.01 * std::sin(5.0 * i);
+        for (int c = 0; c < numChannels; ++c)
+            y(i, c) = std::sin((c + 1) * x[i]) - 0.3 * c;
+    }
+
+    std::vector<double> ts{x[0] - 0.2, x[0], x[1], x[n - 2], x[n - 1],
+                           x[n - 1] + 0.2};
+    for (int i = 0; i < 150; ++i) ts.push_back(x[0] + i * 0.0101);
+
+    for (const int degree : {1, 3, 5}) {
+        std::vector<std::unique_ptr<Function>> functions;
+        std::vector<const Function*> functionPtrs;
+        for (int c = 0; c < numChannels; ++c) {
+            const SimTK::Vector column = y.col(c);
+            if (degree == 1)
+                functions.emplace_back(
+                        new PiecewiseLinearFunction(n, &x[0], &column[0]));
+            else
+                functions.emplace_back(
+                        new GCVSpline(degree, n, &x[0], &column[0]));
+            functionPtrs.push_back(functions.back().get());
+        }
+        PiecewiseVectorFunction f;
+        REQUIRE(PiecewiseVectorFunction::createFromFunctions(functionPtrs, f));
+
+        const int maxOrder = degree + 1;
+        std::vector<double> values((maxOrder + 1) * numChannels);
+        std::vector<double> valuesOnly(numChannels);
+        for (const double t : ts) {
+            f.calcValueAndDerivatives(t, maxOrder, values.data());
+            f.calcValue(t, valuesOnly.data());
+            for (int c = 0; c < numChannels; ++c) {
+                CHECK(values[c] == valuesOnly[c]);
+                for (int order = 1; order <= maxOrder; ++order) {
+                    INFO("degree " << degree << ", order " << order <<
+                         ", t " << t);
+                    SimTK_TEST_EQ_TOL(values[order * numChannels + c],
+                            functions[c]->calcDerivative(t, order), 1e-9);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Scalar evaluation matches Vector evaluation") {
+    const int n = 12;
+    SimTK::Vector x(n);
+    SimTK::Vector y(n);
+    for (int i = 0; i < n; ++i) {
+        x[i] = 0.2 * i + 0.03 * std::sin(2.0 * i);
+        y[i] = std::sin(2.0 * x[i]) + 0.1 * i;
+    }
+
+    GCVSpline gcvSpline(5, n, &x[0], &y[0]);
+    SimmSpline simmSpline(n, &x[0], &y[0]);
+    PiecewiseLinearFunction linear(n, &x[0], &y[0]);
+    PiecewiseConstantFunction constant(n, &x[0], &y[0]);
+    MultiplierFunction multiplier(&simmSpline, -1.5);
+    std::vector<const Function*> functions{&gcvSpline, &simmSpline, &linear,
+            &constant, &multiplier};
+    LinearFunction line(0.7, -0.2);
+    PolynomialFunction polynomial(createVector({0.3, -1.2, 0.5, 2.0}));
+    Constant value(4.2);
+    Sine sine(1.5, 2.0, 0.25, 0.1);
+    functions.insert(functions.end(), {&line, &polynomial, &value, &sine});
+
+    // Include points outside of the knots, on the knots and in between.
+    std::vector<double> ts{x[0] - 0.3, x[0], x[n - 1], x[n - 1] + 0.3, x[5]};
+    for (int i = 0; i < 50; ++i) ts.push_back(x[0] - 0.1 + i * 0.051);
+
+    for (const auto* f : functions) {
+        INFO(f->getConcreteClassName());
+        for (const double t : ts) {
+            const SimTK::Vector tv(1, t);
+            CHECK(f->calcValue(t) == f->calcValue(tv));
+            CHECK(f->calcDerivative(t, 0) == f->calcValue(tv));
+            for (int order = 1; order <= 2; ++order) {
+                CHECK(f->calcDerivative(t, order) ==
+                      Approx(f->calcDerivative(std::vector<int>(order, 0), tv))
+                              .epsilon(1e-14));
+            }
+        }
+    }
+}
+
 TEST_CASE("solveBisection()") {
 
     auto calcResidual = [](const SimTK::Real& x) { return x - 3.78; };
@@ -22,6 +22,7 @@
 
 #include "OpenSim/Common/Adapters.h"
 #include "OpenSim/Common/CommonUtilities.h"
+#include <cctype>
 #include <cstdio>
 #include <fstream>
 #include <unordered_set>
@@ -353,3 +354,61 @@ TEST_CASE("Trimming whitespace in metadata values") {
 
 
 
+
+TEST_CASE("In-place tokenizing and parsing match string-based versions") {
+    const std::vector<std::string> lines{"0.1\t1.5\t-2e-3",
+                                         " 0.2 \t 3 \t4\t",
+                                         "0.3\t\t5",
+                                         "\t",
+                                         "0.4,nan,inf"};
+    std::vector<FileAdapter::TextRange> tokens{};
+    for(const auto& line : lines) {
+        for(const std::string delims : {"\t", ",", "\t,"}) {
+            const auto expected = FileAdapter::tokenize(line, delims);
+            FileAdapter::TextRange range{line.data(),
+                                         line.data() + line.size()};
+            FileAdapter::tokenize(range, delims, tokens);
+            REQUIRE(tokens.size() == expected.size());
+            for(size_t i = 0; i < tokens.size(); ++i) {
+                CHECK(tokens[i].str() == expected[i]);
+                if(expected[i].empty()) {
+                    CHECK_THROWS_AS(FileAdapter::parseDouble(tokens[i]),
+                                    std::invalid_argument);
+                } else if(std::isdigit(expected[i].back())) {
+                    CHECK(FileAdapter::parseDouble(tokens[i]) ==
+                          std::stod(expected[i]));
+                }
+            }
+        }
+    }
+
+    const std::string tiny{"1e-400"};
+    CHECK_THROWS_AS(FileAdapter::parseDouble({tiny.data(),
+                                              tiny.data() + tiny.size()}),
+                    std::out_of_range);
+    const std::string word{"abc"};
+    CHECK_THROWS_AS(FileAdapter::parseDouble({word.data(),
+                                              word.data() + word.size()}),
+                    std::invalid_argument);
+}
+
+TEST_CASE("Reading STO files with CRLF line endings and trailing lines") {
+    const std::string filename = "testing_crlf.sto";
+    {
+        std::ofstream out{filename, std::ios::binary};
+        out << "header\r\nversion=1\r\nendheader\r\n"
+            << "time\ta\tb\r\n"
+            << "0.0\t1.25\t-3\r\n"
+            << "0.5\t 2.5 \t1e-3\r\n"
+            << "\r\n"
+            << "this line follows the end of the data\r\n";
+    }
+    TimeSeriesTable table(filename);
+    REQUIRE(table.getNumRows() == 2);
+    REQUIRE(table.getNumColumns() == 2);
+    CHECK(table.getIndependentColumn()[1] == 0.5);
+    CHECK(table.getRowAtIndex(0)[0] == 1.25);
+    CHECK(table.getRowAtIndex(0)[1] == -3);
+    CHECK(table.getRowAtIndex(1)[0] == 2.5);
+    CHECK(table.getRowAtIndex(1)[1] == std::stod("1e-3"));
+}
@@ -43,6 +43,7 @@
 #include <ctime>
 #include <fstream>
 #include <string>
+#include <vector>
 #include <stdio.h>
 
 
@@ -1132,6 +1133,60 @@ void testMonotonicity(SimTK::Matrix mcfSample)
     cout << endl;
 }
 
+/*
+ 5. The precompiled curve will be compared against the Bezier curve it was
+    precompiled from, and its batch evaluation against the scalar one.
+*/
+void testPrecompiledMuscleCurve(SmoothSegmentedFunction mcf,
+                                SimTK::Matrix mcfSample)
+{
+    cout << "   TEST: Precompiled curve " << endl;
+    SimTK_TEST(!mcf.isPrecompiled());
+    SimTK_TEST_MUST_THROW(mcf.precompile(0.0, 1e-6));
+
+    double valueTol = 1e-9;
+    double slopeTol = 1e-6;
+    mcf.precompile(valueTol, slopeTol);
+    SimTK_TEST(mcf.isPrecompiled());
+    SimTK::Vec3 maxError = mcf.getPrecompiledMaxError();
+    SimTK_TEST(maxError(0) <= valueTol);
+    SimTK_TEST(maxError(1) <= slopeTol);
+
+    //The sampled errors are not strict bounds on the error between samples.
+    int n = mcfSample.nrow();
+    std::vector<double> x(n), y(n), dydx(n), d2ydx2(n);
+    for(int i=0; i<n; i++){
+        x[i] = mcfSample(i,0);
+        SimTK_TEST_EQ_TOL(mcf.calcValue(x[i]),       mcfSample(i,1),
+                          10*valueTol);
+        SimTK_TEST_EQ_TOL(mcf.calcDerivative(x[i],1), mcfSample(i,2),
+                          10*slopeTol);
+        SimTK_TEST_EQ_TOL(mcf.calcDerivative(x[i],2), mcfSample(i,3),
+                          10*maxError(2) + 1e-9);
+    }
+
+    //The batch evaluation must match the scalar evaluation exactly.
+    mcf.calcValueAndDerivatives(n, &x[0], &y[0], &dydx[0], &d2ydx2[0]);
+    for(int i=0; i<n; i++){
+        SimTK_TEST(y[i]      == mcf.calcValue(x[i]));
+        SimTK_TEST(dydx[i]   == mcf.calcDerivative(x[i],1));
+        SimTK_TEST(d2ydx2[i] == mcf.calcDerivative(x[i],2));
+    }
+    std::vector<double> yOnly(n);
+    mcf.calcValueAndDerivatives(n, &x[0], &yOnly[0], nullptr, nullptr);
+    SimTK_TEST(yOnly == y);
+
+    //Copies keep the precompiled curve.
+    SmoothSegmentedFunction copy(mcf);
+    SimTK_TEST(copy.isPrecompiled());
+    SimTK_TEST(copy.calcValue(x[n/2]) == mcf.calcValue(x[n/2]));
+
+    printf("   passed: precompiled curve is within %e (value), %e (slope)\n"
+           "           and %e (curvature) of the Bezier curve\n",
+           maxError(0), maxError(1), maxError(2));
+    cout << endl;
+}
+
 //______________________________________________________________________________
 /**
  * Create a muscle bench marking system. The bench mark consists of a single muscle 
@@ -1217,6 +1272,7 @@ int main(int argc, char* argv[])
 
         //3. Test numerically to see if the curve is C2 continuous
             testMuscleCurveC2Continuity(tendonCurve,tendonCurveSample);
+            testPrecompiledMuscleCurve(tendonCurve,tendonCurveSample);
         //4. Test for monotonicity where appropriate
             testMonotonicity(tendonCurveSample);
 
@@ -1286,6 +1342,7 @@ int main(int argc, char* argv[])
 
         //3. Test numerically to see if the curve is C2 continuous
             testMuscleCurveC2Continuity(fiberFLCurve,fiberFLCurveSample);
+            testPrecompiledMuscleCurve(fiberFLCurve,fiberFLCurveSample);
         //4. Test for monotonicity where appropriate
 
             testMonotonicity(fiberFLCurveSample);
@@ -1582,6 +1639,7 @@ int main(int argc, char* argv[])
 
         //3. Test numerically to see if the curve is C2 continuous
             testMuscleCurveC2Continuity(fiberFVCurve,fiberFVCurveSample);
+            testPrecompiledMuscleCurve(fiberFVCurve,fiberFVCurveSample);
         //4. Test for monotonicity where appropriate
 
             testMonotonicity(fiberFVCurveSample);
@@ -1842,6 +1900,7 @@ int main(int argc, char* argv[])
 
         //3. Test numerically to see if the curve is C2 continuous
             testMuscleCurveC2Continuity(fiberfalCurve,fiberfalCurveSample);
+            testPrecompiledMuscleCurve(fiberfalCurve,fiberfalCurveSample);
 
             //fiberfalCurve.MuscleCurveToCSVFile("C:/mjhmilla/Stanford/dev");
        
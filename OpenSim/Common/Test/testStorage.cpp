@@ -24,6 +24,7 @@
 #include <OpenSim/Common/Storage.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
 #include <OpenSim/Common/STOFileAdapter.h>
+#include <OpenSim/Common/Signal.h>
 
 using namespace OpenSim;
 using namespace std;
@@ -170,6 +171,96 @@ void testStorageGetStateIndexBackwardsCompatibility() {
     // TODO: Put XML document version in Storage header.
 }
 
+void testStorageDataMatrix() {
+    const int nr = 50;
+    Storage st;
+    Array<std::string> labels("", 4);
+    labels[0] = "time"; labels[1] = "a"; labels[2] = "b"; labels[3] = "c";
+    st.setColumnLabels(labels);
+    for (int i = 0; i < nr; ++i) {
+        const double t = 0.01 * i;
+        st.append(t, SimTK::Vec3(sin(10*t), cos(7*t), t*t));
+    }
+
+    auto assertEqual = [](const SimTK::MatrixBase<double>& expected,
+                          const SimTK::MatrixBase<double>& found) {
+        ASSERT(found.nrow() == expected.nrow());
+        ASSERT(found.ncol() == expected.ncol());
+        for (int i = 0; i < expected.nrow(); ++i)
+            for (int j = 0; j < expected.ncol(); ++j)
+                ASSERT(found(i, j) == expected(i, j));
+    };
+
+    // The matrix holds the same data as the columns.
+    const SimTK::Matrix data = st.getDataMatrix();
+    ASSERT(data.nrow() == nr && data.ncol() == 3);
+    Array<double> column;
+    for (int j = 0; j < 3; ++j) {
+        st.getDataColumn(j, column);
+        for (int i = 0; i < nr; ++i) ASSERT(data(i, j) == column[i]);
+    }
+    ASSERT(st.getDataMatrix(2).ncol() == 2);
+    assertEqual(data, st.exportToTable().getMatrix());
+
+    // Filtering the matrix gives the same result as filtering each column.
+    Storage filtered(st);
+    filtered.lowpassIIR(6.0);
+    SimTK::Vector_<double> expected(nr);
+    for (int j = 0; j < 3; ++j) {
+        st.getDataColumn(j, column);
+        Signal::LowpassIIR(st.getMinTimeStep(), 6.0, nr, column.get(),
+                &expected[0]);
+        filtered.getDataColumn(j, column);
+        for (int i = 0; i < nr; ++i) ASSERT(column[i] == expected[i]);
+    }
+
+    // Padding.
+    Storage padded(st);
+    padded.pad(5);
+    ASSERT(padded.getSize() == nr + 10);
+    ASSERT_EQUAL(-0.05, padded.getFirstTime(), 1e-12);
+    for (int j = 0; j < 3; ++j) {
+        st.getDataColumn(j, column);
+        const std::vector<double> paddedColumn =
+                Signal::Pad(5, nr, column.get());
+        padded.getDataColumn(j, column);
+        for (int i = 0; i < nr + 10; ++i)
+            ASSERT(column[i] == paddedColumn[i]);
+    }
+
+    // Linear resampling gives the same values as interpolating each time,
+    // including past the last time.
+    Storage resampled(st);
+    resampled.resampleLinear(0.0075);
+    ASSERT(resampled.getSize() == 67);
+    ASSERT(resampled.getColumnLabels() == labels);
+    const SimTK::Matrix resampledData = resampled.getDataMatrix();
+    SimTK::Vector interpolated(3);
+    for (int i = 0; i < resampled.getSize(); ++i) {
+        double t;
+        resampled.getTime(i, t);
+        ASSERT_EQUAL(0.0075 * i, t, 1e-12);
+        st.getDataAtTime(t, 3, interpolated);
+        for (int j = 0; j < 3; ++j)
+            ASSERT_EQUAL(interpolated[j], resampledData(i, j), 1e-12);
+    }
+
+    // Replacing all the rows.
+    Storage replaced(st);
+    SimTK::Matrix scaled = 2 * data;
+    std::vector<double> times(nr);
+    for (int i = 0; i < nr; ++i) st.getTime(i, times[i]);
+    replaced.replaceData(times, scaled);
+    ASSERT(replaced.getSize() == nr);
+    ASSERT(replaced.getColumnLabels() == labels);
+    assertEqual(scaled, replaced.getDataMatrix());
+    ASSERT_THROW(InvalidArgument,
+            replaced.replaceData(std::vector<double>(nr - 1), scaled));
+
+    replaced.setDataMatrix(data);
+    assertEqual(data, replaced.getDataMatrix());
+}
+
 int main() {
     SimTK_START_TEST("testStorage");
 
@@ -194,6 +285,8 @@ int main() {
         SimTK_SUBTEST(testStorageLegacy);
 
         SimTK_SUBTEST(testStorageGetStateIndexBackwardsCompatibility);
+
+        SimTK_SUBTEST(testStorageDataMatrix);
     SimTK_END_TEST();
 }
 
@@ -164,7 +164,7 @@ public:
         catch (std::exception&) {
             // wipe out the data loaded if any
             this->_indData.clear();
-            this->_depData.clear();
+            this->resizeDependentData(0, 0);
             this->removeDependentsMetaDataForKey("labels");
             throw;
         }
@@ -188,7 +188,7 @@ public:
         catch (std::exception&) {
             // wipe out the data loaded if any
             this->_indData.clear();
-            this->_depData.clear(); // should be empty
+            this->resizeDependentData(0, 0); // should be empty
             this->removeDependentsMetaDataForKey("labels"); // should be empty
             throw;
         }
@@ -504,7 +504,7 @@ protected:
         SimTK::Matrix_<ETY> matrixBlock = this->updMatrix()((int)start_index, 0,
                 (int)(last_index - start_index + 1),
                 (int)this->getNumColumns());
-        this->updMatrix() = matrixBlock;
+        this->assignDependentData(matrixBlock);
         std::vector<double> newIndependentVector = std::vector<double>(
                 this->getIndependentColumn().begin() + start_index,
                 this->getIndependentColumn().begin() + last_index + 1);
@@ -31,6 +31,8 @@
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/Model/Actuator.h>
 
+#include <algorithm>
+
 //=============================================================================
 // STATICS
 //=============================================================================
@@ -158,19 +160,120 @@ void PrescribedController::extendConnectToModel(Model& model)
             }// if found in functions, it has already been prescribed
         }// end looping through columns
     }// if no controls storage specified, do nothing
+
+    createControlGroups();
+}
+
+void PrescribedController::createControlGroups()
+{
+    _controlGroups.clear();
+    _individualControls.clear();
+
+    const auto& actuators = getActuatorSet();
+    const FunctionSet& functions = get_ControlFunctions();
+    if (functions.getSize() < actuators.getSize()) return;
+    for (int i = 0; i < actuators.getSize(); ++i)
+        if (actuators[i].numControls() != 1) return;
+
+    // Add each function to the first group whose functions it can be combined
+    // with, comparing it with the group's first function only.
+    std::vector<std::vector<const Function*>> groupFunctions;
+    std::vector<std::vector<int>> groupActuators;
+    PiecewiseVectorFunction combined;
+    for (int i = 0; i < actuators.getSize(); ++i) {
+        const Function* function = &functions[i];
+        if (!PiecewiseVectorFunction::createFromFunctions({function},
+                                                          combined)) {
+            _individualControls.push_back(i);
+            continue;
+        }
+        size_t g = 0;
+        for (; g < groupFunctions.size(); ++g) {
+            if (PiecewiseVectorFunction::createFromFunctions(
+                    {groupFunctions[g][0], function}, combined))
+                break;
+        }
+        if (g == groupFunctions.size()) {
+            groupFunctions.emplace_back();
+            groupActuators.emplace_back();
+        }
+        groupFunctions[g].push_back(function);
+        groupActuators[g].push_back(i);
+    }
+
+    for (size_t g = 0; g < groupFunctions.size(); ++g) {
+        ControlGroup group;
+        if (PiecewiseVectorFunction::createFromFunctions(groupFunctions[g],
+                                                         group.function)) {
+            group.actuators = std::move(groupActuators[g]);
+            for (const Function* function : groupFunctions[g]) {
+                group.definitionVersions.push_back(
+                        function->getDefinitionVersion());
+            }
+            _controlGroups.push_back(std::move(group));
+        } else {
+            _individualControls.insert(_individualControls.end(),
+                    groupActuators[g].begin(), groupActuators[g].end());
+        }
+    }
 }
 
+bool PrescribedController::useControlGroups() const
+{
+    if ((_controlGroups.empty() && _individualControls.empty()) ||
+            !isObjectUpToDateWithProperties())
+        return false;
+
+    // The definition versions are unique, so they also tell whether a
+    // function was replaced.
+    const FunctionSet& functions = get_ControlFunctions();
+    for (const auto& group : _controlGroups) {
+        for (size_t c = 0; c < group.actuators.size(); ++c) {
+            const int i = group.actuators[c];
+            if (i >= functions.getSize() ||
+                    functions[i].getDefinitionVersion() !=
+                            group.definitionVersions[c])
+                return false;
+        }
+    }
+    return true;
+}
 
 // compute the control value for an actuator
 void PrescribedController::computeControls(const SimTK::State& s, SimTK::Vector& controls) const
 {
-    SimTK::Vector actControls(1, 0.0);
-    SimTK::Vector time(1, s.getTime());
+    const auto& actuators = getActuatorSet();
+    const double time = s.getTime();
 
-    for(int i=0; i<getActuatorSet().getSize(); i++){
-        actControls[0] = get_ControlFunctions()[i].calcValue(time);
-        getActuatorSet()[i].addInControls(actControls, controls);
-    }  
+    if (!useControlGroups()) {
+        SimTK::Vector actControls(1, 0.0);
+        for(int i=0; i<actuators.getSize(); i++){
+            actControls[0] = get_ControlFunctions()[i].calcValue(time);
+            actuators[i].addInControls(actControls, controls);
+        }
+        return;
+    }
+
+    // Evaluate the channels of each group in blocks, and add them directly
+    // into the model controls.
+    const int blockSize = 64;
+    double values[blockSize];
+    for (const auto& group : _controlGroups) {
+        const int numChannels = group.function.getNumChannels();
+        for (int first = 0; first < numChannels; first += blockSize) {
+            const int count = std::min(blockSize, numChannels - first);
+            group.function.calcValue(time, first, count, values);
+            for (int k = 0; k < count; ++k) {
+                const Actuator& actuator =
+                        actuators[group.actuators[first + k]];
+                controls[actuator._controlIndex] += values[k];
+            }
+        }
+    }
+    for (int i : _individualControls) {
+        controls[actuators[i]._controlIndex] +=
+                get_ControlFunctions()[i].calcValue(time);
+    }
 }
 
 
@@ -191,6 +294,10 @@ void PrescribedController::
     if(index >= get_ControlFunctions().getSize())
         upd_ControlFunctions().setSize(index+1);
     upd_ControlFunctions().set(index, prescribedFunction);  
+
+    // The groups are recreated when the controller is next connected.
+    _controlGroups.clear();
+    _individualControls.clear();
 }
 
 void PrescribedController::
@@ -25,6 +25,7 @@
 
 #include "Controller.h"
 #include <OpenSim/Common/FunctionSet.h>
+#include <OpenSim/Common/PiecewiseVectorFunction.h>
 
 
 namespace OpenSim { 
@@ -130,6 +131,34 @@ private:
     // This method sets all member variables to default (e.g., NULL) values.
     void setNull();
 
+    // Group the control functions that can be evaluated together.
+    void createControlGroups();
+
+    /** Control functions that are all PiecewiseLinearFunction or all GCVSpline
+    over the same times (e.g., those created from a controls file), combined
+    into a single function of time so that the time interval is located once
+    for all of them. **/
+    struct ControlGroup {
+        PiecewiseVectorFunction function;
+        /** Index in the actuator set of the actuator for each channel. **/
+        std::vector<int> actuators;
+        /** The definition version (Function::getDefinitionVersion()) of the
+        control function of each channel when the group was created. **/
+        std::vector<unsigned long long> definitionVersions;
+    };
+    std::vector<ControlGroup> _controlGroups;
+    /** Index in the actuator set of the actuators whose control function is
+    evaluated on its own. **/
+    std::vector<int> _individualControls;
+
+    /** Whether _controlGroups and _individualControls can be used in place of
+    the functions in the properties. The groups hold copies of the functions,
+    so they are not used once the properties may have been edited (e.g.,
+    through upd_ControlFunctions()), or a grouped function has been modified
+    or replaced (its definition version has changed), until the controller is
+    connected again. **/
+    bool useControlGroups() const;
+
 //=============================================================================
 };  // END of class PrescribedController
 
@@ -25,6 +25,11 @@
 #include "Model/Model.h"
 #include <OpenSim/Common/FunctionSet.h>
 
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <thread>
+
 using namespace std;
 using namespace SimTK;
 
@@ -130,15 +135,90 @@ void InverseDynamicsSolver::solve(SimTK::State &s, const FunctionSet &Qs, const
     int nq = getModel().getNumCoordinates();
     int nt = times.size();
 
+    if(Qs.getSize() != nq){
+        throw Exception("InverseDynamicsSolver::solve invalid number of q functions.");
+    }
+
+    if( nq != getModel().getNumSpeeds()){
+        throw Exception("InverseDynamicsSolver::solve using FunctionSet, nq != nu not supported.");
+    }
+
     //Preallocate if not done already
     genForceTrajectory.resize(nt, Vector(nq));
-    
+    if(nt == 0) return;
+
     AnalysisSet& analysisSet = const_cast<AnalysisSet&>(getModel().getAnalysisSet());
-    //fill in results for each time
-    for(int i=0; i<nt; i++){ 
-        genForceTrajectory[i] = solve(s, Qs, times[i]);
-        analysisSet.step(s, i);
+    int numThreads = std::max(1, std::min(_numThreads, nt));
+    if(numThreads > 1 && analysisSet.getSize() > 0){
+        log_warn("InverseDynamicsSolver: the model has analyses, which must "
+                 "be stepped in time order. Solving on a single thread.");
+        numThreads = 1;
     }
+
+    if(numThreads == 1){
+        //fill in results for each time
+        for(int i=0; i<nt; i++){ 
+            genForceTrajectory[i] = solve(s, Qs, times[i]);
+            analysisSet.step(s, i);
+        }
+        return;
+    }
+
+    // Split the times into contiguous chunks. The first is solved on this
+    // thread, and each of the others on its own thread with its own copy of
+    // the model, since computing the applied forces (e.g., wrapping the paths
+    // of muscles) updates data held by the components of the model. Every
+    // time is solved exactly as on a single thread, with the coordinate
+    // functions evaluated one at a time by solve(s, Qs, time), so the result
+    // does not depend on the number of threads.
+    const int chunkSize = (nt + numThreads - 1) / numThreads;
+    const int numChunks = (nt + chunkSize - 1) / chunkSize;
+
+    // Functions may create their data the first time they are evaluated;
+    // make sure that this does not happen concurrently.
+    for(int i=0; i<nq; i++) Qs.evaluate(i, 0, times[0]);
+
+    // The copies are created on this thread, and their states take the
+    // values (including which forces are applied) of the given state.
+    std::vector<std::unique_ptr<Model>> models(numChunks);
+    std::vector<SimTK::State*> states(numChunks, &s);
+    for(int t=1; t<numChunks; t++){
+        models[t].reset(getModel().clone());
+        SimTK::State& state = models[t]->initSystem();
+        models[t]->setStateVariableValues(state,
+                getModel().getStateVariableValues(s));
+        for(const Force& force : getModel().getComponentList<Force>()){
+            models[t]->getComponent<Force>(force.getAbsolutePath())
+                    .setAppliesForce(state, force.appliesForce(s));
+        }
+        states[t] = &state;
+    }
+
+    std::vector<std::exception_ptr> errors(numChunks);
+    auto solveChunk = [&](int t) {
+        try {
+            std::unique_ptr<InverseDynamicsSolver> copy;
+            if(t > 0) copy.reset(new InverseDynamicsSolver(*models[t]));
+            InverseDynamicsSolver& solver = t > 0 ? *copy : *this;
+            SimTK::State& state = *states[t];
+            const int end = std::min(nt, (t + 1) * chunkSize);
+            for(int i=t*chunkSize; i<end; i++){
+                genForceTrajectory[i] = solver.solve(state, Qs, times[i]);
+            }
+        } catch (...) {
+            errors[t] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> workers;
+    for(int t=1; t<numChunks; t++) workers.emplace_back(solveChunk, t);
+    solveChunk(0);
+    for(auto& worker : workers) worker.join();
+    for(const auto& error : errors){
+        if(error) std::rethrow_exception(error);
+    }
+
+    // Leave the state at the last time, as when solving on a single thread.
+    solve(s, Qs, times[nt-1]);
 }
 
 } // end of namespace OpenSim
\ No newline at end of file
@@ -58,6 +58,8 @@ OpenSim_DECLARE_CONCRETE_OBJECT(InverseDynamicsSolver, Solver);
 // MEMBER VARIABLES
 //=============================================================================
 protected:
+    /** Number of threads used to solve a trajectory.                         */
+    int _numThreads{1};
 
 //=============================================================================
 // METHODS
@@ -68,6 +70,16 @@ public:
     //--------------------------------------------------------------------------
     /** Construct an InverseDynamics solver applied to the provided model */
     InverseDynamicsSolver(const Model& model);
+
+    /** Set the number of threads used to solve for a trajectory of
+        generalized forces (default is 1). With more than one thread, the
+        times are split into contiguous chunks that are solved concurrently,
+        each (but the first) with its own copy of the model; the result does
+        not depend on the number of threads. The trajectory is solved
+        on the calling thread if the model has analyses, since those must be
+        stepped in time order. */
+    void setNumThreads(int numThreads) { _numThreads = numThreads; }
+    int getNumThreads() const { return _numThreads; }
     
     /** Solve the inverse dynamics system of equations for generalized 
         coordinate forces, Tau. Applied loads are computed by the model  
@@ -94,7 +106,8 @@ public:
     virtual SimTK::Vector solve(SimTK::State& s, const FunctionSet& Qs, double time);
 #ifndef SWIG
     /** Same as above but for a given time series populate an Array (trajectory) of
-        generalized-coordinate forces (Vector) */
+        generalized-coordinate forces (Vector). See setNumThreads() to solve
+        the times in parallel. */
     virtual void solve(SimTK::State& s, const FunctionSet& Qs, 
                  const SimTK::Array_<double>&  times,
                  SimTK::Array_<SimTK::Vector>& genForceTrajectory);
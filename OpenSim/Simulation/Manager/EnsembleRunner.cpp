@@ -0,0 +1,188 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  EnsembleRunner.cpp                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "EnsembleRunner.h"
+#include <OpenSim/Common/Reporter.h>
+#include <OpenSim/Common/STOFileAdapter.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/StatesTrajectoryReporter.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace OpenSim;
+
+namespace {
+// Split "<component path>|<name>" at the last '|'.
+std::pair<std::string, std::string> splitPath(const std::string& path) {
+    const auto pos = path.rfind('|');
+    OPENSIM_THROW_IF(pos == std::string::npos, Exception,
+            "Expected '<component path>|<name>', but got '" + path + "'.");
+    return {path.substr(0, pos), path.substr(pos + 1)};
+}
+
+Component& updComponentOrModel(Model& model, const std::string& path) {
+    if (path.empty() || path == "/") return model;
+    return model.updComponent(path);
+}
+}
+
+//=============================================================================
+// CONSTRUCTOR(S)
+//=============================================================================
+EnsembleRunner::EnsembleRunner(const Model& model) : _model(model.clone()) {
+    setNumThreads(int(std::thread::hardware_concurrency()));
+}
+
+EnsembleRunner::~EnsembleRunner() = default;
+
+void EnsembleRunner::setNumThreads(int numThreads) {
+    _numThreads = std::max(1, numThreads);
+}
+
+//=============================================================================
+// RUNS
+//=============================================================================
+void EnsembleRunner::addRun(const Run& run) {
+    for (const auto& other : _runs) {
+        OPENSIM_THROW_IF(other.name == run.name, Exception,
+                "There is already a run named '" + run.name + "'.");
+    }
+    _runs.push_back(run);
+}
+
+void EnsembleRunner::addRunsFromTable(const TimeSeriesTable& table) {
+    const auto& labels = table.getColumnLabels();
+    for (int row = 0; row < int(table.getNumRows()); ++row) {
+        Run run;
+        run.name = "run_" + std::to_string(row);
+        const auto values = table.getRowAtIndex(row);
+        for (int col = 0; col < int(labels.size()); ++col) {
+            const std::string& label = labels[col];
+            if (label.find('|') != std::string::npos) {
+                const auto path = splitPath(label);
+                run.propertyValues.push_back(
+                        {path.first, path.second, values[col]});
+            } else {
+                run.stateValues.push_back({label, values[col]});
+            }
+        }
+        addRun(run);
+    }
+}
+
+//=============================================================================
+// RUNNING
+//=============================================================================
+std::vector<EnsembleRunner::Result> EnsembleRunner::run() const {
+    std::vector<Result> results(_runs.size());
+    const int numThreads = std::min(_numThreads, int(_runs.size()));
+    log_info("Integrating {} runs on {} threads.", _runs.size(), numThreads);
+
+    // Each thread takes the next run that has not been started.
+    std::atomic<int> nextRun{0};
+    const auto work = [&]() {
+        for (int i = nextRun++; i < int(_runs.size()); i = nextRun++) {
+            Result& result = results[i];
+            result.name = _runs[i].name;
+            try {
+                runOne(_runs[i], result);
+                result.success = true;
+            } catch (const std::exception& e) {
+                result.errorMessage = e.what();
+                log_warn("Run '{}' failed: {}", result.name, e.what());
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for (int t = 1; t < numThreads; ++t) workers.emplace_back(work);
+    work();
+    for (auto& worker : workers) worker.join();
+    return results;
+}
+
+void EnsembleRunner::runOne(const Run& run, Result& result) const {
+    // The original model is not modified while the runs are in progress, so
+    // the runs can copy it concurrently.
+    std::unique_ptr<Model> model(_model->clone());
+    // The copied analyses still refer to the original model.
+    model->updAnalysisSet().setModel(*model);
+
+    for (const auto& propertyValue : run.propertyValues) {
+        Component& component =
+            updComponentOrModel(*model, propertyValue.componentPath);
+        AbstractProperty& property =
+            component.updPropertyByName(propertyValue.propertyName);
+        OPENSIM_THROW_IF(!Property<double>::isA(property), Exception,
+                "Property '" + propertyValue.propertyName + "' of '" +
+                component.getAbsolutePathString() + "' is not a double.");
+        Property<double>::updAs(property).setValue(propertyValue.value);
+    }
+    if (run.editModel) run.editModel(*model);
+
+    auto* statesReporter = new StatesTrajectoryReporter();
+    statesReporter->setName("ensemble_states_reporter");
+    statesReporter->set_report_time_interval(_reportingInterval);
+    model->addComponent(statesReporter);
+    TableReporter* outputsReporter = nullptr;
+    if (!_outputPaths.empty()) {
+        outputsReporter = new TableReporter();
+        outputsReporter->setName("ensemble_outputs_reporter");
+        outputsReporter->set_report_time_interval(_reportingInterval);
+        model->addComponent(outputsReporter);
+        for (const auto& outputPath : _outputPaths) {
+            const auto path = splitPath(outputPath);
+            outputsReporter->addToReport(
+                    updComponentOrModel(*model, path.first)
+                            .getOutput(path.second));
+        }
+    }
+
+    SimTK::State& state = model->initSystem();
+    for (const auto& stateValue : run.stateValues)
+        model->setStateVariableValue(state, stateValue.path, stateValue.value);
+    if (run.editState) run.editState(*model, state);
+    state.setTime(_initialTime);
+
+    Manager manager(*model);
+    manager.setIntegratorMethod(_integratorMethod);
+    if (manager.getIntegrator().methodHasErrorControl())
+        manager.setIntegratorAccuracy(_accuracy);
+    manager.initialize(state);
+    manager.integrate(_finalTime);
+
+    const StatesTrajectory& states = statesReporter->getStates();
+    TimeSeriesTable statesTable = states.exportToTable(*model);
+    if (!_resultsDirectory.empty()) {
+        const std::string prefix = _resultsDirectory + "/" + run.name;
+        STOFileAdapter::write(statesTable, prefix + "_states.sto");
+        if (outputsReporter)
+            STOFileAdapter::write(outputsReporter->getTable(),
+                                  prefix + "_outputs.sto");
+        model->updAnalysisSet().printResults(run.name, _resultsDirectory);
+    }
+    if (_keepResultsInMemory) {
+        result.states = states;
+        result.statesTable = std::move(statesTable);
+        if (outputsReporter) result.outputsTable = outputsReporter->getTable();
+    }
+}
@@ -0,0 +1,195 @@
+#ifndef OPENSIM_ENSEMBLE_RUNNER_H_
+#define OPENSIM_ENSEMBLE_RUNNER_H_
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  EnsembleRunner.h                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "Manager.h"
+#include <OpenSim/Common/TimeSeriesTable.h>
+#include <OpenSim/Simulation/StatesTrajectory.h>
+
+#include <functional>
+
+namespace OpenSim {
+
+class Model;
+
+//=============================================================================
+//=============================================================================
+/**
+ * Run an ensemble of forward simulations of one model concurrently, e.g., for
+ * a parameter sweep or a Monte Carlo study. Each run integrates its own copy
+ * of the model, to which the run's changes to properties and to the initial
+ * state are applied. The model is only loaded once, and the runs are handed
+ * out to the worker threads one at a time, so that a thread that finishes a
+ * short run picks up the next one.
+ *
+ * Each run records its states with a StatesTrajectoryReporter and, if any
+ * were added with addOutput(), the values of the given outputs with a
+ * TableReporter. The analyses in the model's AnalysisSet are copied into each
+ * run as well. The results are returned by run() and, if a results directory
+ * is set, also written to files named after the run:
+ * `<run>_states.sto`, `<run>_outputs.sto` and the usual files of each
+ * analysis.
+ *
+ * @code
+ * Model model("arm26.osim");
+ * EnsembleRunner runner(model);
+ * runner.setFinalTime(0.5);
+ * runner.addOutput("/forceset/BIClong|fiber_length");
+ * for (int i = 0; i < 20; ++i) {
+ *     EnsembleRunner::Run run;
+ *     run.name = "run_" + std::to_string(i);
+ *     run.propertyValues.push_back(
+ *             {"/forceset/BIClong", "max_isometric_force", 500.0 + 50 * i});
+ *     run.stateValues.push_back(
+ *             {"/jointset/r_elbow/r_elbow_flex/value", 0.1 * i});
+ *     runner.addRun(run);
+ * }
+ * const auto results = runner.run();
+ * @endcode
+ *
+ * A run that throws an exception does not stop the others; its Result has
+ * `success` false and the message of the exception.
+ */
+class OSIMSIMULATION_API EnsembleRunner {
+public:
+    /** A new value for a property of type double of a component.            */
+    struct PropertyValue {
+        /** Path of the component, relative to the model; empty for the model
+        itself.                                                               */
+        std::string componentPath;
+        std::string propertyName;
+        double value;
+    };
+    /** A new value for a state variable, by its path (e.g.,
+    "/jointset/r_elbow/r_elbow_flex/value").                                  */
+    struct StateValue {
+        std::string path;
+        double value;
+    };
+    /** The changes to the model and to the initial state for one run.        */
+    struct Run {
+        /** Used to name the files of the run; must be unique.                */
+        std::string name;
+        std::vector<PropertyValue> propertyValues;
+        std::vector<StateValue> stateValues;
+        /** Optional: make any other change to the run's copy of the model,
+        after the property values are applied and before the system is
+        created.                                                              */
+        std::function<void(Model&)> editModel;
+        /** Optional: make any other change to the initial state, after the
+        state values are applied.                                             */
+        std::function<void(const Model&, SimTK::State&)> editState;
+    };
+    /** The outcome of one run.                                               */
+    struct Result {
+        std::string name;
+        bool success = false;
+        /** The message of the exception thrown by a failed run.              */
+        std::string errorMessage;
+        /** The recorded states; empty if results are not kept in memory.     */
+        StatesTrajectory states;
+        /** The recorded states, as a table; empty if results are not kept in
+        memory.                                                               */
+        TimeSeriesTable statesTable;
+        /** The values of the outputs added with addOutput(); empty if results
+        are not kept in memory.                                               */
+        TimeSeriesTable outputsTable;
+    };
+
+    /** The model is copied; it does not need to have a system.               */
+    explicit EnsembleRunner(const Model& model);
+    ~EnsembleRunner();
+
+    EnsembleRunner(const EnsembleRunner&) = delete;
+    EnsembleRunner& operator=(const EnsembleRunner&) = delete;
+
+    /** @name Runs */
+    // @{
+    void addRun(const Run& run);
+    /** Add a run for each row of a table. The label of each column is either
+    the path of a state variable, or the path of a component followed by '|'
+    and the name of one of its properties, of type double (e.g.,
+    "/forceset/BIClong|max_isometric_force"). The runs are named "run_<i>",
+    where i is the index of the row.                                          */
+    void addRunsFromTable(const TimeSeriesTable& table);
+    int getNumRuns() const { return int(_runs.size()); }
+    void clearRuns() { _runs.clear(); }
+    // @}
+
+    /** @name Settings */
+    // @{
+    void setInitialTime(double time) { _initialTime = time; }
+    double getInitialTime() const { return _initialTime; }
+    void setFinalTime(double time) { _finalTime = time; }
+    double getFinalTime() const { return _finalTime; }
+    void setIntegratorMethod(Manager::IntegratorMethod method) {
+        _integratorMethod = method;
+    }
+    void setIntegratorAccuracy(double accuracy) { _accuracy = accuracy; }
+    /** The time interval at which the states and outputs are recorded; 0
+    records them at every integration step.                                   */
+    void setReportingInterval(double interval) { _reportingInterval = interval; }
+    double getReportingInterval() const { return _reportingInterval; }
+    /** The number of runs integrated at the same time. The default is the
+    number of hardware threads.                                               */
+    void setNumThreads(int numThreads);
+    int getNumThreads() const { return _numThreads; }
+    /** Record an output of type double, given by the path of its component,
+    '|' and its name (e.g., "/forceset/BIClong|fiber_length").                */
+    void addOutput(const std::string& outputPath) {
+        _outputPaths.push_back(outputPath);
+    }
+    /** If not empty, the results of each run are written to this (existing)
+    directory.                                                                */
+    void setResultsDirectory(const std::string& directory) {
+        _resultsDirectory = directory;
+    }
+    /** If false, the Results returned by run() hold no states or outputs, to
+    save memory when they are written to files instead. The default is
+    true.                                                                     */
+    void setKeepResultsInMemory(bool keep) { _keepResultsInMemory = keep; }
+    // @}
+
+    /** Integrate all the runs; the results are in the order of the runs.    */
+    std::vector<Result> run() const;
+
+private:
+    void runOne(const Run& run, Result& result) const;
+
+    std::unique_ptr<Model> _model;
+    std::vector<Run> _runs;
+    std::vector<std::string> _outputPaths;
+    std::string _resultsDirectory;
+    double _initialTime{0};
+    double _finalTime{1};
+    Manager::IntegratorMethod _integratorMethod{
+            Manager::IntegratorMethod::RungeKuttaMerson};
+    double _accuracy{1e-5};
+    double _reportingInterval{0.01};
+    int _numThreads{1};
+    bool _keepResultsInMemory{true};
+};
+
+} // end of namespace OpenSim
+
+#endif // OPENSIM_ENSEMBLE_RUNNER_H_
@@ -64,6 +64,9 @@ protected:
     // index in Controls Vector shared system cache entry
     int _controlIndex;
 
+    // Writes its controls directly into the model controls.
+    friend class PrescribedController;
+
 //=============================================================================
 // METHODS
 //=============================================================================
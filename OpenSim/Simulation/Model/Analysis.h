@@ -209,6 +209,15 @@ public:
     int getStorageInterval() const;
 #endif
     virtual ArrayPtrs<Storage>& getStorageList();
+    /**
+     * Whether the results recorded for a state depend only on that state and
+     * not on the states recorded before it. If so, a tool may split a
+     * trajectory into windows, analyze each window with its own copy of this
+     * analysis, and concatenate the Storage objects in getStorageList() in
+     * time order (see AnalyzeTool::setNumThreads()). Analyses that carry
+     * information from one step to the next should return false.
+     */
+    virtual bool isOrderIndependent() const { return true; }
     void setPrintResultFiles(bool aToWrite) { _printResultFiles = aToWrite; }
     bool getPrintResultFiles() const { return _printResultFiles; }
 
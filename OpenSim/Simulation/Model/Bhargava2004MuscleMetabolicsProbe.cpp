@@ -28,12 +28,20 @@
 //=============================================================================
 #include "Bhargava2004MuscleMetabolicsProbe.h"
 #include <OpenSim/Simulation/Model/Model.h>
-//#define DEBUG_METABOLICS
+
+#include <algorithm>
 
 using namespace std;
 using namespace SimTK;
 using namespace OpenSim;
 
+namespace {
+// The largest number of muscles handled by one pass of the loops in
+// calcMuscleMetabolicRates(). The slow- and fast-twitch excitations and the
+// four heat and work rates of a block are kept in fixed-size local arrays.
+const int BlockSize = 64;
+}
+
 
 //=============================================================================
 // CONSTRUCTOR(S) AND SETUP
@@ -138,6 +146,112 @@ void Bhargava2004MuscleMetabolicsProbe::extendConnectToModel(Model& aModel)
         connectIndividualMetabolicMuscle(aModel, 
             upd_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet()[i]);
     }
+    bindMetabolicMuscles();
+}
+
+//_____________________________________________________________________________
+/**
+ * Add a channel to the muscle_metabolic_rate output for each muscle in the
+ * MetabolicMuscleParameterSet.
+ */
+void Bhargava2004MuscleMetabolicsProbe::extendFinalizeFromProperties()
+{
+    Super::extendFinalizeFromProperties();
+
+    auto& rateOutput = updOutput("muscle_metabolic_rate");
+    rateOutput.clearChannels();
+    for (int i=0; i<getNumMetabolicMuscles(); ++i) {
+        rateOutput.addChannel(
+            get_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet()[i].getName());
+    }
+}
+
+//_____________________________________________________________________________
+/**
+ * Allocate the cache variable that holds the metabolic power of each muscle.
+ */
+void Bhargava2004MuscleMetabolicsProbe::
+    extendAddToSystem(SimTK::MultibodySystem& system) const
+{
+    Super::extendAddToSystem(system);
+
+    this->_muscleMetabolicRatesCV = addCacheVariable("muscle_metabolic_rates",
+        MuscleMetabolicRates(), SimTK::Stage::Dynamics);
+}
+
+//_____________________________________________________________________________
+/**
+ * Copy the muscle pointers and the parameters used to compute the metabolic
+ * rates from the MetabolicMuscleParameterSet into flat arrays.
+ */
+void Bhargava2004MuscleMetabolicsProbe::
+    fillMetabolicMuscleArrays(MetabolicMuscleArrays& arrays) const
+{
+    const auto& mmSet =
+        get_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet();
+    const int nM = mmSet.getSize();
+
+    arrays.muscles.resize(nM);
+    arrays.muscleMass.resize(nM);
+    arrays.ratioSlowTwitchFibers.resize(nM);
+    arrays.maxIsometricForce.resize(nM);
+    arrays.activationConstantSlowTwitch.resize(nM);
+    arrays.activationConstantFastTwitch.resize(nM);
+    arrays.maintenanceConstantSlowTwitch.resize(nM);
+    arrays.maintenanceConstantFastTwitch.resize(nM);
+    for (int i=0; i<nM; ++i) {
+        const auto& mm = mmSet[i];
+        const Muscle* m = mm.getMuscle();
+        arrays.muscles[i] = m;
+        arrays.muscleMass[i] = m ? mm.calcMuscleMass() : SimTK::NaN;
+        arrays.ratioSlowTwitchFibers[i] = mm.get_ratio_slow_twitch_fibers();
+        arrays.maxIsometricForce[i] =
+            m ? m->getMaxIsometricForce() : SimTK::NaN;
+        arrays.activationConstantSlowTwitch[i] =
+            mm.get_activation_constant_slow_twitch();
+        arrays.activationConstantFastTwitch[i] =
+            mm.get_activation_constant_fast_twitch();
+        arrays.maintenanceConstantSlowTwitch[i] =
+            mm.get_maintenance_constant_slow_twitch();
+        arrays.maintenanceConstantFastTwitch[i] =
+            mm.get_maintenance_constant_fast_twitch();
+    }
+}
+
+
+//_____________________________________________________________________________
+/**
+ * Bind the arrays used to compute the metabolic rates, and index them by
+ * muscle name.
+ */
+void Bhargava2004MuscleMetabolicsProbe::bindMetabolicMuscles()
+{
+    fillMetabolicMuscleArrays(_metabolicMuscles);
+    const auto& mmSet =
+        get_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet();
+    _muscleIndex.clear();
+    for (int i=0; i<mmSet.getSize(); ++i)
+        _muscleIndex[mmSet[i].getName()] = i;
+    ++_parametersVersion;
+}
+
+//_____________________________________________________________________________
+/**
+ * Check that no property that the bound arrays were copied from has been
+ * edited since the probe was connected.
+ */
+bool Bhargava2004MuscleMetabolicsProbe::isBoundToCurrentProperties() const
+{
+    if (!isObjectUpToDateWithProperties()) return false;
+    const auto& mmSet =
+        get_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet();
+    for (int i=0; i<mmSet.getSize(); ++i) {
+        const auto& mm = mmSet[i];
+        if (!mm.isObjectUpToDateWithProperties()) return false;
+        const Muscle* m = mm.getMuscle();
+        if (m && !m->isObjectUpToDateWithProperties()) return false;
+    }
+    return true;
 }
 
 
@@ -249,8 +363,7 @@ SimTK::Vector Bhargava2004MuscleMetabolicsProbe::
 computeProbeInputs(const State& s) const
 {
     // Initialize metabolic energy rate values
-    double Adot, Mdot, Sdot, Bdot, Wdot;
-    Adot = Mdot = Sdot = Bdot = Wdot = 0;
+    double Bdot = 0;
     Vector EdotOutput(getNumProbeInputs());
     EdotOutput = 0;
 
@@ -271,208 +384,275 @@ computeProbeInputs(const State& s) const
         EdotOutput(1) = Bdot;    // BASAL metabolic power storage
 
 
-    // Loop through each muscle in the MetabolicMuscleParameterSet
-    const int nM = 
-        get_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet()
-        .getSize();
-    for (int i=0; i<nM; i++)
+    // TOTAL METABOLIC ENERGY RATE for each muscle in the
+    // MetabolicMuscleParameterSet (W).
+    // ------------------------------------------
+    const Vector& Edot = getMuscleMetabolicRates(s);
+    for (int i=0; i<Edot.size(); ++i)
     {
-        // Get the current muscle parameters from the MetabolicMuscleParameterSet
-        // and the corresponding OpenSim::Muscle pointer from the muscleMap.
-        Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameter& mm = 
-            get_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet()[i];   
-        const Muscle* m = mm.getMuscle();
+        EdotOutput(0) += Edot[i];    // Add to TOTAL metabolic power storage
+        if (!get_report_total_metabolics_only()) {
+            // Metabolic power storage for muscle i
+            EdotOutput(i+2) = Edot[i];
+        }
+    }
 
-        // Get important muscle values at the current time state
-        const double max_isometric_force = m->getMaxIsometricForce();
-        //const double max_shortening_velocity = m->getMaxContractionVelocity();
-        const double activation = get_muscle_effort_scaling_factor()
-                                  * m->getActivation(s);
-        const double excitation = get_muscle_effort_scaling_factor()
-                                  * m->getControl(s);
-        const double fiber_force_passive = m->getPassiveFiberForce(s);
-        const double fiber_force_active = get_muscle_effort_scaling_factor()
-                                          * m->getActiveFiberForce(s);
-        const double fiber_force_total = fiber_force_active     // Scaled.
-                                         + fiber_force_passive;
-        const double fiber_length_normalized = m->getNormalizedFiberLength(s);
-        const double fiber_velocity = m->getFiberVelocity(s);
-        //const double fiber_velocity_normalized = m->getNormalizedFiberVelocity(s);
-        const double slow_twitch_excitation = mm.get_ratio_slow_twitch_fibers() * sin(Pi/2 * excitation);
-        const double fast_twitch_excitation = (1 - mm.get_ratio_slow_twitch_fibers()) * (1 - cos(Pi/2 * excitation));
-        double alpha, fiber_length_dependence;
-
-        // Get the unnormalized total active force, F_iso that 'would' be developed at the current activation
-        // and fiber length under isometric conditions (i.e. Vm=0)
-        const double F_iso = activation * m->getActiveForceLengthMultiplier(s) * max_isometric_force;
-
-        // Warnings
-        if (fiber_length_normalized < 0)
-            log_warn(
-                    "{}  (t = {}), muscle '{}' has negative normalized fiber-length.",
-                    getName(), s.getTime(), m->getName()); 
-
-
-
-        // ACTIVATION HEAT RATE for muscle i (W)
-        // ------------------------------------------
-        if (get_forbid_negative_total_power() || get_activation_rate_on())
-        {
-            const double decay_function_value = 1.0;    // This value is set to 1.0, as used by Anderson & Pandy (1999), however, in
-                                                        // Bhargava et al., (2004) they assume a function here. We will ignore this
-                                                        // function and use 1.0 for now.
-            Adot = mm.getMuscleMass() * decay_function_value * 
-                ( (mm.get_activation_constant_slow_twitch() * slow_twitch_excitation) + (mm.get_activation_constant_fast_twitch() * fast_twitch_excitation) );
+    return EdotOutput;
+}
+
+
+//_____________________________________________________________________________
+/**
+ * Get the metabolic power of each muscle, computing it if it is not already
+ * cached in the state.
+ */
+const SimTK::Vector& Bhargava2004MuscleMetabolicsProbe::
+    getMuscleMetabolicRates(const State& s) const
+{
+    OPENSIM_THROW_IF_FRMOBJ(!isEnabled(), Exception,
+        "Cannot get the muscle metabolic rates because the probe has been "
+        "disabled.");
+
+    // If properties have been edited in place since the probe was connected,
+    // the bound arrays may hold stale values, so the rates are computed from
+    // arrays filled from the current properties, and are not reused. The
+    // parameter setters rebind the arrays without a state, so rates cached
+    // with an earlier binding are recomputed.
+    if (!isBoundToCurrentProperties()) {
+        MetabolicMuscleArrays arrays;
+        fillMetabolicMuscleArrays(arrays);
+        for (const Muscle* m : arrays.muscles) {
+            OPENSIM_THROW_IF_FRMOBJ(!m, Exception,
+                "A muscle of the MetabolicMuscleParameterSet is not "
+                "connected; call initSystem() on the model first.");
+        }
+        MuscleMetabolicRates& mmr =
+            updCacheVariableValue(s, _muscleMetabolicRatesCV);
+        calcMuscleMetabolicRates(s, arrays, mmr.rates);
+        mmr.parametersVersion = -1;
+        markCacheVariableValid(s, _muscleMetabolicRatesCV);
+    } else if (!isCacheVariableValid(s, _muscleMetabolicRatesCV)
+            || getCacheVariableValue(s, _muscleMetabolicRatesCV)
+                .parametersVersion != _parametersVersion) {
+        MuscleMetabolicRates& mmr =
+            updCacheVariableValue(s, _muscleMetabolicRatesCV);
+        calcMuscleMetabolicRates(s, _metabolicMuscles, mmr.rates);
+        mmr.parametersVersion = _parametersVersion;
+        markCacheVariableValid(s, _muscleMetabolicRatesCV);
+    }
+    return getCacheVariableValue(s, _muscleMetabolicRatesCV).rates;
+}
+
+
+//_____________________________________________________________________________
+/**
+ * Get the metabolic power of a single muscle.
+ */
+double Bhargava2004MuscleMetabolicsProbe::
+    getMuscleMetabolicRate(const State& s, const std::string& muscleName) const
+{
+    const auto it = _muscleIndex.find(muscleName);
+    OPENSIM_THROW_IF_FRMOBJ(it == _muscleIndex.end(), Exception,
+        "Muscle '" + muscleName + "' is not in the "
+        "MetabolicMuscleParameterSet.");
+    return getMuscleMetabolicRates(s)[it->second];
+}
+
+
+//_____________________________________________________________________________
+/**
+ * Compute the metabolic power of all the muscles (W). The muscles are
+ * processed in blocks: the muscle quantities of a block are gathered from the
+ * state first, and then each of the rates is computed for the whole block in
+ * a loop over arrays. The loop-invariant options are tested outside of the
+ * loops, and the branches inside the loops select between values.
+ */
+void Bhargava2004MuscleMetabolicsProbe::
+    calcMuscleMetabolicRates(const State& s,
+        const MetabolicMuscleArrays& arrays, Vector& rates) const
+{
+    const int nM = int(arrays.muscles.size());
+    rates.resize(nM);
+
+    const double scale = get_muscle_effort_scaling_factor();
+    const bool activationRateOn = get_activation_rate_on();
+    const bool maintenanceRateOn = get_maintenance_rate_on();
+    const bool shorteningRateOn = get_shortening_rate_on();
+    const bool mechanicalWorkRateOn = get_mechanical_work_rate_on();
+    const bool allHeatRatesOn =
+        activationRateOn && maintenanceRateOn && shorteningRateOn;
+    const bool forbidNegativeTotalPower = get_forbid_negative_total_power();
+    const bool includeNegativeWork = get_include_negative_mechanical_work();
+    const bool enforceMinimumHeatRate =
+        get_enforce_minimum_heat_rate_per_muscle() && allHeatRatesOn;
+    const PiecewiseLinearFunction& fiberLengthDependence =
+        get_normalized_fiber_length_dependence_on_maintenance_rate();
+
+    double activation[BlockSize], excitation[BlockSize];
+    double fiber_force_active[BlockSize], fiber_force_total[BlockSize];
+    double fiber_length_normalized[BlockSize], fiber_velocity[BlockSize];
+    double F_iso[BlockSize];
+    double slow_twitch_excitation[BlockSize], fast_twitch_excitation[BlockSize];
+    double Adot[BlockSize], Mdot[BlockSize], Sdot[BlockSize], Wdot[BlockSize];
+
+    for (int begin = 0; begin < nM; begin += BlockSize) {
+        const int size = std::min(BlockSize, nM - begin);
+
+        // Get important muscle values at the current time state.
+        for (int k = 0; k < size; ++k) {
+            const Muscle& m = *arrays.muscles[begin + k];
+            activation[k] = scale * m.getActivation(s);
+            excitation[k] = scale * m.getControl(s);
+            fiber_force_active[k] = scale * m.getActiveFiberForce(s);
+            fiber_force_total[k] = fiber_force_active[k]    // Scaled.
+                                   + m.getPassiveFiberForce(s);
+            fiber_length_normalized[k] = m.getNormalizedFiberLength(s);
+            fiber_velocity[k] = m.getFiberVelocity(s);
+            F_iso[k] = m.getActiveForceLengthMultiplier(s);
+
+            // Warnings
+            if (fiber_length_normalized[k] < 0)
+                log_warn("{}  (t = {}), muscle '{}' has negative normalized "
+                        "fiber-length.", getName(), s.getTime(), m.getName());
         }
 
+        for (int k = 0; k < size; ++k) {
+            const int i = begin + k;
+            slow_twitch_excitation[k] = arrays.ratioSlowTwitchFibers[i]
+                * sin(Pi/2 * excitation[k]);
+            fast_twitch_excitation[k] = (1 - arrays.ratioSlowTwitchFibers[i])
+                * (1 - cos(Pi/2 * excitation[k]));
+
+            // Get the unnormalized total active force, F_iso that 'would' be
+            // developed at the current activation and fiber length under
+            // isometric conditions (i.e. Vm=0)
+            F_iso[k] = activation[k] * F_iso[k] * arrays.maxIsometricForce[i];
+        }
 
 
-        // MAINTENANCE HEAT RATE for muscle i (W)
+        // ACTIVATION HEAT RATE (W)
         // ------------------------------------------
-        if (get_forbid_negative_total_power() || get_maintenance_rate_on())
-        {
-            Vector tmp(1, fiber_length_normalized);
-            fiber_length_dependence = get_normalized_fiber_length_dependence_on_maintenance_rate().calcValue(tmp);
-            
-            Mdot = mm.getMuscleMass() * fiber_length_dependence * 
-                ( (mm.get_maintenance_constant_slow_twitch() * slow_twitch_excitation) + (mm.get_maintenance_constant_fast_twitch() * fast_twitch_excitation) );
+        if (forbidNegativeTotalPower || activationRateOn) {
+            // The decay function value is set to 1.0, as used by Anderson &
+            // Pandy (1999), however, in Bhargava et al., (2004) they assume a
+            // function here. We will ignore this function and use 1.0 for now.
+            const double decay_function_value = 1.0;
+            for (int k = 0; k < size; ++k) {
+                const int i = begin + k;
+                Adot[k] = arrays.muscleMass[i] * decay_function_value *
+                    ( (arrays.activationConstantSlowTwitch[i]
+                        * slow_twitch_excitation[k])
+                    + (arrays.activationConstantFastTwitch[i]
+                        * fast_twitch_excitation[k]) );
+            }
+        } else {
+            std::fill(Adot, Adot + size, 0.0);
         }
 
 
+        // MAINTENANCE HEAT RATE (W)
+        // ------------------------------------------
+        if (forbidNegativeTotalPower || maintenanceRateOn) {
+            for (int k = 0; k < size; ++k)
+                Mdot[k] = fiberLengthDependence.calcValue(
+                    fiber_length_normalized[k]);
+            for (int k = 0; k < size; ++k) {
+                const int i = begin + k;
+                Mdot[k] = arrays.muscleMass[i] * Mdot[k] *
+                    ( (arrays.maintenanceConstantSlowTwitch[i]
+                        * slow_twitch_excitation[k])
+                    + (arrays.maintenanceConstantFastTwitch[i]
+                        * fast_twitch_excitation[k]) );
+            }
+        } else {
+            std::fill(Mdot, Mdot + size, 0.0);
+        }
+
 
-        // SHORTENING HEAT RATE for muscle i (W)
+        // SHORTENING HEAT RATE (W)
         // --> note that we define Vm<0 as shortening and Vm>0 as lengthening
         // -----------------------------------------------------------------------
-        if (get_forbid_negative_total_power() || get_shortening_rate_on())
-        {
-            if (get_use_force_dependent_shortening_prop_constant())
-            {
-                if (fiber_velocity <= 0)    // concentric contraction, Vm<0
-                    alpha = (0.16 * F_iso) + (0.18 * fiber_force_total);
-                else                        // eccentric contraction, Vm>0
-                    alpha = 0.157 * fiber_force_total;
-            }
-            else
-            {
-                if (fiber_velocity <= 0)    // concentric contraction, Vm<0
-                    alpha = 0.25 * fiber_force_total;
-                else                        // eccentric contraction, Vm>0
-                    alpha = 0.0;
+        if (forbidNegativeTotalPower || shorteningRateOn) {
+            if (get_use_force_dependent_shortening_prop_constant()) {
+                for (int k = 0; k < size; ++k) {
+                    const double alpha = (fiber_velocity[k] <= 0)
+                        ? (0.16 * F_iso[k]) + (0.18 * fiber_force_total[k])
+                        : 0.157 * fiber_force_total[k];
+                    Sdot[k] = -alpha * fiber_velocity[k];
+                }
+            } else {
+                for (int k = 0; k < size; ++k) {
+                    const double alpha = (fiber_velocity[k] <= 0)
+                        ? 0.25 * fiber_force_total[k] : 0.0;
+                    Sdot[k] = -alpha * fiber_velocity[k];
+                }
             }
-            Sdot = -alpha * fiber_velocity;
+        } else {
+            std::fill(Sdot, Sdot + size, 0.0);
         }
-        
 
 
-        // MECHANICAL WORK RATE for the contractile element of muscle i (W).
+        // MECHANICAL WORK RATE for the contractile element (W).
         // --> note that we define Vm<0 as shortening and Vm>0 as lengthening.
         // -------------------------------------------------------------------
-        if (get_forbid_negative_total_power() || get_mechanical_work_rate_on())
-        {
-            if (get_include_negative_mechanical_work() || fiber_velocity <= 0)
-                Wdot = -fiber_force_active*fiber_velocity;
-            else
-                Wdot = 0;
+        if (forbidNegativeTotalPower || mechanicalWorkRateOn) {
+            for (int k = 0; k < size; ++k) {
+                Wdot[k] = (includeNegativeWork || fiber_velocity[k] <= 0)
+                          ? -fiber_force_active[k]*fiber_velocity[k] : 0;
+            }
+        } else {
+            std::fill(Wdot, Wdot + size, 0.0);
         }
 
 
         // NAN CHECKING
         // ------------------------------------------
-        if (isNaN(Adot))
-            log_warn("{} : Adot ({}) = NaN!", getName(), m->getName());
-        if (isNaN(Mdot))
-            log_warn("{} : Mdot ({}) = NaN!", getName(), m->getName());
-        if (isNaN(Sdot))
-            log_warn("{} : Sdot ({}) = NaN!", getName(), m->getName());
-        if (isNaN(Wdot))
-            log_warn("{} : Wdot ({}) = NaN!", getName(), m->getName());
+        for (int k = 0; k < size; ++k) {
+            const std::string& name = arrays.muscles[begin + k]->getName();
+            if (isNaN(Adot[k]))
+                log_warn("{} : Adot ({}) = NaN!", getName(), name);
+            if (isNaN(Mdot[k]))
+                log_warn("{} : Mdot ({}) = NaN!", getName(), name);
+            if (isNaN(Sdot[k]))
+                log_warn("{} : Sdot ({}) = NaN!", getName(), name);
+            if (isNaN(Wdot[k]))
+                log_warn("{} : Wdot ({}) = NaN!", getName(), name);
+        }
 
 
         // If necessary, increase the shortening heat rate so that the total
         // power is non-negative.
-        if (get_forbid_negative_total_power()) {
-            const double Edot_W_beforeClamp = Adot + Mdot + Sdot + Wdot;
-            if (Edot_W_beforeClamp < 0)
-                Sdot -= Edot_W_beforeClamp;
-        }
-
-
-        // This check is adapted from Umberger(2003), page 104: the total heat rate 
-        // (i.e., Adot + Mdot + Sdot) for a given muscle cannot fall below 1.0 W/kg.
-        // -----------------------------------------------------------------------
-        double totalHeatRate = Adot + Mdot + Sdot;      // (W)
-
-        if(get_enforce_minimum_heat_rate_per_muscle() && totalHeatRate < 1.0 * mm.getMuscleMass()
-            && get_activation_rate_on() 
-            && get_maintenance_rate_on() 
-            && get_shortening_rate_on()) {
-                //cout << "WARNING: " << getName() 
-                //    << "  (t = " << s.getTime() 
-                //    << "), the muscle '" << mm.getName() 
-                //    << "' has a net metabolic energy rate of less than 1.0 W/kg." << endl; 
-                totalHeatRate = 1.0 * mm.getMuscleMass();           // not allowed to fall below 1.0 W.kg-1
+        if (forbidNegativeTotalPower) {
+            for (int k = 0; k < size; ++k) {
+                const double Edot_W_beforeClamp =
+                    Adot[k] + Mdot[k] + Sdot[k] + Wdot[k];
+                Sdot[k] -= (Edot_W_beforeClamp < 0) ? Edot_W_beforeClamp
+                           : 0.0;
+            }
         }
 
 
-        // TOTAL METABOLIC ENERGY RATE for muscle i (W)
+        // TOTAL METABOLIC ENERGY RATE (W)
         // ------------------------------------------
-        double Edot = 0;
-
-        if (get_activation_rate_on() && get_maintenance_rate_on()
-            && get_shortening_rate_on())
-        {
-            Edot += totalHeatRate;      // May have been clamped to 1.0 W/kg.
-        } else {
-            if (get_activation_rate_on())
-                Edot += Adot;
-            if (get_maintenance_rate_on())
-                Edot += Mdot;
-            if (get_shortening_rate_on())
-                Edot += Sdot;
+        for (int k = 0; k < size; ++k) {
+            const double muscleMass = arrays.muscleMass[begin + k];
+
+            // This check is adapted from Umberger(2003), page 104: the total
+            // heat rate (i.e., Adot + Mdot + Sdot) for a given muscle cannot
+            // fall below 1.0 W/kg.
+            double totalHeatRate = Adot[k] + Mdot[k] + Sdot[k];
+            if (enforceMinimumHeatRate && totalHeatRate < 1.0 * muscleMass)
+                totalHeatRate = 1.0 * muscleMass;
+
+            const double heatRate = allHeatRatesOn
+                ? totalHeatRate     // May have been clamped to 1.0 W/kg.
+                : (activationRateOn ? Adot[k] : 0)
+                  + (maintenanceRateOn ? Mdot[k] : 0)
+                  + (shorteningRateOn ? Sdot[k] : 0);
+
+            rates[begin + k] = heatRate + (mechanicalWorkRateOn ? Wdot[k] : 0);
         }
-        if (get_mechanical_work_rate_on())
-            Edot += Wdot;
-
-        EdotOutput(0) += Edot;       // Add to TOTAL metabolic power storage
-        if (!get_report_total_metabolics_only()) {
-            // Metabolic power storage for muscle i
-            EdotOutput(i+2) = Edot;  
-        }  
-
-
-
-#ifdef DEBUG_METABOLICS
-        cout << "muscle_mass = " << mm.getMuscleMass() << endl;
-        cout << "ratio_slow_twitch_fibers = " << mm.get_ratio_slow_twitch_fibers() << endl;
-        cout << "activation_constant_slow_twitch = " << mm.get_activation_constant_slow_twitch() << endl;
-        cout << "activation_constant_fast_twitch = " << mm.get_activation_constant_fast_twitch() << endl;
-        cout << "maintenance_constant_slow_twitch = " << mm.get_maintenance_constant_slow_twitch() << endl;
-        cout << "maintenance_constant_fast_twitch = " << mm.get_maintenance_constant_fast_twitch() << endl;
-        cout << "bodymass = " << _model->getMatterSubsystem().calcSystemMass(s) << endl;
-        cout << "max_isometric_force = " << max_isometric_force << endl;
-        cout << "activation = " << activation << endl;
-        cout << "excitation = " << excitation << endl;
-        cout << "fiber_force_total = " << fiber_force_total << endl;
-        cout << "fiber_force_active = " << fiber_force_active << endl;
-        cout << "fiber_length_normalized = " << fiber_length_normalized << endl;
-        cout << "fiber_length_dependence = " << fiber_length_dependence << endl;
-        cout << "fiber_velocity = " << fiber_velocity << endl;
-        cout << "fiber_velocity_normalized = " << fiber_velocity_normalized << endl;
-        cout << "slow_twitch_excitation = " << slow_twitch_excitation << endl;
-        cout << "fast_twitch_excitation = " << fast_twitch_excitation << endl;
-        cout << "max shortening velocity = " << max_shortening_velocity << endl;
-        cout << "alpha = " << alpha << endl;
-        cout << "Adot = " << Adot << endl;
-        cout << "Mdot = " << Mdot << endl;
-        cout << "Sdot = " << Sdot << endl;
-        cout << "Bdot = " << Bdot << endl;
-        cout << "Wdot = " << Wdot << endl;
-        cout << "Edot = " << Edot << endl;
-        std::cin.get();
-#endif
     }
-
-    return EdotOutput;
 }
 
 
@@ -634,6 +814,7 @@ void Bhargava2004MuscleMetabolicsProbe::
     mm->set_use_provided_muscle_mass(true);
     mm->set_provided_muscle_mass(providedMass);
     mm->setMuscleMass();      // actual mass used.
+    bindMetabolicMuscles();
 }
 
 
@@ -650,6 +831,7 @@ void Bhargava2004MuscleMetabolicsProbe::
 
     mm->set_use_provided_muscle_mass(false);
     mm->setMuscleMass();       // actual mass used.
+    bindMetabolicMuscles();
 }
 
 
@@ -696,6 +878,7 @@ void Bhargava2004MuscleMetabolicsProbe::
     setRatioSlowTwitchFibers(const std::string& muscleName, const double& ratio) 
 { 
     updMetabolicParameters(muscleName)->set_ratio_slow_twitch_fibers(ratio);
+    bindMetabolicMuscles();
 }
 
 
@@ -762,6 +945,7 @@ void Bhargava2004MuscleMetabolicsProbe::
     setActivationConstantSlowTwitch(const std::string& muscleName, const double& c) 
 { 
     updMetabolicParameters(muscleName)->set_activation_constant_slow_twitch(c); 
+    bindMetabolicMuscles();
 }
 
 
@@ -784,6 +968,7 @@ void Bhargava2004MuscleMetabolicsProbe::
     setActivationConstantFastTwitch(const std::string& muscleName, const double& c) 
 { 
     updMetabolicParameters(muscleName)->set_activation_constant_fast_twitch(c); 
+    bindMetabolicMuscles();
 }
 
 
@@ -806,6 +991,7 @@ void Bhargava2004MuscleMetabolicsProbe::
     setMaintenanceConstantSlowTwitch(const std::string& muscleName, const double& c) 
 { 
     updMetabolicParameters(muscleName)->set_maintenance_constant_slow_twitch(c); 
+    bindMetabolicMuscles();
 }
 
 
@@ -828,6 +1014,7 @@ void Bhargava2004MuscleMetabolicsProbe::
     setMaintenanceConstantFastTwitch(const std::string& muscleName, const double& c) 
 { 
     updMetabolicParameters(muscleName)->set_maintenance_constant_fast_twitch(c);
+    bindMetabolicMuscles();
 }
 
 
@@ -945,16 +1132,23 @@ Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameter(
 //--------------------------------------------------------------------------
 // Set muscle mass
 //--------------------------------------------------------------------------
+double Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameter::
+calcMuscleMass() const
+{ 
+    if (get_use_provided_muscle_mass())
+        return get_provided_muscle_mass();
+    return (_musc->getMaxIsometricForce() / get_specific_tension()) 
+           * get_density() 
+           * _musc->getOptimalFiberLength();
+}
+
 void Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameter::
 setMuscleMass()    
 { 
-    if (get_use_provided_muscle_mass())
-        _muscMass = get_provided_muscle_mass();
-    else {
-        _muscMass = (_musc->getMaxIsometricForce() / get_specific_tension()) 
-                    * get_density() 
-                    * _musc->getOptimalFiberLength();
-        }
+    _muscMass = calcMuscleMass();
+    // The probe binds the parameters after it sets their masses, so they are
+    // up to date with the values it binds until they are edited.
+    setObjectIsUpToDateWithProperties();
 }
 
 
@@ -122,16 +122,22 @@ void CMCActuatorSubsystemRep::setSpeedTrajectories(FunctionSet *aSet) {
        return( _model);
   }
 
-  int CMCActuatorSubsystemRep::realizeSubsystemDynamicsImpl(const State& s) const
+  void CMCActuatorSubsystemRep::poseModel(State& s, double time) const
+  {
+    poseModel(*_model, s, time);
+  }
+
+  void CMCActuatorSubsystemRep::poseModel(const Model& model, State& s,
+          double time) const
   {
      /* set generalized coordinates and speeds from spline sets */
-    int nq = _model->getNumCoordinates();
+    int nq = model.getNumCoordinates();
     double t;
 
     if(_holdCoordinatesConstant) {
          t = _holdTime;
     } else  {
-         t = s.getTime();
+         t = time;
     }
 
     _qSet->evaluate(_qWork,0,t);
@@ -141,30 +147,36 @@ void CMCActuatorSubsystemRep::setSpeedTrajectories(FunctionSet *aSet) {
         _qSet->evaluate(_uWork,1,t);
     }
 
-    /* Hack to obtain a mutable state in a const method */
-    State& mutableCompState = const_cast<SimTK::State&>(_completeState);
-
     // Update the coordinate values to pose the model while computing muscle
     // controls
-    const CoordinateSet& coords = _model->getCoordinateSet();
+    const CoordinateSet& coords = model.getCoordinateSet();
     for (int i = 0; i < nq; ++i) {
         // the last argument to setValue, a bool to enforce constraints,
         // is false since values come from a _qSet of splined desired
         // kinematics formed from formCompleteStorages, which enforces
         // model constraints.
-        coords[i].setValue(mutableCompState, _qWork[i] + _qCorrections[i], false);
-        coords[i].setSpeedValue(mutableCompState, _uWork[i] + _uCorrections[i]);
+        coords[i].setValue(s, _qWork[i] + _qCorrections[i], false);
+        coords[i].setSpeedValue(s, _uWork[i] + _uCorrections[i]);
     }
     // project() to satisfy constraints perturbed by _q/_uCorrections
-    _model->getMultibodySystem().projectQ(mutableCompState,
-        getModel()->get_assembly_accuracy() / 10);
-    _model->getMultibodySystem().projectU(mutableCompState,
-        getModel()->get_assembly_accuracy() / 10);
+    model.getMultibodySystem().projectQ(s,
+        model.get_assembly_accuracy() / 10);
+    model.getMultibodySystem().projectU(s,
+        model.get_assembly_accuracy() / 10);
+
+    s.updTime() = t;
+  }
+
+  int CMCActuatorSubsystemRep::realizeSubsystemDynamicsImpl(const State& s) const
+  {
+    /* Hack to obtain a mutable state in a const method */
+    State& mutableCompState = const_cast<SimTK::State&>(_completeState);
+
+    poseModel(mutableCompState, s.getTime());
 
     /* copy  muscle states computed from the actuator system to the muscle states
        for the complete system  then compute forces*/
     mutableCompState.updZ() = s.getZ();
-    mutableCompState.updTime() = t;
 
     _model->getMultibodySystem().realize(_completeState, SimTK::Stage::Acceleration);
 
@@ -89,6 +89,14 @@ class CMCActuatorSubsystemRep : public SimTK::Subsystem::Guts {
   void holdCoordinatesConstant( double t );
   void releaseCoordinates();
 
+  /** Pose the model in `s` at time `t` (or at the hold time if the
+  coordinates are held constant) using the coordinate and speed trajectories
+  plus the corrections, and project to satisfy the constraints. */
+  void poseModel(SimTK::State& s, double t) const;
+  /** Same as above for a copy of the model of this subsystem. Not thread
+  safe: callers posing copies concurrently must serialize the calls. */
+  void poseModel(const Model& model, SimTK::State& s, double t) const;
+
   SimTK::State  _completeState;
   Model*        _model;
   bool          _holdCoordinatesConstant;
@@ -115,6 +123,12 @@ class OSIMSIMULATION_API CMCActuatorSubsystem : public SimTK::Subsystem {
 
     void holdCoordinatesConstant( double t );
     void releaseCoordinates();
+    void poseModel(SimTK::State& s, double t) const {
+        rep->poseModel(s, t);
+    }
+    void poseModel(const Model& model, SimTK::State& s, double t) const {
+        rep->poseModel(model, s, t);
+    }
     void setCompleteState(const SimTK::State& s)  {
         rep->setCompleteState( s );
     }
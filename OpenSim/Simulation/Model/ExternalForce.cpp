@@ -27,9 +27,6 @@
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/Model/BodySet.h>
 #include <OpenSim/Common/Storage.h>
-#include <OpenSim/Common/Constant.h>
-#include <OpenSim/Common/PiecewiseLinearFunction.h>
-#include <OpenSim/Common/GCVSpline.h>
 
 #include "ExternalForce.h"
 
@@ -260,64 +257,42 @@ void ExternalForce::extendConnectToModel(Model& model)
             "\n. Please make sure data file contains exactly 3 unique columns with this common prefix."));
     }
 
-    // clear out functions from previous data source
-    _forceFunctions.clearAndDestroy();
-    _pointFunctions.clearAndDestroy();
-    _torqueFunctions.clearAndDestroy();
-
-    // Create functions now that we should have good data remaining
+    // Collect the components of the force, point and torque as channels of a
+    // single function of time, so that they are evaluated together.
+    SimTK::Vector times(nt, &time[0]);
+    int numChannels = 0;
+    _forceChannel = _pointChannel = _torqueChannel = -1;
     if(_appliesForce){
-        for(int i=0; i<3; ++i){
-            switch(nt) {
-                case 1 :
-                    _forceFunctions.append(new Constant(force[i][0]));
-                    break;
-                case 2 :
-                    _forceFunctions.append(new PiecewiseLinearFunction(force[i].getSize(), &time[0], &(force[i][0])) );
-                    break;
-                case 3 :
-                    _forceFunctions.append(new PiecewiseLinearFunction(force[i].getSize(), &time[0], &(force[i][0])) );
-                    break;
-                default:
-                    _forceFunctions.append(new GCVSpline( 3, force[i].getSize(), &time[0], &(force[i][0])) );
-            }   
-        }
-
+        _forceChannel = numChannels;
+        numChannels += 3;
         if(_specifiesPoint){
-            for(int i=0; i<3; ++i){
-                switch(nt) {
-                case 1:
-                    _pointFunctions.append(new Constant(point[i][0]));
-                    break;
-                case 2:
-                    _pointFunctions.append(new PiecewiseLinearFunction(point[i].getSize(), &time[0], &(point[i][0])) );
-                    break;
-                case 3:
-                    _pointFunctions.append(new PiecewiseLinearFunction(point[i].getSize(), &time[0], &(point[i][0])) );
-                    break;
-                default:
-                    _pointFunctions.append(new GCVSpline( 3, point[i].getSize(), &time[0], &(point[i][0])) );
-                }
-            }
+            _pointChannel = numChannels;
+            numChannels += 3;
         }
     }
     if(_appliesTorque){
-        for(int i=0; i<3; ++i){
-            switch(nt) {
-                case 1:
-                    _torqueFunctions.append(new Constant(torque[i][0]));
-                    break;
-                case 2:
-                    _torqueFunctions.append(new PiecewiseLinearFunction(torque[i].getSize(), &time[0], &(torque[i][0])) );
-                    break;
-                case 3:
-                    _torqueFunctions.append(new PiecewiseLinearFunction(torque[i].getSize(), &time[0], &(torque[i][0])) );
-                    break;
-                default:
-                    _torqueFunctions.append(new GCVSpline( 3, torque[i].getSize(), &time[0], &(torque[i][0])) );
-            }
-        }
+        _torqueChannel = numChannels;
+        numChannels += 3;
     }
+
+    SimTK::Matrix data(nt, numChannels);
+    auto setChannels = [&](int firstChannel, const Array<Array<double> >& d) {
+        if(firstChannel < 0) return;
+        for(int i=0; i<3; ++i)
+            for(int j=0; j<nt; ++j)
+                data(j, firstChannel+i) = d[i][j];
+    };
+    setChannels(_forceChannel, force);
+    setChannels(_pointChannel, point);
+    setChannels(_torqueChannel, torque);
+
+    // Create functions now that we should have good data remaining:
+    // constant for a single time, linear for 2 or 3 times and a cubic
+    // GCVSpline otherwise.
+    if(nt < 4)
+        _dataFunctions = PiecewiseVectorFunction::createLinear(times, data);
+    else
+        _dataFunctions = PiecewiseVectorFunction::createSpline(3, times, data);
 }
 
 
@@ -335,12 +310,20 @@ void ExternalForce::computeForce(const SimTK::State& state,
 
     assert(_appliedToBody!=nullptr);
 
+    // Evaluate all the components at once.
+    double data[9];
+    _dataFunctions.calcValue(time, data);
+    auto getVec3 = [&data](int firstChannel) {
+        return Vec3(data[firstChannel], data[firstChannel+1],
+                    data[firstChannel+2]);
+    };
+
     if (_appliesForce) {
-        Vec3 force = getForceAtTime(time);
+        Vec3 force = getVec3(_forceChannel);
         force = _forceExpressedInBody->expressVectorInGround(state, force);
         Vec3 point(0); // Default is body origin.
         if (_specifiesPoint) {
-            point = getPointAtTime(time);
+            point = getVec3(_pointChannel);
             point = _pointExpressedInBody->
                 findStationLocationInAnotherFrame(state, point, *_appliedToBody);
         }
@@ -348,7 +331,7 @@ void ExternalForce::computeForce(const SimTK::State& state,
     }
 
     if (_appliesTorque) {
-        Vec3 torque = getTorqueAtTime(time);
+        Vec3 torque = getVec3(_torqueChannel);
         torque = _forceExpressedInBody->expressVectorInGround(state, torque);
         applyTorque(state, *_appliedToBody, torque, bodyForces);
     }
@@ -359,47 +342,23 @@ void ExternalForce::computeForce(const SimTK::State& state,
  */
 Vec3 ExternalForce::getForceAtTime(double aTime) const  
 {
-    SimTK::Vector timeAsVector(1, aTime);
-    const Function* forceX=NULL;
-    const Function* forceY=NULL;
-    const Function* forceZ=NULL;
-    if (_forceFunctions.size()==3){
-        forceX=_forceFunctions[0];  forceY=_forceFunctions[1];  forceZ=_forceFunctions[2];
-    }
-    Vec3 force(forceX?forceX->calcValue(timeAsVector):0.0, 
-        forceY?forceY->calcValue(timeAsVector):0.0, 
-        forceZ?forceZ->calcValue(timeAsVector):0.0);
-    return force;
+    if (_forceChannel < 0)
+        return Vec3(0);
+    return _dataFunctions.calcVec3(aTime, _forceChannel);
 }
 
 Vec3 ExternalForce::getPointAtTime(double aTime) const
 {
-    SimTK::Vector timeAsVector(1, aTime);
-    const Function* pointX=NULL;
-    const Function* pointY=NULL;
-    const Function* pointZ=NULL;
-    if (_pointFunctions.size()==3){
-        pointX=_pointFunctions[0];  pointY=_pointFunctions[1];  pointZ=_pointFunctions[2];
-    }
-    Vec3 point(pointX?pointX->calcValue(timeAsVector):0.0, 
-        pointY?pointY->calcValue(timeAsVector):0.0, 
-        pointZ?pointZ->calcValue(timeAsVector):0.0);
-    return point;
+    if (_pointChannel < 0)
+        return Vec3(0);
+    return _dataFunctions.calcVec3(aTime, _pointChannel);
 }
 
 Vec3 ExternalForce::getTorqueAtTime(double aTime) const
 {
-    SimTK::Vector timeAsVector(1, aTime);
-    const Function* torqueX=NULL;
-    const Function* torqueY=NULL;
-    const Function* torqueZ=NULL;
-    if (_torqueFunctions.size()==3){
-        torqueX=_torqueFunctions[0];    torqueY=_torqueFunctions[1];    torqueZ=_torqueFunctions[2];
-    }
-    Vec3 torque(torqueX?torqueX->calcValue(timeAsVector):0.0, 
-        torqueY?torqueY->calcValue(timeAsVector):0.0, 
-        torqueZ?torqueZ->calcValue(timeAsVector):0.0);
-    return torque;
+    if (_torqueChannel < 0)
+        return Vec3(0);
+    return _dataFunctions.calcVec3(aTime, _torqueChannel);
 }
 
 
@@ -24,6 +24,7 @@
  * -------------------------------------------------------------------------- */
 // INCLUDE
 #include "Force.h"
+#include <OpenSim/Common/PiecewiseVectorFunction.h>
 
 namespace OpenSim {
 
@@ -254,10 +255,15 @@ private:
     bool _specifiesPoint {false};
     bool _appliesTorque {false};
 
-    /** force data as a function of time used internally */
-    ArrayPtrs<Function> _forceFunctions;
-    ArrayPtrs<Function> _torqueFunctions;
-    ArrayPtrs<Function> _pointFunctions;
+    /** force, point and torque data as a function of time used internally.
+        All the components share the data source's time column and are
+        evaluated together. */
+    PiecewiseVectorFunction _dataFunctions;
+    /** Channel of _dataFunctions holding the x component of the force, point
+        and torque; -1 if the force does not have that quantity. */
+    int _forceChannel {-1};
+    int _pointChannel {-1};
+    int _torqueChannel {-1};
 
     friend class ExternalLoads;
 //==============================================================================
@@ -119,6 +119,8 @@ void ExternalLoads::copyData(const ExternalLoads &aAbsExternalLoads)
     _lowpassCutoffFrequencyForLoadKinematics = aAbsExternalLoads._lowpassCutoffFrequencyForLoadKinematics;
     _storages = aAbsExternalLoads._storages;
     _loadedFromFile = aAbsExternalLoads._loadedFromFile;
+    _dataFileStorage = aAbsExternalLoads._dataFileStorage;
+    _dataFileStoragePath = aAbsExternalLoads._dataFileStoragePath;
 }
 
 //_____________________________________________________________________________
@@ -179,34 +181,22 @@ void ExternalLoads::extendConnectToModel(Model& aModel)
     // BASE CLASS
     Super::extendConnectToModel(aModel);
 
-    Storage *forceData = nullptr;
-    auto loadDataFromDirectoryAdjacentToFile =
-        [this, &forceData](const std::string& filepath) {
-            // Change working directory the ExternalLoads location
-            std::string savedCwd = IO::getCwd();
-            IO::chDir(IO::getParentDirectory(filepath));
-            try {
-                forceData = new Storage(this->_dataFileName);
-            }
-            catch (const std::exception &ex) {
-                log_error("Failed to read ExternalLoads data file '{}'.",
-                        this->_dataFileName);
-                if (this->getDocument())
-                    IO::chDir(savedCwd);
-                throw(ex);
-            }
-            IO::chDir(savedCwd);
-    };
     if (_dataFileName.length() > 0) {
+        // Resolve the data file relative to the ExternalLoads (XML) file
+        // rather than by changing the working directory, which would affect
+        // every thread of the process.
+        std::string dataFilePath;
         if(IO::FileExists(_dataFileName))
-            forceData = new Storage(_dataFileName);
+            dataFilePath = _dataFileName;
         else if(getDocument()) { // ExternalLoads constructed from file
-            loadDataFromDirectoryAdjacentToFile(getDocumentFileName());
+            dataFilePath = IO::getParentDirectory(getDocumentFileName()) +
+                    _dataFileName;
         }
         else if (!_loadedFromFile.empty()) {
             // Might be dealing with a copy of an ExternalLoads constructed
             // from file.
-            loadDataFromDirectoryAdjacentToFile(_loadedFromFile);
+            dataFilePath = IO::getParentDirectory(_loadedFromFile) +
+                    _dataFileName;
         }
         else {
             // Cannot find the data file and do not have an ExternalLoads (XML)
@@ -215,11 +205,22 @@ void ExternalLoads::extendConnectToModel(Model& aModel)
                 _dataFileName + "'.");
         }
 
-        for (int i = 0; i < getSize(); ++i)
-            get(i).setDataSource(*forceData);
+        // Copies of this ExternalLoads (e.g., in clones of the model) share
+        // the data that was already read; it is only ever read from.
+        if (!_dataFileStorage || _dataFileStoragePath != dataFilePath) {
+            try {
+                _dataFileStorage = std::make_shared<Storage>(dataFilePath);
+            }
+            catch (const std::exception&) {
+                log_error("Failed to read ExternalLoads data file '{}'.",
+                        _dataFileName);
+                throw;
+            }
+            _dataFileStoragePath = dataFilePath;
+        }
 
-        // add loaded storage into list of storages for later garbage collection
-        _storages.push_back(shared_ptr<Storage>(forceData));
+        for (int i = 0; i < getSize(); ++i)
+            get(i).setDataSource(*_dataFileStorage);
     }
 }
 
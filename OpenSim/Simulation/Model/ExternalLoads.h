@@ -86,6 +86,11 @@ private:
        with the transformed point data. Hang-on to them so we can delete them. */
     std::vector<std::shared_ptr<Storage>> _storages;
 
+    /* The data read from the data file, and the path it was read from. This
+       is shared with (and only read by) the copies of this ExternalLoads. */
+    std::shared_ptr<const Storage> _dataFileStorage;
+    std::string _dataFileStoragePath;
+
     // TODO: Replace with a Path property type that remembers where a file
     // was loaded from.
     std::string _loadedFromFile;
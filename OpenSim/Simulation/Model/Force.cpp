@@ -148,6 +148,17 @@ bool Force::appliesForce(const SimTK::State& s) const
     return get_appliesForce();
 }
 
+void Force::calcForceContribution(const SimTK::State& s,
+        SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
+        SimTK::Vector& generalizedForces) const
+{
+    OPENSIM_THROW_IF_FRMOBJ(!_index.isValid(), Exception,
+            "Force has not been added to a System.");
+    SimTK::Vector_<SimTK::Vec3> particleForces;
+    _model->getForceSubsystem().getForce(_index).calcForceContribution(s,
+            bodyForces, particleForces, generalizedForces);
+}
+
 //-----------------------------------------------------------------------------
 // ABSTRACT METHODS
 //-----------------------------------------------------------------------------
@@ -82,6 +82,15 @@ public:
     /** %Set whether or not the Force is applied.                             */
     void setAppliesForce(SimTK::State& s, bool applyForce) const;
 
+    /** Compute the body and generalized forces that this Force applies in the
+    given state, whether or not it is currently applied (see appliesForce()).
+    The state must be realized to Stage::Velocity. The outputs are resized to
+    the number of bodies and generalized speeds and hold only the
+    contribution of this Force.                                             */
+    void calcForceContribution(const SimTK::State& s,
+            SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
+            SimTK::Vector& generalizedForces) const;
+
     /**
      * Methods to query a Force for the value actually applied during 
      * simulation. The names of the quantities (column labels) is returned by 
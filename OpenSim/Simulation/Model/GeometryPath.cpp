@@ -107,6 +107,10 @@ void GeometryPath::extendConnectToModel(Model& aModel)
     // We consider this cache entry valid any time after it has been created
     // and first marked valid, and we won't ever invalidate it.
     this->_colorCV = addCacheVariable("color", get_Appearance().get_color(), SimTK::Stage::Topology);
+
+    // The last wrap over each wrap object, reused while the path points have
+    // not moved relative to the object.
+    this->_lastWrapsCV = addCacheVariable("last_wraps", LastWraps{}, SimTK::Stage::Topology);
 }
 
  void GeometryPath::extendInitStateFromProperties(SimTK::State& s) const
@@ -869,6 +873,9 @@ applyWrapObjects(const SimTK::State& s, Array<AbstractPathPoint*>& path) const
     WrapResult best_wrap;
     Array<int> result, order;
 
+    std::vector<LastWrap>& lastWraps = updCacheVariableValue(s, _lastWrapsCV).wraps;
+    lastWraps.resize(get_PathWrapSet().getSize());
+
     result.setSize(get_PathWrapSet().getSize());
     order.setSize(get_PathWrapSet().getSize());
 
@@ -880,10 +887,15 @@ applyWrapObjects(const SimTK::State& s, Array<AbstractPathPoint*>& path) const
     // If there are two or more objects, perform up to 8 iterations where
     // the result from one wrap object is used as the starting point for
     // the next wrap.
+    // The iterations stop once the length of the path changes by less than
+    // the tolerance, or once an iteration leaves the path unchanged because
+    // no wrap object had to be wrapped again.
     const int maxIterations = get_PathWrapSet().getSize() < 2 ? 1 : 8;
+    const double lengthTolerance = 0.0005;
     double last_length = SimTK::Infinity;
     for (int kk = 0; kk < maxIterations; kk++)
     {
+        int numWrapsComputed = 0;
         for (int i = 0; i < get_PathWrapSet().getSize(); i++)
         {
             result[i] = 0;
@@ -953,66 +965,117 @@ applyWrapObjects(const SimTK::State& s, Array<AbstractPathPoint*>& path) const
                 if (start == -1 || end == -1) // this should never happen
                     return;
 
-                // You now have indices into _currentPath (which is a list of 
-                // all currently active points, including wrap points) that 
-                // represent the used-defined range of points to consider for 
-                // wrapping over this wrap object. Check each path segment in 
-                // this range, choosing the best wrap as the one that changes 
-                // the path segment length the least:
-                for (int pt1 = start; pt1 < end; pt1++)
-                {
-                    const int pt2 = pt1 + 1;
-
-                    // As long as the two points are not auto wrap points on the
-                    // same wrap object, check them for wrapping.
-                    if (   path.get(pt1)->getWrapObject() == NULL 
-                        || path.get(pt2)->getWrapObject() == NULL 
-                        || (   path.get(pt1)->getWrapObject() 
-                            != path.get(pt2)->getWrapObject()))
+                // 5. If the wrap object is unchanged and none of the points in
+                // this range has moved relative to it since the wrapping over
+                // this object was last computed with this state, the path
+                // segments to wrap are the same, and so is the best wrap;
+                // reuse it. Otherwise, record the object, the points and their
+                // locations for next time. Editing a property of the wrap
+                // object (e.g., its radius) marks it as out of date until it
+                // is finalized again (e.g., by Model::initSystem(), which also
+                // discards the last wraps), and it is wrapped over until then.
+                LastWrap& lastWrap = lastWraps[order[i]];
+                if (lastWrap.wrapObject != wo ||
+                        !wo->isObjectUpToDateWithProperties()) {
+                    lastWrap.wrapObject = wo;
+                    lastWrap.valid = false;
+                }
+                const int numPoints = end - start + 1;
+                bool moved = !lastWrap.valid ||
+                        lastWrap.method != ws.getMethod() ||
+                        int(lastWrap.points.size()) != numPoints;
+                lastWrap.points.resize(numPoints);
+                lastWrap.locations.resize(numPoints);
+                for (int j = 0; j < numPoints; j++) {
+                    const AbstractPathPoint* point = path.get(start + j);
+                    const SimTK::Vec3 location = point->getParentFrame().
+                            findStationLocationInAnotherFrame(s,
+                                    point->getLocation(s), wo->getFrame());
+                    if (!moved && (lastWrap.points[j] != point ||
+                                   lastWrap.locations[j] != location))
+                        moved = true;
+                    lastWrap.points[j] = point;
+                    lastWrap.locations[j] = location;
+                }
+
+                if (!moved) {
+                    result[i] = lastWrap.result;
+                    best_wrap = lastWrap.bestWrap;
+                    // The range may have been shifted by wrap points that
+                    // other wrap objects inserted before it.
+                    best_wrap.startPoint += start - lastWrap.firstPoint;
+                    best_wrap.endPoint += start - lastWrap.firstPoint;
+                } else {
+                    lastWrap.valid = false;
+                    numWrapsComputed++;
+
+                    // You now have indices into _currentPath (which is a list of 
+                    // all currently active points, including wrap points) that 
+                    // represent the used-defined range of points to consider for 
+                    // wrapping over this wrap object. Check each path segment in 
+                    // this range, choosing the best wrap as the one that changes 
+                    // the path segment length the least:
+                    for (int pt1 = start; pt1 < end; pt1++)
                     {
-                        WrapResult wr;
-                        wr.startPoint = pt1;
-                        wr.endPoint   = pt2;
-
-                        result[i] = wo->wrapPathSegment(s, *path.get(pt1), 
-                                                        *path.get(pt2), ws, wr);
-                        if (result[i] == WrapObject::mandatoryWrap) {
-                            // "mandatoryWrap" means the path actually 
-                            // intersected the wrap object. In this case, you 
-                            // *must* choose this segment as the "best" one for
-                            // wrapping. If the path has more than one segment 
-                            // that intersects the object, the first one is
-                            // taken as the mandatory wrap (this is considered 
-                            // an ill-conditioned case).
-                            best_wrap = wr;
-                            // Store the best wrap in the pathWrap for possible 
-                            // use next time.
-                            ws.setPreviousWrap(wr);
-                            break;
-                        }  else if (result[i] == WrapObject::wrapped) {
-                            // "wrapped" means the path segment was wrapped over
-                            // the object, but you should consider the other 
-                            // segments as well to see if one
-                            // wraps with a smaller length change.
-                            double path_length_change = 
-                                calcPathLengthChange(s, *wo, wr, path);
-                            if (path_length_change < min_length_change)
-                            {
+                        const int pt2 = pt1 + 1;
+
+                        // As long as the two points are not auto wrap points on the
+                        // same wrap object, check them for wrapping.
+                        if (   path.get(pt1)->getWrapObject() == NULL 
+                            || path.get(pt2)->getWrapObject() == NULL 
+                            || (   path.get(pt1)->getWrapObject() 
+                                != path.get(pt2)->getWrapObject()))
+                        {
+                            WrapResult wr;
+                            wr.startPoint = pt1;
+                            wr.endPoint   = pt2;
+
+                            result[i] = wo->wrapPathSegment(s, *path.get(pt1), 
+                                                            *path.get(pt2), ws, wr);
+                            if (result[i] == WrapObject::mandatoryWrap) {
+                                // "mandatoryWrap" means the path actually 
+                                // intersected the wrap object. In this case, you 
+                                // *must* choose this segment as the "best" one for
+                                // wrapping. If the path has more than one segment 
+                                // that intersects the object, the first one is
+                                // taken as the mandatory wrap (this is considered 
+                                // an ill-conditioned case).
                                 best_wrap = wr;
-                                // Store the best wrap in the pathWrap for 
-                                // possible use next time
+                                // Store the best wrap in the pathWrap for possible 
+                                // use next time.
                                 ws.setPreviousWrap(wr);
-                                min_length_change = path_length_change;
+                                break;
+                            }  else if (result[i] == WrapObject::wrapped) {
+                                // "wrapped" means the path segment was wrapped over
+                                // the object, but you should consider the other 
+                                // segments as well to see if one
+                                // wraps with a smaller length change.
+                                double path_length_change = 
+                                    calcPathLengthChange(s, *wo, wr, path);
+                                if (path_length_change < min_length_change)
+                                {
+                                    best_wrap = wr;
+                                    // Store the best wrap in the pathWrap for 
+                                    // possible use next time
+                                    ws.setPreviousWrap(wr);
+                                    min_length_change = path_length_change;
+                                } else {
+                                    // The wrap was not shorter than the current 
+                                    // minimum, so just free the wrap points that 
+                                    // were allocated.
+                                    wr.wrap_pts.setSize(0);
+                                }
                             } else {
-                                // The wrap was not shorter than the current 
-                                // minimum, so just free the wrap points that 
-                                // were allocated.
-                                wr.wrap_pts.setSize(0);
+                                // Nothing to do.
                             }
-                        } else {
-                            // Nothing to do.
                         }
                     }
+
+                    lastWrap.valid = true;
+                    lastWrap.method = ws.getMethod();
+                    lastWrap.firstPoint = start;
+                    lastWrap.result = result[i];
+                    lastWrap.bestWrap = best_wrap;
                 }
 
                 // Deallocate previous wrapping points if necessary.
@@ -1051,8 +1114,11 @@ applyWrapObjects(const SimTK::State& s, Array<AbstractPathPoint*>& path) const
             }
         }
 
+        if (kk > 0 && numWrapsComputed == 0)
+            break;
+
         const double length = calcLengthAfterPathComputation(s, path); 
-        if (std::abs(length - last_length) < 0.0005) {
+        if (std::abs(length - last_length) < lengthTolerance) {
             break;
         } else {
             last_length = length;
@@ -31,6 +31,8 @@
 #include <OpenSim/Simulation/Wrap/PathWrapSet.h>
 #include <OpenSim/Simulation/MomentArmSolver.h>
 
+#include <vector>
+
 
 #ifdef SWIG
     #ifdef OSIMSIMULATION_API
@@ -91,6 +93,38 @@ private:
     mutable CacheVariable<double> _speedCV;
     mutable CacheVariable<Array<AbstractPathPoint*>> _currentPathCV;
     mutable CacheVariable<SimTK::Vec3> _colorCV;
+
+    /** The outcome of the last wrapping computation of a PathWrap (see
+    applyWrapObjects()), along with its inputs: the wrap object, the points of
+    the path that were considered for wrapping and their locations in the
+    frame of the wrap object's body. As long as the wrap object is the same,
+    its properties have not been edited since it was finalized, and none of
+    these points has moved relative to it, the outcome can be reused instead
+    of wrapping the path again. */
+    struct LastWrap {
+        bool valid{false};
+        const WrapObject* wrapObject{nullptr};
+        PathWrap::WrapMethod method{PathWrap::hybrid};
+        std::vector<const AbstractPathPoint*> points;
+        std::vector<SimTK::Vec3> locations;
+        /** Index of points[0] in the path when the wrap was computed. */
+        int firstPoint{0};
+        /** Result of WrapObject::wrapPathSegment() for the last segment. */
+        int result{0};
+        WrapResult bestWrap;
+    };
+    struct LastWraps {
+        std::vector<LastWrap> wraps;
+        friend std::ostream& operator<<(std::ostream& o, const LastWraps&) {
+            o << "GeometryPath::LastWraps should not be serialized!"
+              << std::endl;
+            return o;
+        }
+    };
+    /** The last wrap of each PathWrap, kept in the state so that it is only
+    reused for the state it was computed with. Its value is used whatever its
+    validity, which is never marked. */
+    mutable CacheVariable<LastWraps> _lastWrapsCV;
     
 //=============================================================================
 // METHODS
@@ -154,13 +188,17 @@ public:
     @see setDefaultColor() **/
     SimTK::Vec3 getColor(const SimTK::State& s) const;
 
-    double getLength( const SimTK::State& s) const;
+    /** The length of the path. This and getLengtheningSpeed(),
+        addInEquivalentForces() and computeMomentArm() are virtual so that a
+        subclass (e.g., PolynomialPath) can compute them without the path
+        points. */
+    virtual double getLength( const SimTK::State& s) const;
     void setLength( const SimTK::State& s, double length) const;
     double getPreScaleLength( const SimTK::State& s) const;
     void setPreScaleLength( const SimTK::State& s, double preScaleLength);
     const Array<AbstractPathPoint*>& getCurrentPath( const SimTK::State& s) const;
 
-    double getLengtheningSpeed(const SimTK::State& s) const;
+    virtual double getLengtheningSpeed(const SimTK::State& s) const;
     void setLengtheningSpeed( const SimTK::State& s, double speed ) const;
 
     /** get the path as PointForceDirections directions, which can be used
@@ -175,7 +213,7 @@ public:
     @param[in,out] bodyForces   Vector of SpatialVec's (torque, force) on bodies
     @param[in,out] mobilityForces  Vector of generalized forces, one per mobility   
     */
-    void addInEquivalentForces(const SimTK::State& state,
+    virtual void addInEquivalentForces(const SimTK::State& state,
                                const double& tension, 
                                SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
                                SimTK::Vector& mobilityForces) const;
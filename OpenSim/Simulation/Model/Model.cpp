@@ -1010,6 +1010,12 @@ void Model::extendAddToSystem(SimTK::MultibodySystem& system) const
         Stage::Velocity, Stage::Acceleration);
 
     mutableThis->_modelControlsIndex = modelControls.getSubsystemMeasureIndex();
+
+    // The moment arms of the muscles depend only on the coordinate values.
+    // The solver holds a copy of the state so it is rebuilt with the system.
+    _momentArmSolver.reset();
+    this->_momentArmMatrixCV = addCacheVariable("moment_arm_matrix",
+        SimTK::Matrix(), SimTK::Stage::Position);
 }
 
 
@@ -1394,6 +1400,30 @@ Set<Muscle>& Model::updMuscles()
     return upd_ForceSet().updMuscles();
 }
 
+const SimTK::Matrix& Model::getMomentArmMatrix(const SimTK::State& s) const
+{
+    if (isCacheVariableValid(s, _momentArmMatrixCV))
+        return getCacheVariableValue(s, _momentArmMatrixCV);
+
+    if (!_momentArmSolver)
+        _momentArmSolver.reset(new MomentArmSolver(*this));
+
+    const Set<Muscle>& muscles = getMuscles();
+    SimTK::Array_<const GeometryPath*> paths(muscles.getSize());
+    for (int i = 0; i < muscles.getSize(); ++i)
+        paths[i] = &muscles[i].getGeometryPath();
+
+    const CoordinateSet& coordinates = getCoordinateSet();
+    SimTK::Array_<const Coordinate*> coords(coordinates.getSize());
+    for (int j = 0; j < coordinates.getSize(); ++j)
+        coords[j] = &coordinates[j];
+
+    SimTK::Matrix& momentArms = updCacheVariableValue(s, _momentArmMatrixCV);
+    _momentArmSolver->solve(s, coords, paths, momentArms);
+    markCacheVariableValid(s, _momentArmMatrixCV);
+    return momentArms;
+}
+
 //_____________________________________________________________________________
 /**
  * Get the number of analyses in the model.
@@ -29,6 +29,7 @@
 #include <OpenSim/Common/Units.h>
 #include <OpenSim/Common/ModelDisplayHints.h>
 #include <OpenSim/Simulation/AssemblySolver.h>
+#include <OpenSim/Simulation/MomentArmSolver.h>
 #include <OpenSim/Simulation/Model/AnalysisSet.h>
 #include <OpenSim/Simulation/Model/BodySet.h>
 #include <OpenSim/Simulation/Model/ComponentSet.h>
@@ -145,6 +146,13 @@ related objects are maintained in a runtime section of the Model object. You
 can also ask a Model to provide visualization using the setUseVisualizer()
 method, in which case it will allocate and maintain a ModelVisualizer.
 
+A Model may be copied or cloned from multiple threads at once, as long as the
+Model being copied is not modified (or used to compute) at the same time.
+Each copy must then be given its own System with initSystem(), and used
+with its own SimTK::State; a single Model must not be used to compute from
+multiple threads, since computing updates data held by its components
+(e.g., the wrap points of its paths).
+
 @authors Frank Anderson, Peter Loan, Ayman Habib, Ajay Seth, Michael Sherman
 @see ModelComponent, ModelVisualizer, SimTK::System
 **/
@@ -719,6 +727,18 @@ public:
     const Set<Muscle>& getMuscles() const;
     Set<Muscle>& updMuscles();
 
+    /**
+     * Get the moment arms of all muscles about all coordinates of the model.
+     * Row i corresponds to getMuscles()[i] and column j to
+     * getCoordinateSet()[j]. The matrix is computed by the MomentArmSolver in
+     * a single pass over the muscle paths and is cached in the state, so it
+     * is computed at most once per configuration (Position stage) no matter
+     * how many analyses request it.
+     * @param s State of the model; it need not be realized.
+     * @return The muscles x coordinates moment-arm matrix.
+     */
+    const SimTK::Matrix& getMomentArmMatrix(const SimTK::State& s) const;
+
     const ForceSet& getForceSet() const { return get_ForceSet(); };
     ForceSet& updForceSet() { return upd_ForceSet(); };
 
@@ -1195,6 +1215,12 @@ private:
     // when the Model is copied.
     SimTK::ResetOnCopy<std::unique_ptr<AssemblySolver>> _assemblySolver;
 
+    // Solver used to fill the moment-arm matrix cache variable, created on
+    // first use. Like the AssemblySolver, it is not copied with the Model.
+    mutable SimTK::ResetOnCopy<std::unique_ptr<MomentArmSolver>>
+        _momentArmSolver;
+    mutable CacheVariable<SimTK::Matrix> _momentArmMatrixCV;
+
     // Model controls as a shared pool (Vector) of individual Actuator controls
     SimTK::MeasureIndex   _modelControlsIndex;
     // Default values pooled from Actuators upon system creation.
@@ -0,0 +1,400 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  PolynomialPath.cpp                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "PolynomialPath.h"
+#include "Model.h"
+#include <OpenSim/Simulation/SimbodyEngine/Coordinate.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace OpenSim;
+
+namespace {
+// Append the exponents of all the terms of total degree `remaining` in the
+// coordinates from `coord` on, by decreasing exponent of each coordinate.
+void appendExponents(int coord, int remaining, std::vector<int>& current,
+                     std::vector<int>& exponents) {
+    const int numCoords = int(current.size());
+    if (coord == numCoords - 1) {
+        current[coord] = remaining;
+        exponents.insert(exponents.end(), current.begin(), current.end());
+        return;
+    }
+    for (int e = remaining; e >= 0; --e) {
+        current[coord] = e;
+        appendExponents(coord + 1, remaining - e, current, exponents);
+    }
+}
+}
+
+//=============================================================================
+// CONSTRUCTOR(S)
+//=============================================================================
+PolynomialPath::PolynomialPath() : GeometryPath() {
+    constructProperties();
+}
+
+PolynomialPath::PolynomialPath(const GeometryPath& path) : PolynomialPath() {
+    setName(path.getName());
+    for (const std::string name : {"PathPointSet", "PathWrapSet", "Appearance"})
+        updPropertyByName(name).assign(path.getPropertyByName(name));
+}
+
+void PolynomialPath::constructProperties() {
+    constructProperty_coordinates();
+    constructProperty_coordinate_minimums();
+    constructProperty_coordinate_maximums();
+    constructProperty_order(5);
+    constructProperty_coefficients();
+    constructProperty_rms_length_error(0.0);
+    constructProperty_max_length_error(0.0);
+    constructProperty_rms_moment_arm_error(0.0);
+}
+
+int PolynomialPath::getNumTerms(int numCoordinates, int order) {
+    // The number of terms is (numCoordinates + order) choose order.
+    long long numTerms = 1;
+    for (int k = 1; k <= order; ++k)
+        numTerms = numTerms * (numCoordinates + k) / k;
+    return int(numTerms);
+}
+
+//=============================================================================
+// MODEL COMPONENT INTERFACE
+//=============================================================================
+void PolynomialPath::extendFinalizeFromProperties() {
+    Super::extendFinalizeFromProperties();
+
+    const int numCoords = getProperty_coordinates().size();
+    OPENSIM_THROW_IF_FRMOBJ(
+            getProperty_coordinate_minimums().size() != numCoords ||
+            getProperty_coordinate_maximums().size() != numCoords,
+            Exception, "Expected a minimum and a maximum for each of the " +
+            std::to_string(numCoords) + " coordinates.");
+    OPENSIM_THROW_IF_FRMOBJ(get_order() < 0, InvalidPropertyValue,
+            getProperty_order().getName(), "The order must be non-negative.");
+    const int numTerms = getNumTerms(numCoords, get_order());
+    OPENSIM_THROW_IF_FRMOBJ(getProperty_coefficients().size() != 0 &&
+            getProperty_coefficients().size() != numTerms,
+            Exception, "Expected " + std::to_string(numTerms) +
+            " coefficients but got " +
+            std::to_string(getProperty_coefficients().size()) + ".");
+
+    _centers.resize(numCoords);
+    _halfRanges.resize(numCoords);
+    for (int i = 0; i < numCoords; ++i) {
+        OPENSIM_THROW_IF_FRMOBJ(
+                get_coordinate_maximums(i) <= get_coordinate_minimums(i),
+                Exception, "The maximum of coordinate '" + get_coordinates(i) +
+                "' must be greater than its minimum.");
+        _centers[i] =
+            0.5 * (get_coordinate_maximums(i) + get_coordinate_minimums(i));
+        _halfRanges[i] =
+            0.5 * (get_coordinate_maximums(i) - get_coordinate_minimums(i));
+    }
+
+    _exponents.clear();
+    _exponents.reserve(numTerms * numCoords);
+    std::vector<int> current(numCoords);
+    if (numCoords > 0)
+        for (int degree = 0; degree <= get_order(); ++degree)
+            appendExponents(0, degree, current, _exponents);
+}
+
+void PolynomialPath::extendConnectToModel(Model& model) {
+    Super::extendConnectToModel(model);
+
+    OPENSIM_THROW_IF_FRMOBJ(getProperty_coefficients().size() == 0, Exception,
+            "The polynomial has no coefficients. Call fit() first.");
+
+    _coordinates.clear();
+    for (int i = 0; i < getProperty_coordinates().size(); ++i) {
+        OPENSIM_THROW_IF_FRMOBJ(
+                !model.getCoordinateSet().contains(get_coordinates(i)),
+                Exception, "Coordinate '" + get_coordinates(i) +
+                "' not found in the model.");
+        _coordinates.emplace_back(
+                &model.getCoordinateSet().get(get_coordinates(i)));
+    }
+}
+
+void PolynomialPath::extendAddToSystem(SimTK::MultibodySystem& system) const {
+    Super::extendAddToSystem(system);
+
+    // The length and its partials depend only on the q's; the speed also
+    // depends on the u's.
+    _lengthAndPartialsCV = addCacheVariable("length_and_partials",
+            SimTK::Vector(getProperty_coordinates().size() + 1, 0.0),
+            SimTK::Stage::Position);
+    _lengtheningSpeedCV = addCacheVariable("polynomial_lengthening_speed", 0.0,
+            SimTK::Stage::Velocity);
+}
+
+void PolynomialPath::extendPostScale(const SimTK::State& s,
+                                     const ScaleSet& scaleSet) {
+    Super::extendPostScale(s, scaleSet);
+    log_warn("PolynomialPath '{}' was not scaled; fit it again to the scaled "
+             "path.", getName());
+}
+
+//=============================================================================
+// FITTING
+//=============================================================================
+void PolynomialPath::fit(const Model& model, const GeometryPath& path,
+                         int order, int numSamples) {
+    OPENSIM_THROW_IF_FRMOBJ(order < 0, Exception,
+            "Expected a non-negative order, but got " + std::to_string(order) +
+            ".");
+
+    SimTK::State state = model.getWorkingState();
+    const CoordinateSet& coordSet = model.getCoordinateSet();
+    for (int i = 0; i < coordSet.getSize(); ++i) {
+        coordSet[i].setLocked(state, false);
+        coordSet[i].setValue(state, coordSet[i].getDefaultValue(), false);
+    }
+    const auto calcLength = [&]() -> double {
+        model.getMultibodySystem().realize(state, SimTK::Stage::Position);
+        return path.getLength(state);
+    };
+
+    // Select the coordinates that change the length of the path when swept
+    // over their range, with the other coordinates at their default values.
+    const double defaultLength = calcLength();
+    std::vector<const Coordinate*> coords;
+    for (int i = 0; i < coordSet.getSize(); ++i) {
+        const Coordinate& coord = coordSet[i];
+        const double min = coord.getRangeMin();
+        const double max = coord.getRangeMax();
+        if (!(max > min)) continue;
+        bool changesLength = false;
+        const int numSweepPoints = 9;
+        for (int k = 0; k < numSweepPoints && !changesLength; ++k) {
+            coord.setValue(state, min + (max - min) * k / (numSweepPoints - 1),
+                           false);
+            changesLength = std::abs(calcLength() - defaultLength) > 1e-9;
+        }
+        coord.setValue(state, coord.getDefaultValue(), false);
+        if (changesLength) coords.push_back(&coord);
+    }
+
+    const int numCoords = int(coords.size());
+    updProperty_coordinates().clear();
+    updProperty_coordinate_minimums().clear();
+    updProperty_coordinate_maximums().clear();
+    for (const auto* coord : coords) {
+        append_coordinates(coord->getName());
+        append_coordinate_minimums(coord->getRangeMin());
+        append_coordinate_maximums(coord->getRangeMax());
+    }
+    set_order(order);
+    updProperty_coefficients().clear();
+    // Build the exponents and the scaling of the coordinates.
+    finalizeFromProperties();
+
+    const int numTerms = getNumTerms(numCoords, order);
+    if (numSamples <= 0) numSamples = std::max(100, 4 * numTerms);
+    OPENSIM_THROW_IF_FRMOBJ(numSamples < numTerms, Exception,
+            "Expected at least as many samples as terms (" +
+            std::to_string(numTerms) + "), but got " +
+            std::to_string(numSamples) + ".");
+
+    // Use the same samples every time.
+    SimTK::Random::Uniform random(-1, 1);
+    random.setSeed(0);
+    std::vector<double> x(numCoords);
+    const auto setRandomPose = [&]() {
+        for (int i = 0; i < numCoords; ++i) {
+            x[i] = random.getValue();
+            coords[i]->setValue(state, _centers[i] + _halfRanges[i] * x[i],
+                                false);
+        }
+    };
+
+    // Fit by least squares.
+    SimTK::Matrix A(numSamples, numTerms);
+    SimTK::Vector b(numSamples);
+    std::vector<double> terms(numTerms);
+    for (int k = 0; k < numSamples; ++k) {
+        setRandomPose();
+        b[k] = calcLength();
+        calcTerms(x.data(), terms.data());
+        for (int t = 0; t < numTerms; ++t) A(k, t) = terms[t];
+    }
+    SimTK::Vector coefficients;
+    SimTK::FactorQTZ(A).solve(b, coefficients);
+    for (int t = 0; t < numTerms; ++t) append_coefficients(coefficients[t]);
+
+    // Measure the errors at other poses. The derivatives of the length of
+    // the fitted path are estimated by central differences.
+    const double delta = 1e-6;
+    std::vector<double> gradient(numCoords);
+    double sumSqLengthError = 0;
+    double maxLengthError = 0;
+    double sumSqMomentArmError = 0;
+    for (int k = 0; k < numSamples; ++k) {
+        setRandomPose();
+        const double lengthError =
+            calcPolynomial(x.data(), gradient.data()) - calcLength();
+        sumSqLengthError += lengthError * lengthError;
+        maxLengthError = std::max(maxLengthError, std::abs(lengthError));
+        for (int i = 0; i < numCoords; ++i) {
+            const double q = _centers[i] + _halfRanges[i] * x[i];
+            coords[i]->setValue(state, q + delta, false);
+            const double lengthPlus = calcLength();
+            coords[i]->setValue(state, q - delta, false);
+            const double lengthMinus = calcLength();
+            coords[i]->setValue(state, q, false);
+            const double error = gradient[i] / _halfRanges[i] -
+                (lengthPlus - lengthMinus) / (2 * delta);
+            sumSqMomentArmError += error * error;
+        }
+    }
+    set_rms_length_error(std::sqrt(sumSqLengthError / numSamples));
+    set_max_length_error(maxLengthError);
+    set_rms_moment_arm_error(numCoords == 0 ? 0.0 :
+            std::sqrt(sumSqMomentArmError / (numSamples * numCoords)));
+}
+
+//=============================================================================
+// EVALUATION
+//=============================================================================
+void PolynomialPath::calcTerms(const double* x, double* terms) const {
+    const int numCoords = int(_centers.size());
+    if (numCoords == 0) {
+        terms[0] = 1;
+        return;
+    }
+    const int numTerms = int(_exponents.size()) / numCoords;
+    const int numPowers = get_order() + 1;
+    std::vector<double> powers(numCoords * numPowers);
+    for (int i = 0; i < numCoords; ++i) {
+        powers[i * numPowers] = 1;
+        for (int p = 1; p < numPowers; ++p)
+            powers[i * numPowers + p] = powers[i * numPowers + p - 1] * x[i];
+    }
+    for (int t = 0; t < numTerms; ++t) {
+        const int* exponents = _exponents.data() + t * numCoords;
+        double term = 1;
+        for (int i = 0; i < numCoords; ++i)
+            term *= powers[i * numPowers + exponents[i]];
+        terms[t] = term;
+    }
+}
+
+double PolynomialPath::calcPolynomial(const double* x,
+                                      double* gradient) const {
+    const int numCoords = int(_centers.size());
+    const int numTerms = getProperty_coefficients().size();
+    const int numPowers = get_order() + 1;
+    std::vector<double> powers(numCoords * numPowers);
+    for (int i = 0; i < numCoords; ++i) {
+        powers[i * numPowers] = 1;
+        for (int p = 1; p < numPowers; ++p)
+            powers[i * numPowers + p] = powers[i * numPowers + p - 1] * x[i];
+    }
+
+    double value = 0;
+    if (gradient) std::fill(gradient, gradient + numCoords, 0.0);
+    for (int t = 0; t < numTerms; ++t) {
+        const int* exponents = _exponents.data() + t * numCoords;
+        const double coefficient = get_coefficients(t);
+        double term = coefficient;
+        for (int i = 0; i < numCoords; ++i)
+            term *= powers[i * numPowers + exponents[i]];
+        value += term;
+        if (!gradient) continue;
+        for (int i = 0; i < numCoords; ++i) {
+            if (exponents[i] == 0) continue;
+            double partial = coefficient * exponents[i];
+            for (int j = 0; j < numCoords; ++j)
+                partial *= powers[j * numPowers + exponents[j] - (j == i)];
+            gradient[i] += partial;
+        }
+    }
+    return value;
+}
+
+const SimTK::Vector& PolynomialPath::getLengthAndPartials(
+        const SimTK::State& s) const {
+    if (isCacheVariableValid(s, _lengthAndPartialsCV))
+        return getCacheVariableValue(s, _lengthAndPartialsCV);
+
+    const int numCoords = int(_coordinates.size());
+    std::vector<double> x(numCoords);
+    for (int i = 0; i < numCoords; ++i)
+        x[i] = (_coordinates[i]->getValue(s) - _centers[i]) / _halfRanges[i];
+
+    SimTK::Vector& lengthAndPartials =
+        updCacheVariableValue(s, _lengthAndPartialsCV);
+    lengthAndPartials[0] = calcPolynomial(x.data(),
+            numCoords > 0 ? &lengthAndPartials[1] : nullptr);
+    // Convert to derivatives with respect to the unscaled coordinates.
+    for (int i = 0; i < numCoords; ++i)
+        lengthAndPartials[i + 1] /= _halfRanges[i];
+    markCacheVariableValid(s, _lengthAndPartialsCV);
+    return lengthAndPartials;
+}
+
+double PolynomialPath::getLength(const SimTK::State& s) const {
+    return getLengthAndPartials(s)[0];
+}
+
+double PolynomialPath::getLengtheningSpeed(const SimTK::State& s) const {
+    if (isCacheVariableValid(s, _lengtheningSpeedCV))
+        return getCacheVariableValue(s, _lengtheningSpeedCV);
+
+    const SimTK::Vector& lengthAndPartials = getLengthAndPartials(s);
+    double speed = 0;
+    for (int i = 0; i < int(_coordinates.size()); ++i)
+        speed += lengthAndPartials[i + 1] * _coordinates[i]->getSpeedValue(s);
+    setCacheVariableValue(s, _lengtheningSpeedCV, speed);
+    return speed;
+}
+
+void PolynomialPath::addInEquivalentForces(const SimTK::State& s,
+        const double& tension,
+        SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
+        SimTK::Vector& mobilityForces) const {
+    const SimTK::SimbodyMatterSubsystem& matter =
+        getModel().getMatterSubsystem();
+    const SimTK::Vector& lengthAndPartials = getLengthAndPartials(s);
+    // The generalized force that does the same power as the tension:
+    // f_i * qdot_i = -tension * dL/dq_i * qdot_i.
+    for (int i = 0; i < int(_coordinates.size()); ++i) {
+        const Coordinate& coord = *_coordinates[i];
+        matter.getMobilizedBody(coord.getBodyIndex()).applyOneMobilityForce(s,
+                coord.getMobilizerQIndex(),
+                -tension * lengthAndPartials[i + 1], mobilityForces);
+    }
+}
+
+double PolynomialPath::computeMomentArm(const SimTK::State& s,
+                                        const Coordinate& aCoord) const {
+    if (getModel().getConstraintSet().getSize() > 0)
+        return Super::computeMomentArm(s, aCoord);
+
+    for (int i = 0; i < int(_coordinates.size()); ++i)
+        if (_coordinates[i].get() == &aCoord)
+            return -getLengthAndPartials(s)[i + 1];
+    return 0;
+}
@@ -0,0 +1,176 @@
+#ifndef OPENSIM_POLYNOMIAL_PATH_H_
+#define OPENSIM_POLYNOMIAL_PATH_H_
+/* -------------------------------------------------------------------------- *
+ *                         OpenSim:  PolynomialPath.h                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "GeometryPath.h"
+
+namespace OpenSim {
+
+class Coordinate;
+
+//=============================================================================
+//=============================================================================
+/**
+ * A GeometryPath whose length is a polynomial of the coordinates that it
+ * depends on, fitted to the length of another GeometryPath with fit(). The
+ * lengthening speed and the moment arms come from the analytic derivatives of
+ * the polynomial, so evaluating the path does not involve the path points,
+ * wrapping or the MomentArmSolver (unless the model has constraints that
+ * couple coordinates; see computeMomentArm()).
+ *
+ * The polynomial includes all the terms of total degree up to `order` in the
+ * coordinates, each scaled to [-1, 1] over the range used for the fit. The
+ * length is only accurate within those ranges.
+ *
+ * A %PolynomialPath keeps the points and wrap objects of the path it was
+ * created from, but only uses them for drawing. Replace the GeometryPath of a
+ * PathActuator or Muscle with a fitted %PolynomialPath as follows:
+ * @code
+ * PolynomialPath path(muscle.getGeometryPath());
+ * path.fit(model, muscle.getGeometryPath());
+ * log_info("RMS length error: {} m", path.get_rms_length_error());
+ * muscle.updProperty_GeometryPath().setValue(path);
+ * model.finalizeConnections();
+ * @endcode
+ *
+ * Components that apply their tension through getPointForceDirections()
+ * (PathSpring and Ligament) use the points, not the polynomial. The
+ * polynomial is not scaled with the model; fit it again after scaling.
+ */
+class OSIMSIMULATION_API PolynomialPath : public GeometryPath {
+OpenSim_DECLARE_CONCRETE_OBJECT(PolynomialPath, GeometryPath);
+public:
+//=============================================================================
+// PROPERTIES
+//=============================================================================
+    OpenSim_DECLARE_LIST_PROPERTY(coordinates, std::string,
+        "Names of the coordinates that the length of the path depends on.");
+    OpenSim_DECLARE_LIST_PROPERTY(coordinate_minimums, double,
+        "Minimum value of each coordinate used for the fit.");
+    OpenSim_DECLARE_LIST_PROPERTY(coordinate_maximums, double,
+        "Maximum value of each coordinate used for the fit.");
+    OpenSim_DECLARE_PROPERTY(order, int,
+        "Maximum total degree of the terms of the polynomial.");
+    OpenSim_DECLARE_LIST_PROPERTY(coefficients, double,
+        "Coefficients of the terms of the polynomial, by increasing total "
+        "degree and, for the same degree, by decreasing exponent of the first "
+        "coordinate, then of the second, and so on.");
+    OpenSim_DECLARE_PROPERTY(rms_length_error, double,
+        "Root-mean-square difference between the length of this path and of "
+        "the fitted path, over samples not used for the fit (set by fit()).");
+    OpenSim_DECLARE_PROPERTY(max_length_error, double,
+        "Largest difference between the length of this path and of the "
+        "fitted path over the same samples (set by fit()).");
+    OpenSim_DECLARE_PROPERTY(rms_moment_arm_error, double,
+        "Root-mean-square difference between the derivatives of the length "
+        "with respect to the coordinates and finite differences of the length "
+        "of the fitted path, over the same samples (set by fit()).");
+
+//=============================================================================
+// METHODS
+//=============================================================================
+    PolynomialPath();
+    /** Create a path with the same points, wrap objects and appearance as
+    `path`. Call fit() before using it.                                       */
+    explicit PolynomialPath(const GeometryPath& path);
+
+    /** Fit the polynomial to the length of `path`, a GeometryPath of `model`,
+    which must have a valid system (see Model::initSystem()). The coordinates
+    whose value changes the length of `path` over their range (with the other
+    coordinates at their default values) are chosen, and the polynomial is
+    fitted by least squares to the length at `numSamples` random poses within
+    their ranges. The errors are computed over as many other poses.
+    @param model      the model that `path` is part of.
+    @param path       the path to fit.
+    @param order      maximum total degree of the terms.
+    @param numSamples number of poses used for the fit; by default, 4 times the
+                      number of terms (at least 100).                         */
+    void fit(const Model& model, const GeometryPath& path, int order = 5,
+             int numSamples = 0);
+
+    /** The number of terms of a polynomial of the given order in the given
+    number of coordinates.                                                    */
+    static int getNumTerms(int numCoordinates, int order);
+
+    /** Length of the path, from the polynomial.                              */
+    double getLength(const SimTK::State& s) const override;
+    /** Lengthening speed of the path: the sum, over the coordinates, of the
+    derivative of the length with respect to the coordinate times its
+    speed.                                                                    */
+    double getLengtheningSpeed(const SimTK::State& s) const override;
+    /** Apply the generalized force -tension * dL/dq to each coordinate. No
+    body forces are applied.                                                  */
+    void addInEquivalentForces(const SimTK::State& state,
+            const double& tension,
+            SimTK::Vector_<SimTK::SpatialVec>& bodyForces,
+            SimTK::Vector& mobilityForces) const override;
+    /** The moment arm is -dL/dq for the given coordinate (0 if the length does
+    not depend on it). If the model has constraints, which may couple the
+    coordinate to others, the MomentArmSolver is used instead.                */
+    double computeMomentArm(const SimTK::State& s,
+            const Coordinate& aCoord) const override;
+
+    /** The polynomial is not scaled; this logs a warning.                    */
+    void extendPostScale(const SimTK::State& s,
+                         const ScaleSet& scaleSet) override;
+
+protected:
+    void extendFinalizeFromProperties() override;
+    void extendConnectToModel(Model& model) override;
+    void extendAddToSystem(SimTK::MultibodySystem& system) const override;
+
+private:
+    void constructProperties();
+
+    /** Compute the length and its derivatives with respect to the
+    coordinates, if not already valid in the cache.                           */
+    const SimTK::Vector& getLengthAndPartials(const SimTK::State& s) const;
+
+    /** Evaluate the polynomial, and its gradient if `gradient` is not null,
+    at the scaled coordinate values `x`.                                      */
+    double calcPolynomial(const double* x, double* gradient) const;
+
+    /** Value of each term of the polynomial at the scaled coordinates `x`.  */
+    void calcTerms(const double* x, double* terms) const;
+
+    /** Exponents of the coordinates in each term, one row per term.          */
+    std::vector<int> _exponents;
+    /** Center and half-width of the range of each coordinate.                */
+    std::vector<double> _centers;
+    std::vector<double> _halfRanges;
+
+    std::vector<SimTK::ReferencePtr<const Coordinate>> _coordinates;
+
+    /** The length followed by its derivative with respect to each
+    coordinate.                                                               */
+    mutable CacheVariable<SimTK::Vector> _lengthAndPartialsCV;
+    mutable CacheVariable<double> _lengtheningSpeedCV;
+
+//=============================================================================
+};  // END of class PolynomialPath
+//=============================================================================
+//=============================================================================
+
+} // end of namespace OpenSim
+
+#endif // OPENSIM_POLYNOMIAL_PATH_H_
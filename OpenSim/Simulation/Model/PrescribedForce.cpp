@@ -127,6 +127,26 @@ void PrescribedForce::constructProperties()
     constructProperty_torqueFunctions(FunctionSet());
 }
 
+void PrescribedForce::extendFinalizeFromProperties()
+{
+    Super::extendFinalizeFromProperties();
+
+    // Try to evaluate all the components together.
+    _dataFunctions = PiecewiseVectorFunction();
+    _forceChannel = _pointChannel = _torqueChannel = -1;
+    std::vector<const Function*> functions;
+    auto addFunctions = [&functions](const FunctionSet& set, int& channel) {
+        if (set.getSize() != 3) return;
+        channel = (int)functions.size();
+        for (int i = 0; i < 3; ++i)
+            functions.push_back(&set[i]);
+    };
+    addFunctions(getForceFunctions(), _forceChannel);
+    addFunctions(getPointFunctions(), _pointChannel);
+    addFunctions(getTorqueFunctions(), _torqueChannel);
+    PiecewiseVectorFunction::createFromFunctions(functions, _dataFunctions);
+}
+
 void PrescribedForce::setFrameName(const std::string& frameName) {
     updSocket<PhysicalFrame>("frame").setConnecteePath(frameName);
 }
@@ -251,7 +271,6 @@ void PrescribedForce::computeForce(const SimTK::State& state,
     const FunctionSet& torqueFunctions = getTorqueFunctions();
 
     double time = state.getTime();
-    SimTK::Vector  timeAsVector(1, time);
 
     const bool hasForceFunctions  = forceFunctions.getSize()==3;
     const bool hasPointFunctions  = pointFunctions.getSize()==3;
@@ -260,19 +279,29 @@ void PrescribedForce::computeForce(const SimTK::State& state,
     const PhysicalFrame& frame =
         getSocket<PhysicalFrame>("frame").getConnectee();
     const Ground& gnd = getModel().getGround();
+
+    // Evaluate all the components at once, if possible.
+    double data[9];
+    const bool useData = useDataFunctions();
+    if (useData)
+        _dataFunctions.calcValue(time, data);
+    auto getVec3 = [&](int channel, const FunctionSet& functions) -> Vec3 {
+        if (useData)
+            return Vec3(data[channel], data[channel+1], data[channel+2]);
+        return Vec3(functions[0].calcValue(time), 
+                    functions[1].calcValue(time), 
+                    functions[2].calcValue(time));
+    };
+
     if (hasForceFunctions) {
-        Vec3 force(forceFunctions[0].calcValue(timeAsVector), 
-                   forceFunctions[1].calcValue(timeAsVector), 
-                   forceFunctions[2].calcValue(timeAsVector));
+        Vec3 force = getVec3(_forceChannel, forceFunctions);
         if (!forceIsGlobal)
             force = frame.expressVectorInAnotherFrame(state, force, gnd);
 
         Vec3 point(0); // Default is body origin.
         if (hasPointFunctions) {
             // Apply force to a specified point on the body.
-            point = Vec3(pointFunctions[0].calcValue(timeAsVector), 
-                         pointFunctions[1].calcValue(timeAsVector), 
-                         pointFunctions[2].calcValue(timeAsVector));
+            point = getVec3(_pointChannel, pointFunctions);
             if (pointIsGlobal)
                 point = gnd.findStationLocationInAnotherFrame(state, point, frame);
 
@@ -280,9 +309,7 @@ void PrescribedForce::computeForce(const SimTK::State& state,
         applyForceToPoint(state, frame, point, force, bodyForces);
     }
     if (hasTorqueFunctions){
-        Vec3 torque(torqueFunctions[0].calcValue(timeAsVector), 
-                    torqueFunctions[1].calcValue(timeAsVector), 
-                    torqueFunctions[2].calcValue(timeAsVector));
+        Vec3 torque = getVec3(_torqueChannel, torqueFunctions);
         if (!forceIsGlobal)
             torque = frame.expressVectorInAnotherFrame(state, torque, gnd);
 
@@ -300,10 +327,12 @@ Vec3 PrescribedForce::getForceAtTime(double aTime) const
     if (forceFunctions.getSize() != 3)
         return Vec3(0);
 
-    const SimTK::Vector timeAsVector(1, aTime);
-    const Vec3 force(forceFunctions[0].calcValue(timeAsVector), 
-                     forceFunctions[1].calcValue(timeAsVector), 
-                     forceFunctions[2].calcValue(timeAsVector));
+    if (useDataFunctions())
+        return _dataFunctions.calcVec3(aTime, _forceChannel);
+
+    const Vec3 force(forceFunctions[0].calcValue(aTime), 
+                     forceFunctions[1].calcValue(aTime), 
+                     forceFunctions[2].calcValue(aTime));
     return force;
 }
 
@@ -314,10 +343,12 @@ Vec3 PrescribedForce::getPointAtTime(double aTime) const
     if (pointFunctions.getSize() != 3)
         return Vec3(0);
 
-    const SimTK::Vector timeAsVector(1, aTime);
-    const Vec3 point(pointFunctions[0].calcValue(timeAsVector), 
-                     pointFunctions[1].calcValue(timeAsVector), 
-                     pointFunctions[2].calcValue(timeAsVector));
+    if (useDataFunctions())
+        return _dataFunctions.calcVec3(aTime, _pointChannel);
+
+    const Vec3 point(pointFunctions[0].calcValue(aTime), 
+                     pointFunctions[1].calcValue(aTime), 
+                     pointFunctions[2].calcValue(aTime));
     return point;
 }
 
@@ -328,10 +359,12 @@ Vec3 PrescribedForce::getTorqueAtTime(double aTime) const
     if (torqueFunctions.getSize() != 3)
         return Vec3(0);
 
-    const SimTK::Vector timeAsVector(1, aTime);
-    const Vec3 torque(torqueFunctions[0].calcValue(timeAsVector), 
-                      torqueFunctions[1].calcValue(timeAsVector), 
-                      torqueFunctions[2].calcValue(timeAsVector));
+    if (useDataFunctions())
+        return _dataFunctions.calcVec3(aTime, _torqueChannel);
+
+    const Vec3 torque(torqueFunctions[0].calcValue(aTime), 
+                      torqueFunctions[1].calcValue(aTime), 
+                      torqueFunctions[2].calcValue(aTime));
     return torque;
 }
 
@@ -391,8 +424,6 @@ OpenSim::Array<double> PrescribedForce::getRecordValues(const SimTK::State& stat
     const bool appliesTorque  = torqueFunctions.getSize()==3;
 
     // This is bad as it duplicates the code in computeForce we'll cleanup after it works!
-    const double time = state.getTime();
-    const SimTK::Vector timeAsVector(1, time);
     const PhysicalFrame& frame =
         getSocket<PhysicalFrame>("frame").getConnectee();
     const Ground& gnd = getModel().getGround();
@@ -24,6 +24,7 @@
  * -------------------------------------------------------------------------- */
 // INCLUDE
 #include "OpenSim/Common/FunctionSet.h"
+#include "OpenSim/Common/PiecewiseVectorFunction.h"
 #include "Force.h"
 
 namespace OpenSim {
@@ -272,6 +273,9 @@ protected:
         SimTK::Vector_<SimTK::SpatialVec>& bodyForces, 
         SimTK::Vector&                     generalizedForces) const override;
 
+    /** Combine the force, point and torque functions, if possible. **/
+    void extendFinalizeFromProperties() override;
+
 //==============================================================================
 // DATA
 //==============================================================================
@@ -279,6 +283,24 @@ private:
     void setNull();
     void constructProperties();
 
+    /** Whether _dataFunctions can be used in place of the functions in the
+    properties. **/
+    bool useDataFunctions() const {
+        return _dataFunctions.getNumChannels() > 0 &&
+               isObjectUpToDateWithProperties();
+    }
+
+    /** The force, point and torque functions combined into a single function
+    of time when they are all PiecewiseLinearFunction or all GCVSpline over
+    the same times, so that their components are evaluated together. Empty
+    otherwise. **/
+    PiecewiseVectorFunction _dataFunctions;
+    /** Channel of _dataFunctions holding the x component of the force, point
+    and torque; -1 if there are no functions for that quantity. **/
+    int _forceChannel{-1};
+    int _pointChannel{-1};
+    int _torqueChannel{-1};
+
 //=============================================================================
 };  // END of class PrescribedForce
 //=============================================================================
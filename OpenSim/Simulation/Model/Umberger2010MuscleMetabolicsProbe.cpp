@@ -29,12 +29,20 @@
 #include "Umberger2010MuscleMetabolicsProbe.h"
 #include <OpenSim/Simulation/Model/Model.h>
 #include <OpenSim/Simulation/Model/Muscle.h>
-//#define DEBUG_METABOLICS
+
+#include <algorithm>
 
 using namespace std;
 using namespace SimTK;
 using namespace OpenSim;
 
+namespace {
+// The number of muscles whose activation, shortening and work rates are
+// computed together; the eleven per-muscle arrays of a block are about
+// 5.5 kB of stack.
+const int BlockSize = 64;
+}
+
 
 //=============================================================================
 // CONSTRUCTOR(S) AND SETUP
@@ -130,6 +138,103 @@ void Umberger2010MuscleMetabolicsProbe::extendConnectToModel(Model& aModel)
         connectIndividualMetabolicMuscle(aModel, 
             upd_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet()[i]);
     }
+    bindMetabolicMuscles();
+}
+
+//_____________________________________________________________________________
+/**
+ * Add a channel to the muscle_metabolic_rate output for each muscle in the
+ * MetabolicMuscleParameterSet.
+ */
+void Umberger2010MuscleMetabolicsProbe::extendFinalizeFromProperties()
+{
+    Super::extendFinalizeFromProperties();
+
+    auto& rateOutput = updOutput("muscle_metabolic_rate");
+    rateOutput.clearChannels();
+    for (int i=0; i<getNumMetabolicMuscles(); ++i) {
+        rateOutput.addChannel(
+            get_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet()[i].getName());
+    }
+}
+
+//_____________________________________________________________________________
+/**
+ * Allocate the cache variable that holds the metabolic power of each muscle.
+ */
+void Umberger2010MuscleMetabolicsProbe::
+    extendAddToSystem(SimTK::MultibodySystem& system) const
+{
+    Super::extendAddToSystem(system);
+
+    this->_muscleMetabolicRatesCV = addCacheVariable("muscle_metabolic_rates",
+        MuscleMetabolicRates(), SimTK::Stage::Dynamics);
+}
+
+//_____________________________________________________________________________
+/**
+ * Copy the muscle pointers and the parameters used to compute the metabolic
+ * rates from the MetabolicMuscleParameterSet into flat arrays.
+ */
+void Umberger2010MuscleMetabolicsProbe::
+    fillMetabolicMuscleArrays(MetabolicMuscleArrays& arrays) const
+{
+    const auto& mmSet =
+        get_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet();
+    const int nM = mmSet.getSize();
+
+    arrays.muscles.resize(nM);
+    arrays.muscleMass.resize(nM);
+    arrays.ratioSlowTwitchFibers.resize(nM);
+    arrays.optimalFiberLength.resize(nM);
+    arrays.maxContractionVelocity.resize(nM);
+    for (int i=0; i<nM; ++i) {
+        const auto& mm = mmSet[i];
+        const Muscle* m = mm.getMuscle();
+        arrays.muscles[i] = m;
+        arrays.muscleMass[i] = m ? mm.calcMuscleMass() : SimTK::NaN;
+        arrays.ratioSlowTwitchFibers[i] = mm.get_ratio_slow_twitch_fibers();
+        arrays.optimalFiberLength[i] =
+            m ? m->getOptimalFiberLength() : SimTK::NaN;
+        arrays.maxContractionVelocity[i] =
+            m ? m->getMaxContractionVelocity() : SimTK::NaN;
+    }
+}
+
+
+//_____________________________________________________________________________
+/**
+ * Bind the arrays used to compute the metabolic rates, and index them by
+ * muscle name.
+ */
+void Umberger2010MuscleMetabolicsProbe::bindMetabolicMuscles()
+{
+    fillMetabolicMuscleArrays(_metabolicMuscles);
+    const auto& mmSet =
+        get_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet();
+    _muscleIndex.clear();
+    for (int i=0; i<mmSet.getSize(); ++i)
+        _muscleIndex[mmSet[i].getName()] = i;
+    ++_parametersVersion;
+}
+
+//_____________________________________________________________________________
+/**
+ * Check that no property that the bound arrays were copied from has been
+ * edited since the probe was connected.
+ */
+bool Umberger2010MuscleMetabolicsProbe::isBoundToCurrentProperties() const
+{
+    if (!isObjectUpToDateWithProperties()) return false;
+    const auto& mmSet =
+        get_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet();
+    for (int i=0; i<mmSet.getSize(); ++i) {
+        const auto& mm = mmSet[i];
+        if (!mm.isObjectUpToDateWithProperties()) return false;
+        const Muscle* m = mm.getMuscle();
+        if (m && !m->isObjectUpToDateWithProperties()) return false;
+    }
+    return true;
 }
 
 //_____________________________________________________________________________
@@ -235,8 +340,7 @@ void Umberger2010MuscleMetabolicsProbe::connectIndividualMetabolicMuscle(
 SimTK::Vector Umberger2010MuscleMetabolicsProbe::computeProbeInputs(const State& s) const
 {
     // Initialize metabolic energy rate values.
-    double AMdot, Sdot, Bdot, Wdot;
-    AMdot = Sdot = Bdot = Wdot = 0;
+    double Bdot = 0;
     Vector EdotOutput(getNumProbeInputs());
     EdotOutput = 0;
 
@@ -257,242 +361,276 @@ SimTK::Vector Umberger2010MuscleMetabolicsProbe::computeProbeInputs(const State&
         EdotOutput(1) = Bdot;    // BASAL metabolic power storage
     
 
-    // Loop through each muscle in the MetabolicMuscleParameterSet
-    const int nM = 
-        get_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet()
-        .getSize();
-    for (int i=0; i<nM; ++i)
+    // TOTAL METABOLIC ENERGY RATE for each muscle in the
+    // MetabolicMuscleParameterSet (W).
+    // ------------------------------------------
+    const Vector& Edot = getMuscleMetabolicRates(s);
+    for (int i=0; i<Edot.size(); ++i)
     {
-        // Get the current muscle parameters from the MetabolicMuscleParameterSet
-        // and the corresponding OpenSim::Muscle pointer from the muscleMap.
-        Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameter& mm = 
-            get_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet()[i];
-        const Muscle* m = mm.getMuscle();
-
-        // Get some muscle properties at the current time state
-        //const double max_isometric_force = m->getMaxIsometricForce();
-        const double max_shortening_velocity = m->getMaxContractionVelocity();
-        const double activation = get_muscle_effort_scaling_factor()
-                                  * m->getActivation(s);
-        const double excitation = get_muscle_effort_scaling_factor()
-                                  * m->getControl(s);
-        double fiber_force_active = get_muscle_effort_scaling_factor()
-                                    * m->getActiveFiberForce(s);
-        const double fiber_length_normalized = m->getNormalizedFiberLength(s);
-        const double fiber_velocity = m->getFiberVelocity(s);
-        double A;
-
-        // Umberger defines fiber_velocity_normalized as Vm/LoM, not Vm/Vmax (p101, top left, Umberger(2003))
-        //const double fiber_velocity_normalized = m->getNormalizedFiberVelocity(s);
-        const double fiber_velocity_normalized = fiber_velocity / m->getOptimalFiberLength();
-
-
-        // ---------------------------------------------------------------------------
-        // NOT USED FOR THIS IMPLEMENTATION
-        //const double slow_twitch_excitation = mm.get_ratio_slow_twitch_fibers() * sin(Pi/2 * excitation);
-        //const double fast_twitch_excitation = (1 - mm.get_ratio_slow_twitch_fibers()) * (1 - cos(Pi/2 * excitation));
+        EdotOutput(0) += Edot[i];    // Add to TOTAL metabolic power storage
+        if (!get_report_total_metabolics_only()) {
+            // Metabolic power storage for muscle i
+            EdotOutput(i+2) = Edot[i];
+        }
+    }
 
-        // Set normalized hill constants: A_rel and B_rel
-        //const double A_rel = 0.1 + 0.4*(1 - mm.get_ratio_slow_twitch_fibers());
-        //const double B_rel = A_rel * max_shortening_velocity;
-        // ---------------------------------------------------------------------------
+    return EdotOutput;
+}
 
 
-        // Set activation dependence scaling parameter: A
-        if (excitation > activation)
-            A = excitation;
-        else
-            A = (excitation + activation) / 2;
+//_____________________________________________________________________________
+/**
+ * Get the metabolic power of each muscle, computing it if it is not already
+ * cached in the state.
+ */
+const SimTK::Vector& Umberger2010MuscleMetabolicsProbe::
+    getMuscleMetabolicRates(const State& s) const
+{
+    OPENSIM_THROW_IF_FRMOBJ(!isEnabled(), Exception,
+        "Cannot get the muscle metabolic rates because the probe has been "
+        "disabled.");
+
+    // If properties have been edited in place since the probe was connected,
+    // the bound arrays may hold stale values, so the rates are computed from
+    // arrays filled from the current properties, and are not reused. The
+    // parameter setters rebind the arrays without a state, so rates cached
+    // with an earlier binding are recomputed.
+    if (!isBoundToCurrentProperties()) {
+        MetabolicMuscleArrays arrays;
+        fillMetabolicMuscleArrays(arrays);
+        for (const Muscle* m : arrays.muscles) {
+            OPENSIM_THROW_IF_FRMOBJ(!m, Exception,
+                "A muscle of the MetabolicMuscleParameterSet is not "
+                "connected; call initSystem() on the model first.");
+        }
+        MuscleMetabolicRates& mmr =
+            updCacheVariableValue(s, _muscleMetabolicRatesCV);
+        calcMuscleMetabolicRates(s, arrays, mmr.rates);
+        mmr.parametersVersion = -1;
+        markCacheVariableValid(s, _muscleMetabolicRatesCV);
+    } else if (!isCacheVariableValid(s, _muscleMetabolicRatesCV)
+            || getCacheVariableValue(s, _muscleMetabolicRatesCV)
+                .parametersVersion != _parametersVersion) {
+        MuscleMetabolicRates& mmr =
+            updCacheVariableValue(s, _muscleMetabolicRatesCV);
+        calcMuscleMetabolicRates(s, _metabolicMuscles, mmr.rates);
+        mmr.parametersVersion = _parametersVersion;
+        markCacheVariableValid(s, _muscleMetabolicRatesCV);
+    }
+    return getCacheVariableValue(s, _muscleMetabolicRatesCV).rates;
+}
 
-        // Normalized contractile element force-length curve
-        const double F_iso = m->getActiveForceLengthMultiplier(s);   
 
-        // Warnings
-        if (fiber_length_normalized < 0)
-            log_warn("t = {}), muscle '{}' has negative normalized fiber-length.",
-                    s.getTime(), m->getName()); 
+//_____________________________________________________________________________
+/**
+ * Get the metabolic power of a single muscle.
+ */
+double Umberger2010MuscleMetabolicsProbe::
+    getMuscleMetabolicRate(const State& s, const std::string& muscleName) const
+{
+    const auto it = _muscleIndex.find(muscleName);
+    OPENSIM_THROW_IF_FRMOBJ(it == _muscleIndex.end(), Exception,
+        "Muscle '" + muscleName + "' is not in the "
+        "MetabolicMuscleParameterSet.");
+    return getMuscleMetabolicRates(s)[it->second];
+}
 
 
+//_____________________________________________________________________________
+/**
+ * Compute the metabolic power of all the muscles (W). The muscles are
+ * processed in blocks: the muscle quantities of a block are gathered from the
+ * state first, and then each of the rates is computed for the whole block in
+ * a loop over arrays. The loop-invariant options are tested outside of the
+ * loops, and the branches inside the loops select between values.
+ */
+void Umberger2010MuscleMetabolicsProbe::
+    calcMuscleMetabolicRates(const State& s,
+        const MetabolicMuscleArrays& arrays, Vector& rates) const
+{
+    const int nM = int(arrays.muscles.size());
+    rates.resize(nM);
+
+    const double scale = get_muscle_effort_scaling_factor();
+    const double aerobicFactor = get_aerobic_factor();
+    const bool activationMaintenanceRateOn =
+        get_activation_maintenance_rate_on();
+    const bool shorteningRateOn = get_shortening_rate_on();
+    const bool mechanicalWorkRateOn = get_mechanical_work_rate_on();
+    const bool forbidNegativeTotalPower = get_forbid_negative_total_power();
+    const bool includeNegativeWork = get_include_negative_mechanical_work();
+    const bool enforceMinimumHeatRate =
+        get_enforce_minimum_heat_rate_per_muscle()
+        && activationMaintenanceRateOn && shorteningRateOn;
+    const double lengtheningFactor = includeNegativeWork ? 4.0 : 0.3;
+
+    double activation[BlockSize], excitation[BlockSize];
+    double fiber_force_active[BlockSize];
+    double fiber_length_normalized[BlockSize], fiber_velocity[BlockSize];
+    double F_iso[BlockSize], A[BlockSize], slowTwitchRatio[BlockSize];
+    double AMdot[BlockSize], Sdot[BlockSize], Wdot[BlockSize];
+
+    for (int begin = 0; begin < nM; begin += BlockSize) {
+        const int size = std::min(BlockSize, nM - begin);
+
+        // Get some muscle properties at the current time state.
+        for (int k = 0; k < size; ++k) {
+            const Muscle& m = *arrays.muscles[begin + k];
+            activation[k] = scale * m.getActivation(s);
+            excitation[k] = scale * m.getControl(s);
+            fiber_force_active[k] = scale * m.getActiveFiberForce(s);
+            fiber_length_normalized[k] = m.getNormalizedFiberLength(s);
+            fiber_velocity[k] = m.getFiberVelocity(s);
+            // Normalized contractile element force-length curve
+            F_iso[k] = m.getActiveForceLengthMultiplier(s);
+
+            // Warnings
+            if (fiber_length_normalized[k] < 0)
+                log_warn("t = {}), muscle '{}' has negative normalized "
+                        "fiber-length.", s.getTime(), m.getName());
+        }
 
-        // ACTIVATION & MAINTENANCE HEAT RATE for muscle i (W/kg)
-        // --> depends on the normalized fiber length of the contractile element
-        // -----------------------------------------------------------------------
-        double slowTwitchRatio = mm.get_ratio_slow_twitch_fibers();
+        // Set activation dependence scaling parameter: A
+        for (int k = 0; k < size; ++k) {
+            A[k] = (excitation[k] > activation[k]) ? excitation[k]
+                   : (excitation[k] + activation[k]) / 2;
+            slowTwitchRatio[k] = arrays.ratioSlowTwitchFibers[begin + k];
+        }
         if (get_use_Bhargava_recruitment_model()) {
-            const double uSlow = slowTwitchRatio * sin(0.5*Pi * excitation);
-            const double uFast = (1 - slowTwitchRatio)
-                                 * (1 - cos(0.5*Pi * excitation));
-            slowTwitchRatio = (excitation == 0) ? 1.0 : uSlow / (uSlow + uFast);
+            for (int k = 0; k < size; ++k) {
+                const double uSlow = slowTwitchRatio[k]
+                                     * sin(0.5*Pi * excitation[k]);
+                const double uFast = (1 - slowTwitchRatio[k])
+                                     * (1 - cos(0.5*Pi * excitation[k]));
+                slowTwitchRatio[k] = (excitation[k] == 0) ? 1.0
+                                     : uSlow / (uSlow + uFast);
+            }
         }
 
-        if (get_forbid_negative_total_power() ||
-            get_activation_maintenance_rate_on())
-        {
-            const double unscaledAMdot = 128*(1 - slowTwitchRatio) + 25;
 
-            if (fiber_length_normalized <= 1.0)
-                AMdot = get_aerobic_factor() * std::pow(A, 0.6) * unscaledAMdot;
-            else
-                AMdot = get_aerobic_factor() * std::pow(A, 0.6) * ((0.4 * unscaledAMdot) + (0.6 * unscaledAMdot * F_iso));
+        // ACTIVATION & MAINTENANCE HEAT RATE (W/kg)
+        // --> depends on the normalized fiber length of the contractile element
+        // -----------------------------------------------------------------------
+        if (forbidNegativeTotalPower || activationMaintenanceRateOn) {
+            for (int k = 0; k < size; ++k) {
+                const double unscaledAMdot = 128*(1 - slowTwitchRatio[k]) + 25;
+                AMdot[k] = aerobicFactor * std::pow(A[k], 0.6)
+                    * ((fiber_length_normalized[k] <= 1.0) ? unscaledAMdot
+                       : (0.4 * unscaledAMdot)
+                         + (0.6 * unscaledAMdot * F_iso[k]));
+            }
+        } else {
+            std::fill(AMdot, AMdot + size, 0.0);
         }
 
 
-
-        // SHORTENING HEAT RATE for muscle i (W/kg)
+        // SHORTENING HEAT RATE (W/kg)
         // --> depends on the normalized fiber length of the contractile element
         // --> note that we define Vm<0 as shortening and Vm>0 as lengthening
         // -----------------------------------------------------------------------
-        if (get_forbid_negative_total_power() || get_shortening_rate_on())
-        {
-            const double Vmax_fasttwitch = max_shortening_velocity;
-            const double Vmax_slowtwitch = max_shortening_velocity / 2.5;
-            const double alpha_shortening_fasttwitch = 153 / Vmax_fasttwitch;
-            const double alpha_shortening_slowtwitch = 100 / Vmax_slowtwitch;
-            double unscaledSdot, tmp_slowTwitch, tmp_fastTwitch;
-
-            if (fiber_velocity_normalized <= 0)    // concentric contraction, Vm<0
-            {
-                const double maxShorteningRate = 100.0;    // (W/kg)
-
-                tmp_slowTwitch = -alpha_shortening_slowtwitch * fiber_velocity_normalized;
-
-                // Apply upper limit to the unscaled slow twitch shortening rate.
-                if (tmp_slowTwitch > maxShorteningRate) {
-                    //cout << "WARNING: " << getName() << "  (t = " << s.getTime() << 
-                    //    "Slow twitch shortening heat rate exceeds the max value of " << maxShorteningRate << 
-                    //    " W/kg. Setting to " << maxShorteningRate << " W/kg." << endl; 
-                    tmp_slowTwitch = maxShorteningRate;
-                }
-
-                tmp_fastTwitch = alpha_shortening_fasttwitch * fiber_velocity_normalized * (1-slowTwitchRatio);
-                unscaledSdot = (tmp_slowTwitch * slowTwitchRatio) - tmp_fastTwitch;   // unscaled shortening heat rate: muscle shortening
-                Sdot = get_aerobic_factor() * std::pow(A, 2.0) * unscaledSdot;                      // scaled shortening heat rate: muscle shortening
+        if (forbidNegativeTotalPower || shorteningRateOn) {
+            for (int k = 0; k < size; ++k) {
+                const int i = begin + k;
+                const double Vmax_fasttwitch = arrays.maxContractionVelocity[i];
+                const double Vmax_slowtwitch =
+                    arrays.maxContractionVelocity[i] / 2.5;
+                const double alpha_shortening_fasttwitch = 153 / Vmax_fasttwitch;
+                const double alpha_shortening_slowtwitch = 100 / Vmax_slowtwitch;
+
+                // Umberger defines fiber_velocity_normalized as Vm/LoM, not
+                // Vm/Vmax (p101, top left, Umberger(2003))
+                const double fiber_velocity_normalized =
+                    fiber_velocity[k] / arrays.optimalFiberLength[i];
+
+                // Concentric contraction, Vm<0. The unscaled slow twitch
+                // shortening rate is limited to 100 W/kg.
+                const double tmp_slowTwitch = std::min(
+                    -alpha_shortening_slowtwitch * fiber_velocity_normalized,
+                    100.0);
+                const double tmp_fastTwitch = alpha_shortening_fasttwitch
+                    * fiber_velocity_normalized * (1-slowTwitchRatio[k]);
+                const double shortening = aerobicFactor * std::pow(A[k], 2.0)
+                    * ((tmp_slowTwitch * slowTwitchRatio[k]) - tmp_fastTwitch);
+
+                // Eccentric contraction, Vm>0.
+                const double lengthening = aerobicFactor * A[k]
+                    * (lengtheningFactor * alpha_shortening_slowtwitch
+                       * fiber_velocity_normalized);
+
+                // Fiber length dependence on scaled shortening heat rate
+                // (for both concentric and eccentric contractions).
+                Sdot[k] = ((fiber_velocity_normalized <= 0) ? shortening
+                           : lengthening)
+                          * ((fiber_length_normalized[k] > 1.0) ? F_iso[k]
+                             : 1.0);
             }
-
-            else    // eccentric contraction, Vm>0
-            {
-                unscaledSdot =
-                    (get_include_negative_mechanical_work() ? 4.0 : 0.3)
-                    * alpha_shortening_slowtwitch * fiber_velocity_normalized;  // unscaled shortening heat rate: muscle lengthening
-                Sdot = get_aerobic_factor() * A * unscaledSdot;                                // scaled shortening heat rate: muscle lengthening
-            }
-
-
-            // Fiber length dependence on scaled shortening heat rate
-            // (for both concentric and eccentric contractions).
-            if (fiber_length_normalized > 1.0)
-                Sdot *= F_iso;  
+        } else {
+            std::fill(Sdot, Sdot + size, 0.0);
         }
-        
 
 
-        // Clamp fiber force. THIS SHOULD NEVER HAPPEN...
-        if (fiber_force_active < 0)
-            fiber_force_active = 0.0;
-
-
-
-
-        // MECHANICAL WORK RATE for the contractile element of muscle i (W/kg).
+        // MECHANICAL WORK RATE for the contractile element (W/kg).
         // --> note that we define Vm<0 as shortening and Vm>0 as lengthening.
+        // Fiber force is clamped at zero. THIS SHOULD NEVER BE NEEDED...
         // -------------------------------------------------------------------
-        if (get_forbid_negative_total_power() || get_mechanical_work_rate_on())
-        {
-            if (get_include_negative_mechanical_work() || fiber_velocity <= 0)
-                Wdot = -fiber_force_active*fiber_velocity;
-            else
-                Wdot = 0;
-
-            Wdot /= mm.getMuscleMass();
+        if (forbidNegativeTotalPower || mechanicalWorkRateOn) {
+            for (int k = 0; k < size; ++k) {
+                const double force = (fiber_force_active[k] < 0) ? 0.0
+                                     : fiber_force_active[k];
+                Wdot[k] = ((includeNegativeWork || fiber_velocity[k] <= 0)
+                           ? -force*fiber_velocity[k] : 0)
+                          / arrays.muscleMass[begin + k];
+            }
+        } else {
+            std::fill(Wdot, Wdot + size, 0.0);
         }
 
 
         // If necessary, increase the shortening heat rate so that the total
         // power is non-negative.
-        if (get_forbid_negative_total_power()) {
-            const double Edot_Wkg_beforeClamp = AMdot + Sdot + Wdot;
-            if (Edot_Wkg_beforeClamp < 0)
-                Sdot -= Edot_Wkg_beforeClamp;
+        if (forbidNegativeTotalPower) {
+            for (int k = 0; k < size; ++k) {
+                const double Edot_Wkg_beforeClamp = AMdot[k] + Sdot[k] + Wdot[k];
+                Sdot[k] -= (Edot_Wkg_beforeClamp < 0) ? Edot_Wkg_beforeClamp
+                           : 0.0;
+            }
         }
 
 
         // NAN CHECKING
         // ------------------------------------------
-        if (isNaN(AMdot))
-            log_warn("{}  : AMdot ({}) = NaN!", getName(), m->getName());
-        if (isNaN(Sdot))
-            log_warn("{}  : Sdot ({}) = NaN!", getName(), m->getName());
-        if (isNaN(Wdot))
-            log_warn("{}  : Wdot ({}) = NaN!", getName(), m->getName());
-
-        // This check is from Umberger(2003), page 104: the total heat rate 
-        // (i.e., AMdot + Sdot) for a given muscle cannot fall below 1.0 W/kg.
-        // -----------------------------------------------------------------------
-        double totalHeatRate = AMdot + Sdot;
-
-        if(get_enforce_minimum_heat_rate_per_muscle() && totalHeatRate < 1.0 
-            && get_activation_maintenance_rate_on() 
-            && get_shortening_rate_on()) {
-                //cout << "WARNING: " << getName() 
-                //    << "  (t = " << s.getTime() 
-                //    << "), the muscle '" << mm.getName() 
-                //    << "' has a net metabolic energy rate of less than 1.0 W/kg." << endl; 
-                totalHeatRate = 1.0;            // not allowed to fall below 1.0 W.kg-1
+        for (int k = 0; k < size; ++k) {
+            const std::string& name = arrays.muscles[begin + k]->getName();
+            if (isNaN(AMdot[k]))
+                log_warn("{}  : AMdot ({}) = NaN!", getName(), name);
+            if (isNaN(Sdot[k]))
+                log_warn("{}  : Sdot ({}) = NaN!", getName(), name);
+            if (isNaN(Wdot[k]))
+                log_warn("{}  : Wdot ({}) = NaN!", getName(), name);
         }
-        
 
-        // TOTAL METABOLIC ENERGY RATE for muscle i
-        // UNITS: W
+
+        // TOTAL METABOLIC ENERGY RATE (W)
         // ------------------------------------------
-        double Edot = 0;
-
-        if (get_activation_maintenance_rate_on() && get_shortening_rate_on())
-            Edot += totalHeatRate;      // May have been clamped to 1.0 W/kg.
-        else {
-            if (get_activation_maintenance_rate_on())
-                Edot += AMdot;
-            if (get_shortening_rate_on())
-                Edot += Sdot;
+        for (int k = 0; k < size; ++k) {
+            // This check is from Umberger(2003), page 104: the total heat rate
+            // (i.e., AMdot + Sdot) for a given muscle cannot fall below
+            // 1.0 W/kg.
+            double totalHeatRate = AMdot[k] + Sdot[k];
+            if (enforceMinimumHeatRate && totalHeatRate < 1.0)
+                totalHeatRate = 1.0;
+
+            const double heatRate =
+                (activationMaintenanceRateOn && shorteningRateOn)
+                ? totalHeatRate     // May have been clamped to 1.0 W/kg.
+                : (activationMaintenanceRateOn ? AMdot[k] : 0)
+                  + (shorteningRateOn ? Sdot[k] : 0);
+
+            rates[begin + k] =
+                (heatRate + (mechanicalWorkRateOn ? Wdot[k] : 0))
+                * arrays.muscleMass[begin + k];
         }
-        if (get_mechanical_work_rate_on())
-            Edot += Wdot;
-        Edot *= mm.getMuscleMass();
-
-        EdotOutput(0) += Edot;       // Add to TOTAL metabolic power storage
-        if (!get_report_total_metabolics_only()) {
-            // Metabolic power storage for muscle i
-            EdotOutput(i+2) = Edot;  
-        }                          
-
-
-        
-
-#ifdef DEBUG_METABOLICS
-        cout << "muscle_mass = " << mm.getMuscleMass() << endl;
-        cout << "ratio_slow_twitch_fibers = " << slowTwitchRatio << endl;
-        cout << "bodymass = " << _model->getMatterSubsystem().calcSystemMass(s) << endl;
-        //cout << "max_isometric_force = " << max_isometric_force << endl;
-        cout << "activation = " << activation << endl;
-        cout << "excitation = " << excitation << endl;
-        //cout << "fiber_force_total = " << fiber_force_total << endl;
-        cout << "fiber_force_active = " << fiber_force_active << endl;
-        cout << "fiber_length_normalized = " << fiber_length_normalized << endl;
-        cout << "fiber_velocity = " << fiber_velocity << endl;
-        //cout << "slow_twitch_excitation = " << slow_twitch_excitation << endl;
-        //cout << "fast_twitch_excitation = " << fast_twitch_excitation << endl;
-        cout << "max shortening velocity = " << max_shortening_velocity << endl;
-        //cout << "A_rel = " << A_rel << endl;
-        //cout << "B_rel = " << B_rel << endl;
-        cout << "AMdot = " << AMdot << endl;
-        cout << "Sdot = " << Sdot << endl;
-        cout << "Bdot = " << Bdot << endl;
-        cout << "Wdot = " << Wdot << endl;
-        cout << "Edot = " << Edot << endl;
-        std::cin.get();
-#endif
     }
-
-    return EdotOutput;
 }
 
 
@@ -634,6 +772,7 @@ void Umberger2010MuscleMetabolicsProbe::
     mm->set_use_provided_muscle_mass(true);
     mm->set_provided_muscle_mass(providedMass);
     mm->setMuscleMass();      // actual mass used.
+    bindMetabolicMuscles();
 }
 
 
@@ -650,6 +789,7 @@ void Umberger2010MuscleMetabolicsProbe::
 
     mm->set_use_provided_muscle_mass(false);
     mm->setMuscleMass();       // actual mass used.
+    bindMetabolicMuscles();
 }
 
 
@@ -696,6 +836,7 @@ void Umberger2010MuscleMetabolicsProbe::
     setRatioSlowTwitchFibers(const std::string& muscleName, const double& ratio) 
 { 
     updMetabolicParameters(muscleName)->set_ratio_slow_twitch_fibers(ratio);
+    bindMetabolicMuscles();
 }
 
 
@@ -825,16 +966,23 @@ Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameter(
 //--------------------------------------------------------------------------
 // Set muscle mass
 //--------------------------------------------------------------------------
+double Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameter::
+calcMuscleMass() const
+{ 
+    if (get_use_provided_muscle_mass())
+        return get_provided_muscle_mass();
+    return (_musc->getMaxIsometricForce() / get_specific_tension()) 
+           * get_density() 
+           * _musc->getOptimalFiberLength();
+}
+
 void Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameter::
 setMuscleMass()    
 { 
-    if (get_use_provided_muscle_mass())
-        _muscMass = get_provided_muscle_mass();
-    else {
-        _muscMass = (_musc->getMaxIsometricForce() / get_specific_tension()) 
-                    * get_density() 
-                    * _musc->getOptimalFiberLength();
-        }
+    _muscMass = calcMuscleMass();
+    // The probe binds the parameters after it sets their masses, so they are
+    // up to date with the values it binds until they are edited.
+    setObjectIsUpToDateWithProperties();
 }
 
 
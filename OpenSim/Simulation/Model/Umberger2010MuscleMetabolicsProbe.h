@@ -302,6 +302,15 @@ public:
         "A set containing, for each muscle, the parameters "
         "required to calculate muscle metabolic power.");
 
+//==============================================================================
+// OUTPUTS
+//==============================================================================
+    /** The metabolic power (W) of each muscle, with one channel per muscle in
+    the MetabolicMuscleParameterSet, named after the muscle. See
+    getMuscleMetabolicRate(). **/
+    OpenSim_DECLARE_LIST_OUTPUT(muscle_metabolic_rate, double,
+            getMuscleMetabolicRate, SimTK::Stage::Dynamics);
+
 //=============================================================================
 // PUBLIC METHODS
 //=============================================================================
@@ -339,6 +348,19 @@ public:
         to name your probe appropriately!  */
     virtual OpenSim::Array<std::string> getProbeOutputLabels() const override;
 
+    /** Get the metabolic power (W) of each muscle in the
+        MetabolicMuscleParameterSet, in the order of the set. These are the
+        values reported for the individual muscles by computeProbeInputs()
+        (before the gain and operation of the probe are applied). They are
+        computed for all the muscles together, once per realization to
+        Stage::Dynamics. */
+    const SimTK::Vector& getMuscleMetabolicRates(const SimTK::State& s) const;
+
+    /** Get the metabolic power (W) of a single muscle. This is the value of
+        the channel of the 'muscle_metabolic_rate' output for that muscle. */
+    double getMuscleMetabolicRate(const SimTK::State& s,
+                                  const std::string& muscleName) const;
+
 
     //-----------------------------------------------------------------------------
     /** @name     Umberger2010MuscleMetabolicsProbe Interface
@@ -425,10 +447,45 @@ private:
     //--------------------------------------------------------------------------
     MuscleMap _muscleMap;
 
+    // The muscles and their parameters, in the order of the
+    // MetabolicMuscleParameterSet, in arrays, so that the rates of all the
+    // muscles are computed in loops over the arrays.
+    struct MetabolicMuscleArrays {
+        std::vector<const Muscle*> muscles;
+        std::vector<double> muscleMass;
+        std::vector<double> ratioSlowTwitchFibers;
+        std::vector<double> optimalFiberLength;
+        std::vector<double> maxContractionVelocity;
+    };
+    // The arrays bound when the probe is connected or its parameters are
+    // set through the probe.
+    MetabolicMuscleArrays _metabolicMuscles;
+    // The index of each muscle in the arrays.
+    std::map<std::string, int> _muscleIndex;
+    // Incremented whenever the arrays above are rebound, so that rates
+    // cached with the previous parameters are not used.
+    int _parametersVersion = 0;
+
+    // The metabolic power of each muscle, and the _parametersVersion with
+    // which it was computed.
+    struct MuscleMetabolicRates {
+        SimTK::Vector rates;
+        int parametersVersion = -1;
+        friend std::ostream& operator<<(std::ostream& o,
+            const MuscleMetabolicRates& mmr) {
+            o << "Umberger2010MuscleMetabolicsProbe::MuscleMetabolicRates should not be "
+                 "serialized!" << std::endl;
+            return o;
+        }
+    };
+    mutable CacheVariable<MuscleMetabolicRates> _muscleMetabolicRatesCV;
+
     //--------------------------------------------------------------------------
     // ModelComponent Interface
     //--------------------------------------------------------------------------
+    void extendFinalizeFromProperties() override;
     void extendConnectToModel(Model& aModel) override;
+    void extendAddToSystem(SimTK::MultibodySystem& system) const override;
     void connectIndividualMetabolicMuscle
        (Model& aModel, 
         Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameter& mm);
@@ -436,6 +493,19 @@ private:
     void setNull();
     void constructProperties();
 
+    // Copy the muscle pointers and parameters from the
+    // MetabolicMuscleParameterSet into the arrays used by
+    // calcMuscleMetabolicRates().
+    void fillMetabolicMuscleArrays(MetabolicMuscleArrays& arrays) const;
+    void bindMetabolicMuscles();
+    // Whether the properties of the probe, of its MetabolicMuscleParameters
+    // and of their muscles are unchanged since the probe was connected, so
+    // that the bound arrays still hold their values.
+    bool isBoundToCurrentProperties() const;
+    void calcMuscleMetabolicRates(const SimTK::State& s,
+                                  const MetabolicMuscleArrays& arrays,
+                                  SimTK::Vector& rates) const;
+
 
     //--------------------------------------------------------------------------
     // MetabolicMuscleParameter Private Interface
@@ -510,6 +580,11 @@ public:
     //--------------------------------------------------------------------------
     const double& getMuscleMass() const      { return _muscMass; }
     void setMuscleMass();
+    /** The mass of the muscle from the current properties and muscle: the
+        <provided_muscle_mass>, or the mass calculated from the muscle's
+        Fmax and optimal fiber length. setMuscleMass() stores it as the mass
+        returned by getMuscleMass(). */
+    double calcMuscleMass() const;
 
     //--------------------------------------------------------------------------
     // Internal muscle pointer
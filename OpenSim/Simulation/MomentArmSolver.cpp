@@ -132,6 +132,50 @@ double MomentArmSolver::solve(const State &state, const Coordinate &aCoord,
     return ~_coupling*_generalizedForces;
 }
 
+void MomentArmSolver::solve(const State& state,
+        const SimTK::Array_<const Coordinate*>& coordinates,
+        const SimTK::Array_<const GeometryPath*>& paths,
+        SimTK::Matrix& momentArms) const
+{
+    //Local modifiable copy of the state
+    State& s_ma = _stateCopy;
+    s_ma.updQ() = state.getQ();
+
+    // compute the coupling between coordinates due to constraints, once for
+    // each coordinate, as the columns of the coupling matrix C
+    const int nc = (int)coordinates.size();
+    _couplingMatrix.resize(s_ma.getNU(), nc);
+    for (int j = 0; j < nc; ++j) {
+        _couplingMatrix(j) = computeCouplingVector(s_ma, *coordinates[j]);
+    }
+
+    // set speeds to zero
+    s_ma.updU() = 0;
+
+    const SimbodyMatterSubsystem& matter =
+        getModel().getMultibodySystem().getMatterSubsystem();
+    Vector pathDependentMobilityForces(s_ma.getNU());
+
+    momentArms.resize((int)paths.size(), nc);
+    for (int i = 0; i < (int)paths.size(); ++i) {
+        // zero out all the forces
+        _bodyForces *= 0;
+        pathDependentMobilityForces = 0;
+
+        // apply a tension of unity to the bodies of the path
+        paths[i]->addInEquivalentForces(s_ma, 1.0, _bodyForces,
+                pathDependentMobilityForces);
+
+        // f = ~J(q) * F, once per path regardless of the number of coordinates
+        matter.multiplyBySystemJacobianTranspose(s_ma, _bodyForces,
+                _generalizedForces);
+        _generalizedForces += pathDependentMobilityForces;
+
+        // moment-arms of this path about all coordinates: ~f * C
+        momentArms[i] = ~_generalizedForces * _couplingMatrix;
+    }
+}
+
 SimTK::Vector MomentArmSolver::computeCouplingVector(SimTK::State &state, 
         const Coordinate &coordinate) const
 {
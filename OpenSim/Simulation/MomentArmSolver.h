@@ -83,6 +83,22 @@ public:
     double solve(const SimTK::State& state, const Coordinate &coordinate, 
         const Array<PointForceDirection *> &pfds) const;
 
+    /** Solve for the effective moment-arms of several GeometryPaths about 
+        several coordinates at once. The generalized forces due to a unit 
+        tension in each path are computed once per path and the constraint
+        coupling is computed once per coordinate, so this is much cheaper than
+        calling solve() for every path and coordinate pair.
+    @param  state               current state of the model
+    @param  coordinates         Coordinates about which we want the moment-arms
+    @param  paths               GeometryPaths for which to calculate moment-arms
+    @param  momentArms          resulting moment-arms, resized to have one row
+                                per path and one column per coordinate
+    */
+    void solve(const SimTK::State& state,
+        const SimTK::Array_<const Coordinate*>& coordinates,
+        const SimTK::Array_<const GeometryPath*>& paths,
+        SimTK::Matrix& momentArms) const;
+
 private:
     // Internal state of the solver initialized as a copy of the default state
     mutable SimTK::State _stateCopy;
@@ -96,6 +112,9 @@ private:
     // Keep preallocated vector of the coupling constraint factors
     mutable SimTK::Vector _coupling;
 
+    // Keep preallocated matrix of the coupling factors of several coordinates
+    mutable SimTK::Matrix _couplingMatrix;
+
     // compute vector of constraint coupling factors
     SimTK::Vector computeCouplingVector(SimTK::State &state, 
         const Coordinate &coordinate) const;
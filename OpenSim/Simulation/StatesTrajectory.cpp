@@ -30,31 +30,95 @@
 
 using namespace OpenSim;
 
+const SimTK::State& StatesTrajectoryIterator::operator[](
+        difference_type n) const {
+    const size_t index =
+            static_cast<size_t>(static_cast<difference_type>(m_index) + n);
+    if (m_trajectory->m_storageMode == StatesTrajectory::StorageMode::Full) {
+        return m_trajectory->m_states[index];
+    }
+    m_trajectory->materializeState(index, m_state, m_stateIndex);
+    return *m_state;
+}
+
 size_t StatesTrajectory::getSize() const {
-    return m_states.size();
+    if (m_storageMode == StorageMode::Full) return m_states.size();
+    return m_frameSize == 0 ? 0 : m_buffer.size() / m_frameSize;
 }
 
 void StatesTrajectory::clear() {
     m_states.clear();
+    m_template.reset();
+    m_buffer.clear();
+    m_frameSize = 0;
+    m_stage = SimTK::Stage::Empty;
+    m_materializedStates.clear();
 }
 
 void StatesTrajectory::append(const SimTK::State& state) {
-    if (!m_states.empty()) {
+    if (getSize() > 0) {
+        const double lastTime = m_storageMode == StorageMode::Full ?
+                m_states.back().getTime() :
+                m_buffer[m_buffer.size() - m_frameSize];
 
-        SimTK_APIARGCHECK2_ALWAYS(m_states.back().getTime() <= state.getTime(),
+        SimTK_APIARGCHECK2_ALWAYS(lastTime <= state.getTime(),
                 "StatesTrajectory", "append",
                 "New state's time (%f) must be equal to or greater than the "
                 "time for the last state in the trajectory (%f).",
-                state.getTime(), m_states.back().getTime()
+                state.getTime(), lastTime
                 );
 
         // We assume the trajectory (before appending) is already consistent,
         // so we only need to check consistency with a single state in the
         // trajectory.
-        OPENSIM_THROW_IF(!m_states.back().isConsistent(state),
+        const SimTK::State& last = m_storageMode == StorageMode::Full ?
+                m_states.back() : *m_template;
+        OPENSIM_THROW_IF(!last.isConsistent(state),
           InconsistentState, state.getTime());
     }
-    m_states.push_back(state);
+    if (m_storageMode == StorageMode::Full) {
+        m_states.push_back(state);
+        return;
+    }
+
+    if (!m_template) {
+        m_template = std::make_shared<const SimTK::State>(state);
+        m_frameSize = 1 + state.getNY();
+        m_stage = state.getSystemStage();
+    } else if (state.getSystemStage() < m_stage) {
+        m_stage = state.getSystemStage();
+    }
+    const SimTK::Vector& y = state.getY();
+    m_buffer.push_back(state.getTime());
+    for (int i = 0; i < y.size(); ++i) m_buffer.push_back(y[i]);
+}
+
+const SimTK::State& StatesTrajectory::getMaterializedState(
+        size_t index) const {
+    // Growing the vector moves the pointers, not the states, so references
+    // to states already materialized stay valid.
+    if (m_materializedStates.size() < getSize())
+        m_materializedStates.resize(getSize());
+    std::unique_ptr<SimTK::State>& state = m_materializedStates[index];
+    if (!state) {
+        size_t stateIndex = index;
+        materializeState(index, state, stateIndex);
+    }
+    return *state;
+}
+
+void StatesTrajectory::materializeState(size_t index,
+        std::unique_ptr<SimTK::State>& state, size_t& stateIndex) const {
+    if (state && stateIndex == index) return;
+    // The state is created from the template once and then reused; only its
+    // time and Y change.
+    if (!state) state.reset(new SimTK::State(*m_template));
+    const double* values = &m_buffer[index * m_frameSize];
+    state->setTime(values[0]);
+    SimTK::Vector& y = state->updY();
+    for (int i = 0; i < y.size(); ++i) y[i] = values[1 + i];
+    if (m_system) m_system->realize(*state, m_stage);
+    stateIndex = index;
 }
 
 bool StatesTrajectory::hasIntegrity() const {
@@ -65,6 +129,13 @@ bool StatesTrajectory::isNondecreasingInTime() const {
     // An empty or size-1 trajectory necessarily has nondecreasing times.
     if (getSize() <= 1) return true;
 
+    if (m_storageMode == StorageMode::Compact) {
+        for (size_t i = m_frameSize; i < m_buffer.size(); i += m_frameSize) {
+            if (m_buffer[i] < m_buffer[i - m_frameSize]) return false;
+        }
+        return true;
+    }
+
     for (unsigned itime = 1; itime < getSize(); ++itime) {
 
         if (get(itime).getTime() < get(itime - 1).getTime()) {
@@ -79,6 +150,10 @@ bool StatesTrajectory::isConsistent() const {
     // An empty or size-1 trajectory is necessarily consistent.
     if (getSize() <= 1) return true;
 
+    // With compact storage, all states are materialized from the same
+    // template.
+    if (m_storageMode == StorageMode::Compact) return true;
+
     const auto& state0 = operator[](0);
 
     for (unsigned itime = 1; itime < getSize(); ++itime) {
@@ -99,7 +174,8 @@ bool StatesTrajectory::isCompatibleWith(const Model& model) const {
 
     // Since we now know all the states are consistent with each other, we only
     // need to check if the first one is compatible with the model.
-    const auto& state0 = get(0);
+    const auto& state0 =
+            m_storageMode == StorageMode::Full ? get(0) : *m_template;
 
     // We only check the number of speeds because OpenSim does not count
     // quaternion slots, while the SimTK State contains quaternion slots even if
@@ -136,12 +212,16 @@ TimeSeriesTable StatesTrajectory::exportToTable(const Model& model,
     std::vector<std::string> stateVars = requestedStateVars.empty() ?
             ::createVector(model.getStateVariableNames()) :
             requestedStateVars;
+    if (m_storageMode == StorageMode::Compact && getSize() > 0 &&
+            exportCompactToTable(model, stateVars, table)) {
+        return table;
+    }
     table.setColumnLabels(stateVars);
     size_t numDepColumns = stateVars.size();
 
-    // Fill up the table with the data.
-    for (size_t itime = 0; itime < getSize(); ++itime) {
-        const auto& state = get(itime);
+    // Fill up the table with the data. The iterator materializes a single
+    // state at a time with compact storage.
+    for (const auto& state : *this) {
         TimeSeriesTable::RowVector row(static_cast<int>(numDepColumns));
 
         // Get each state variable's value.
@@ -161,6 +241,67 @@ TimeSeriesTable StatesTrajectory::exportToTable(const Model& model,
     return table;
 }
 
+bool StatesTrajectory::exportCompactToTable(const Model& model,
+        const std::vector<std::string>& stateVars,
+        TimeSeriesTable& table) const {
+    const SimTK::State& s = *m_template;
+    if (s.getSystemStage() < SimTK::Stage::Model) return false;
+
+    // Find the element of Y (Q, U or Z) that holds each state variable.
+    const SimTK::SimbodyMatterSubsystem& matter = model.getMatterSubsystem();
+    const SimTK::SubsystemIndex matterIndex = matter.getMySubsystemIndex();
+    const int numColumns = static_cast<int>(stateVars.size());
+    std::vector<int> yIndices(numColumns);
+    for (int icol = 0; icol < numColumns; ++icol) {
+        const auto* sv = model.traverseToStateVariable(stateVars[icol]);
+        if (!sv) return false;
+        int yIndex = -1;
+        if (const auto* coord =
+                dynamic_cast<const Coordinate*>(&sv->getOwner())) {
+            // The value and speed of a coordinate are a Q and a U of its
+            // mobilized body.
+            const SimTK::MobilizedBody& mobod =
+                    matter.getMobilizedBody(coord->getBodyIndex());
+            if (sv->getName() == "value") {
+                yIndex = s.getQStart() + s.getQStart(matterIndex) +
+                         mobod.getFirstQIndex(s) +
+                         coord->getMobilizerQIndex();
+            } else if (sv->getName() == "speed") {
+                yIndex = s.getUStart() + s.getUStart(matterIndex) +
+                         mobod.getFirstUIndex(s) +
+                         coord->getMobilizerQIndex();
+            }
+        } else if (sv->getSubsysIndex().isValid() && sv->getVarIndex() >= 0) {
+            // Other state variables are Zs of their subsystem.
+            yIndex = s.getZStart() + s.getZStart(sv->getSubsysIndex()) +
+                     sv->getVarIndex();
+        }
+        // A state variable that is stored in another way (e.g., by a
+        // StateVariable of a user's Component) is read from materialized
+        // states instead.
+        if (yIndex < 0 || yIndex >= s.getNY()) return false;
+        const double value = sv->getValue(s);
+        const double y = s.getY()[yIndex];
+        if (!(value == y || (SimTK::isNaN(value) && SimTK::isNaN(y)))) {
+            return false;
+        }
+        yIndices[icol] = yIndex;
+    }
+
+    const int numRows = static_cast<int>(getSize());
+    std::vector<double> times(numRows);
+    SimTK::Matrix data(numRows, numColumns);
+    for (int irow = 0; irow < numRows; ++irow) {
+        const double* values = &m_buffer[irow * m_frameSize];
+        times[irow] = values[0];
+        for (int icol = 0; icol < numColumns; ++icol) {
+            data(irow, icol) = values[1 + yIndices[icol]];
+        }
+    }
+    table = TimeSeriesTable(times, data, stateVars);
+    return true;
+}
+
 StatesTrajectory StatesTrajectory::createFromStatesStorage(
         const Model& model,
         const Storage& sto,
@@ -23,22 +23,143 @@
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
 
+#include <iterator>
+#include <memory>
 #include <vector>
 
 #include <OpenSim/Common/Exception.h>
 #include <OpenSim/Common/TimeSeriesTable.h>
 #include <SimTKcommon/internal/IteratorRange.h>
+#include <SimTKcommon/internal/ResetOnCopy.h>
+#include <SimTKcommon/internal/State.h>
 
 #include "osimSimulationDLL.h"
 
 namespace SimTK {
 class State;
+class System;
 }
 
 namespace OpenSim {
 
 class Storage;
 class Model;
+class StatesTrajectory;
+
+/** Random-access iterator through the SimTK::State%s of a StatesTrajectory;
+ * does not allow modifying the states. For a trajectory with compact storage,
+ * the iterator materializes the state it points to, into a state of its own,
+ * when it is dereferenced (with operator*(), operator->() or operator[]());
+ * the reference it returns is valid only until the iterator is dereferenced
+ * at another position, or destroyed. Most users do not need to understand
+ * what this is. */
+class OSIMSIMULATION_API StatesTrajectoryIterator {
+public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef SimTK::State value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const SimTK::State* pointer;
+    typedef const SimTK::State& reference;
+
+    StatesTrajectoryIterator() = default;
+    StatesTrajectoryIterator(const StatesTrajectory* trajectory,
+                             size_t index) :
+            m_trajectory(trajectory), m_index(index) {}
+
+    /** Get the state this iterator points to. */
+    const SimTK::State& operator*() const { return operator[](0); }
+    const SimTK::State* operator->() const { return &operator*(); }
+    /** A method rather than an operator to dereference the iterator (for
+     * scripting). */
+    const SimTK::State& deref() const { return operator*(); }
+
+    /** Prefix increment operator to get the next state. */
+    StatesTrajectoryIterator& operator++() {
+        ++m_index;
+        return *this;
+    }
+    /** Postfix increment operator to get the next state. */
+    StatesTrajectoryIterator operator++(int) {
+        StatesTrajectoryIterator current = *this;
+        next();
+        return current;
+    }
+    /** Method equivalent to pre-increment operator for operator-deficient
+     * languages. */
+    StatesTrajectoryIterator& next() { return ++(*this); }
+    /** Prefix decrement operator to get the previous state. */
+    StatesTrajectoryIterator& operator--() {
+        --m_index;
+        return *this;
+    }
+    /** Postfix decrement operator to get the previous state. */
+    StatesTrajectoryIterator operator--(int) {
+        StatesTrajectoryIterator current = *this;
+        --(*this);
+        return current;
+    }
+
+    /** Move the iterator by `n` states (backwards if `n` is negative). */
+    StatesTrajectoryIterator& operator+=(difference_type n) {
+        m_index = static_cast<size_t>(
+                static_cast<difference_type>(m_index) + n);
+        return *this;
+    }
+    StatesTrajectoryIterator& operator-=(difference_type n) {
+        return operator+=(-n);
+    }
+    StatesTrajectoryIterator operator+(difference_type n) const {
+        return StatesTrajectoryIterator(m_trajectory, m_index) += n;
+    }
+    friend StatesTrajectoryIterator operator+(difference_type n,
+            const StatesTrajectoryIterator& it) {
+        return it + n;
+    }
+    StatesTrajectoryIterator operator-(difference_type n) const {
+        return StatesTrajectoryIterator(m_trajectory, m_index) -= n;
+    }
+    /** The number of states from `other` to this iterator. */
+    difference_type operator-(const StatesTrajectoryIterator& other) const {
+        return static_cast<difference_type>(m_index) -
+               static_cast<difference_type>(other.m_index);
+    }
+    /** Get the state `n` states after the one this iterator points to. With
+     * compact storage, this materializes into the same state as
+     * operator*(). */
+    const SimTK::State& operator[](difference_type n) const;
+
+    bool operator==(const StatesTrajectoryIterator& other) const {
+        return m_trajectory == other.m_trajectory && m_index == other.m_index;
+    }
+    bool operator!=(const StatesTrajectoryIterator& other) const {
+        return !operator==(other);
+    }
+    bool operator<(const StatesTrajectoryIterator& other) const {
+        return m_index < other.m_index;
+    }
+    bool operator>(const StatesTrajectoryIterator& other) const {
+        return other < *this;
+    }
+    bool operator<=(const StatesTrajectoryIterator& other) const {
+        return !(other < *this);
+    }
+    bool operator>=(const StatesTrajectoryIterator& other) const {
+        return !(*this < other);
+    }
+    /** Check for equality using a normal method rather than an operator. */
+    bool equals(const StatesTrajectoryIterator& other) const {
+        return operator==(other);
+    }
+
+private:
+    const StatesTrajectory* m_trajectory = nullptr;
+    size_t m_index = 0;
+    // The state into which this iterator materializes (compact storage
+    // only), and the index of the state it holds. It is reused as the
+    // iterator moves, and copies of the iterator get their own.
+    mutable SimTK::ResetOnCopy<std::unique_ptr<SimTK::State>> m_state;
+    mutable size_t m_stateIndex = 0;
+};
 
 // Design note: This class is part of OpenSim instead of Simbody since Simbody
 // users are likely to be interested in a more general State container that
@@ -136,11 +257,73 @@ class Model;
  *               << std::endl;
  * }
  * @endcode
+ *
+ * ### Compact storage
+ * By default, the trajectory stores a full copy of every SimTK::State,
+ * including its cache. For long simulations of large models, this can take a
+ * lot of memory. A trajectory created with StorageMode::Compact instead keeps
+ * the time and the continuous state variables (Q, U and Z) of every state in
+ * a single contiguous buffer, and shares a single copy of the first appended
+ * state (the template) for everything else. A SimTK::State is materialized
+ * from the buffer only when you ask for it, through get(), operator[] or an
+ * iterator. An iterator reuses a single state as it moves, while get() and
+ * operator[] keep each state they materialize (see operator[]()), so iterate
+ * to go through many states. If you provide the SimTK::System with
+ * setSystem(), materialized states are realized to the lowest stage to which
+ * the appended states were realized; otherwise, you must realize them
+ * yourself.
+ * @code{.cpp}
+ * StatesTrajectory states(StatesTrajectory::StorageMode::Compact);
+ * states.setSystem(&model.getSystem());
+ * @endcode
+ * exportToTable() reads the buffer directly, without materializing states.
+ *
+ * @note With compact storage, the discrete variables (and other non-continuous
+ * parts) of every materialized state are those of the template: the values of
+ * discrete variables that change during a simulation (e.g., actuator
+ * overrides) are not kept. Use full storage if you need them.
  */
 class OSIMSIMULATION_API StatesTrajectory {
 public:
+    /** How the states of a trajectory are stored; see the "Compact storage"
+     * section of the class description. */
+    enum class StorageMode {
+        Full,   ///< Store a full copy of each state (the default).
+        Compact ///< Store only time, Q, U and Z of each state.
+    };
+
     /** Create an empty trajectory of states. */
     StatesTrajectory() {}
+    /** Create an empty trajectory of states that uses the given storage. */
+    explicit StatesTrajectory(StorageMode storageMode) :
+            m_storageMode(storageMode) {}
+
+    /** How this trajectory stores its states. */
+    StorageMode getStorageMode() const { return m_storageMode; }
+
+    /** With compact storage, the stored values of all the states in one
+     * contiguous array: for each state, its time followed by its Y (Q, U and
+     * Z), for a total of getSize() * getNumCompactValuesPerState() values.
+     * This allows creating views of the data (e.g., NumPy arrays) without
+     * copying it. The pointer is invalidated by append() and clear().
+     * Returns nullptr with full storage or if the trajectory is empty. */
+    const double* getCompactValues() const {
+        return m_buffer.empty() ? nullptr : m_buffer.data();
+    }
+    /** With compact storage, the number of values stored for each state
+     * (1 + NY); 0 with full storage or if the trajectory is empty. */
+    size_t getNumCompactValuesPerState() const { return m_frameSize; }
+
+    /** With compact storage, realize each materialized state with the given
+     * system, which must be the system for which the states were created and
+     * must outlive any use of this trajectory. Pass nullptr to stop realizing
+     * materialized states. The states already materialized by operator[] or
+     * get() are discarded, which invalidates references to them. This has no
+     * effect with full storage. */
+    void setSystem(const SimTK::System* system) {
+        m_system = system;
+        m_materializedStates.clear();
+    }
 
     /** The number of SimTK::State%s in the trajectory. */
     size_t getSize() const;
@@ -157,9 +340,17 @@ public:
      * model.getStateVariableValue(state, "knee/flexion/value");
      * @endcode
      * This function does not check if the index is larger than the size of
-     * the trajectory; see get() if you want this check. */
+     * the trajectory; see get() if you want this check.
+     *
+     * With compact storage, the state at each index is materialized the
+     * first time it is accessed with operator[], get(), front() or back(),
+     * and kept until the trajectory is cleared or setSystem() is called, so
+     * references to states at different indices can be held at once. This
+     * takes memory for every state accessed this way; to go through the
+     * states, use an iterator, which reuses a single state. */
     const SimTK::State& operator[](size_t index) const {
-        return m_states[index];
+        if (m_storageMode == StorageMode::Full) return m_states[index];
+        return getMaterializedState(index);
     }
     /** Get a const reference to the state at a given index in the trajectory.
 
@@ -167,26 +358,23 @@ public:
      *                         trajectory.
      */
     const SimTK::State& get(size_t index) const {
-        try {
-            return m_states.at(index);
-        } catch (const std::out_of_range&) {
-            OPENSIM_THROW(IndexOutOfRange, index, 0, 
-                          static_cast<unsigned>(m_states.size() - 1));
-        }
+        OPENSIM_THROW_IF(index >= getSize(), IndexOutOfRange, index, 0,
+                         static_cast<unsigned>(getSize() - 1));
+        return operator[](index);
     }
     /** Get a const reference to the first state in the trajectory. */
     const SimTK::State& front() const { 
-        return m_states.front();
+        return operator[](0);
     }
     /** Get a const reference to the last state in the trajectory. */
     const SimTK::State& back() const { 
-        return m_states.back();
+        return operator[](getSize() - 1);
     }
     /// @}
     
     /** Iterator type that does not allow modifying the trajectory.
      * Most users do not need to understand what this is. */
-    typedef std::vector<SimTK::State>::const_iterator const_iterator;
+    typedef StatesTrajectoryIterator const_iterator;
 
     /** A helper type to allow using range for loops over a subset of the
      * trajectory. */
@@ -197,10 +385,10 @@ public:
 
     /** Iterator pointing to first SimTK::State; does not allow modifying the
      * states. Allows using this class in a range for loop. */
-    const_iterator begin() const { return m_states.cbegin(); }
+    const_iterator begin() const { return const_iterator(this, 0); }
     /** Iterator pointing past the end of the trajectory. Allows using this
      * class in a range for loop. */
-    const_iterator end() const { return m_states.cend(); }
+    const_iterator end() const { return const_iterator(this, getSize()); }
     /// @}
 
     /// @name Modify the contents of the trajectory
@@ -212,7 +400,8 @@ public:
      * than or equal to the time in the last SimTK::State in the trajectory.
      *
      * The state that ends up in the trajectory is a deep copy of the one
-     * passed in.
+     * passed in (with compact storage, only its time, Q, U and Z are copied,
+     * except for the first state, which becomes the template).
      */
     void append(const SimTK::State& state);
     /// @}
@@ -283,14 +472,52 @@ public:
      *      isCompatibleWith().
      *
      * See DataAdapter for details on writing to files.
+     *
+     * With compact storage, the table is filled directly from the stored
+     * values, without materializing any states.
      */
     TimeSeriesTable exportToTable(const Model& model,
             const std::vector<std::string>& stateVars = {}) const;
 
 private:
-
+    friend class StatesTrajectoryIterator;
+
+    /** Get the state at the given index, materializing it the first time
+     * (compact storage only). */
+    const SimTK::State& getMaterializedState(size_t index) const;
+    /** Set the time and Y of `state` (created from the template if null) to
+     * the stored values at the given index, and realize it if we have a
+     * system, unless `stateIndex` shows it already holds that index (compact
+     * storage only). */
+    void materializeState(size_t index, std::unique_ptr<SimTK::State>& state,
+                          size_t& stateIndex) const;
+    /** Fill the table directly from the compact buffer, reading each state
+     * variable from its Q, U or Z. Returns false if a column is not stored
+     * as a single element of Y. */
+    bool exportCompactToTable(const Model& model,
+            const std::vector<std::string>& stateVars,
+            TimeSeriesTable& table) const;
+
+    StorageMode m_storageMode = StorageMode::Full;
+
+    // Full storage.
     std::vector<SimTK::State> m_states;
 
+    // Compact storage.
+    // The first appended state, from which the others are materialized.
+    std::shared_ptr<const SimTK::State> m_template;
+    // For each state: time, followed by Y (Q, U, Z).
+    std::vector<double> m_buffer;
+    // Number of values stored for each state: 1 + NY.
+    size_t m_frameSize = 0;
+    // The lowest stage to which the appended states were realized.
+    SimTK::Stage m_stage = SimTK::Stage::Empty;
+    const SimTK::System* m_system = nullptr;
+    // The states that get() and operator[] have materialized, by index (null
+    // for the others). Copies of the trajectory start without any.
+    mutable SimTK::ResetOnCopy<std::vector<std::unique_ptr<SimTK::State>>>
+            m_materializedStates;
+
 public:
 
     /** Thrown when trying to append a state that is not consistent with the
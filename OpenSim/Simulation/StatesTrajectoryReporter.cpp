@@ -25,6 +25,9 @@
 
 using namespace OpenSim;
 
+StatesTrajectoryReporter::StatesTrajectoryReporter() {
+    constructProperty_compact_storage(false);
+}
 
 void StatesTrajectoryReporter::clear() {
     m_states.clear();
@@ -43,5 +46,14 @@ void StatesTrajectoryReporter::extendRealizeInstance(const SimTK::State& state)
 */
 
 void StatesTrajectoryReporter::implementReport(const SimTK::State& state) const {
+    if (m_states.getSize() == 0) {
+        const auto storageMode = get_compact_storage() ?
+                StatesTrajectory::StorageMode::Compact :
+                StatesTrajectory::StorageMode::Full;
+        if (m_states.getStorageMode() != storageMode) {
+            m_states = StatesTrajectory(storageMode);
+        }
+        m_states.setSystem(&getSystem());
+    }
     m_states.append(state);
 }
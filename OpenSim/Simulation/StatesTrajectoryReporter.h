@@ -41,6 +41,13 @@ class OSIMSIMULATION_API StatesTrajectoryReporter : public AbstractReporter {
 OpenSim_DECLARE_CONCRETE_OBJECT(StatesTrajectoryReporter, AbstractReporter);
 
 public:
+    OpenSim_DECLARE_PROPERTY(compact_storage, bool,
+        "Store only the time, Q, U and Z of each state, and materialize a "
+        "state only when it is accessed (default: false). See "
+        "StatesTrajectory::StorageMode.");
+
+    StatesTrajectoryReporter();
+
     /** Access the accumulated states. */
     const StatesTrajectory& getStates() const; 
     /** Clear the accumulated states. */ 
@@ -52,7 +59,10 @@ protected:
     // TODO we have to discuss if the trajectory should be cleared.
     //  void extendRealizeInstance(const SimTK::State& state) const override;
 
-    /** Appends the provided state to the trajectory. */
+    /** Appends the provided state to the trajectory. With compact storage,
+     * the states materialized from the trajectory are realized with this
+     * reporter's system, so the model must outlive any use of the
+     * trajectory. */
     void implementReport(const SimTK::State& state) const override;
 
 private:
@@ -0,0 +1,299 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  testEnsembleRunner.cpp                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+/*=============================================================================
+
+EnsembleRunner Tests:
+1. testConcurrentRunsMatchSerialRuns: Runs integrated concurrently, each on a
+   copy of the model with its own analyses and reporters, give exactly the
+   same results as when they are integrated one after the other.
+2. testRunsFromTable: A table of property and state values becomes one run
+   per row.
+3. testFailedRun: A run that throws does not stop the other runs.
+4. testConcurrentClones: Copies of a model made concurrently are the same as
+   a copy made alone, and are independent of the original.
+
+//=============================================================================*/
+#include <OpenSim/Simulation/Manager/EnsembleRunner.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/Muscle.h>
+#include <OpenSim/Analyses/Kinematics.h>
+#include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+#include <OpenSim/Common/LoadOpenSimLibrary.h>
+
+#include <fstream>
+#include <thread>
+
+using namespace OpenSim;
+using namespace std;
+
+void testConcurrentRunsMatchSerialRuns();
+void testRunsFromTable();
+void testFailedRun();
+void testConcurrentClones();
+
+int main()
+{
+    LoadOpenSimLibrary("osimActuators");
+    SimTK::Array_<std::string> failures;
+
+    try { testConcurrentRunsMatchSerialRuns(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testConcurrentRunsMatchSerialRuns");
+    }
+
+    try { testRunsFromTable(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testRunsFromTable");
+    }
+
+    try { testFailedRun(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testFailedRun");
+    }
+
+    try { testConcurrentClones(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testConcurrentClones");
+    }
+
+    if (!failures.empty()) {
+        cout << "Done, with failure(s): " << failures << endl;
+        return 1;
+    }
+
+    cout << "Done. All cases passed." << endl;
+
+    return 0;
+}
+
+namespace {
+const std::string elbowPath = "/jointset/r_elbow/r_elbow_flex/value";
+
+void setUpRunner(EnsembleRunner& runner, int numRuns) {
+    runner.setFinalTime(0.1);
+    runner.setReportingInterval(0.01);
+    runner.addOutput("/forceset/BIClong|fiber_length");
+    runner.addOutput("/forceset/TRIlong|tendon_force");
+    for (int i = 0; i < numRuns; ++i) {
+        EnsembleRunner::Run run;
+        run.name = "ensemble_run_" + std::to_string(i);
+        run.propertyValues.push_back(
+                {"/forceset/BIClong", "max_isometric_force", 400.0 + 100 * i});
+        run.stateValues.push_back({elbowPath, 0.2 + 0.1 * i});
+        runner.addRun(run);
+    }
+}
+
+bool equal(const SimTK::Matrix& a, const SimTK::Matrix& b) {
+    if (a.nrow() != b.nrow() || a.ncol() != b.ncol()) return false;
+    for (int i = 0; i < a.nrow(); ++i)
+        for (int j = 0; j < a.ncol(); ++j)
+            if (a(i, j) != b(i, j)) return false;
+    return true;
+}
+
+void compareTables(const TimeSeriesTable& expected,
+                   const TimeSeriesTable& found, const std::string& name) {
+    ASSERT(expected.getNumRows() > 0, __FILE__, __LINE__,
+            name + ": no rows were recorded.");
+    ASSERT(expected.getColumnLabels() == found.getColumnLabels(), __FILE__,
+            __LINE__, name + ": column labels differ.");
+    ASSERT(expected.getIndependentColumn() == found.getIndependentColumn(),
+            __FILE__, __LINE__, name + ": times differ.");
+    // The same computations are done on every thread.
+    ASSERT(equal(expected.getMatrix(), found.getMatrix()), __FILE__, __LINE__,
+            name + ": values differ.");
+}
+}
+
+void testConcurrentRunsMatchSerialRuns()
+{
+    Model model("arm26.osim");
+    // The analyses of the model are copied into each run.
+    model.addAnalysis(new Kinematics(&model));
+    const int numRuns = 6;
+
+    EnsembleRunner serialRunner(model);
+    setUpRunner(serialRunner, numRuns);
+    serialRunner.setNumThreads(1);
+    const auto serialResults = serialRunner.run();
+
+    EnsembleRunner concurrentRunner(model);
+    setUpRunner(concurrentRunner, numRuns);
+    concurrentRunner.setNumThreads(4);
+    concurrentRunner.setResultsDirectory(".");
+    const auto results = concurrentRunner.run();
+
+    ASSERT_EQUAL(numRuns, int(results.size()), __FILE__, __LINE__,
+            "Expected one result per run.");
+    for (int i = 0; i < numRuns; ++i) {
+        const auto& result = results[i];
+        ASSERT(result.success, __FILE__, __LINE__,
+                result.name + " failed: " + result.errorMessage);
+        ASSERT(result.name == serialResults[i].name, __FILE__, __LINE__,
+                "Results are not in the order of the runs.");
+        compareTables(serialResults[i].statesTable, result.statesTable,
+                result.name + " states");
+        compareTables(serialResults[i].outputsTable, result.outputsTable,
+                result.name + " outputs");
+        ASSERT(result.states.getSize() == result.statesTable.getNumRows(),
+                __FILE__, __LINE__, "StatesTrajectory and table differ.");
+
+        // The initial state of each run was changed.
+        ASSERT_EQUAL(0.2 + 0.1 * i,
+                result.statesTable.getDependentColumn(elbowPath)[0], 1e-15,
+                __FILE__, __LINE__, "Initial elbow angle was not set.");
+        // The property of each run was changed, so the runs differ.
+        if (i > 0) {
+            ASSERT(!equal(results[i - 1].statesTable.getMatrix(),
+                          result.statesTable.getMatrix()), __FILE__, __LINE__,
+                   "Runs with different parameters have the same results.");
+        }
+
+        // Each run wrote its own files, including those of the analyses.
+        for (const auto& suffix : {"_states.sto", "_outputs.sto",
+                                   "_Kinematics_q.sto"}) {
+            const std::string fileName = result.name + suffix;
+            ASSERT(std::ifstream(fileName).good(), __FILE__, __LINE__,
+                    "Expected file '" + fileName + "' to be written.");
+        }
+        Storage kinematics(result.name + "_Kinematics_q.sto");
+        ASSERT_EQUAL(0.1, kinematics.getLastTime(), 1e-12, __FILE__, __LINE__,
+                "Kinematics of " + result.name + " did not reach the final "
+                "time.");
+    }
+}
+
+void testRunsFromTable()
+{
+    Model model("arm26.osim");
+    EnsembleRunner runner(model);
+    runner.setFinalTime(0.02);
+
+    TimeSeriesTable table;
+    table.setColumnLabels({"/forceset/BIClong|max_isometric_force", elbowPath});
+    table.appendRow(0, SimTK::RowVector(SimTK::Vec2(500, 0.5)));
+    table.appendRow(1, SimTK::RowVector(SimTK::Vec2(600, 0.7)));
+    runner.addRunsFromTable(table);
+    ASSERT_EQUAL(2, runner.getNumRuns(), __FILE__, __LINE__,
+            "Expected a run per row.");
+
+    const auto results = runner.run();
+    for (int i = 0; i < 2; ++i) {
+        ASSERT(results[i].success, __FILE__, __LINE__, results[i].errorMessage);
+        ASSERT(results[i].name == "run_" + std::to_string(i), __FILE__,
+                __LINE__, "Unexpected name " + results[i].name + ".");
+        ASSERT_EQUAL(table.getDependentColumn(elbowPath)[i],
+                results[i].statesTable.getDependentColumn(elbowPath)[0],
+                1e-15, __FILE__, __LINE__, "Initial elbow angle was not set.");
+    }
+
+    // Runs must have unique names.
+    EnsembleRunner::Run run;
+    run.name = "run_0";
+    ASSERT_THROW(Exception, runner.addRun(run));
+}
+
+void testFailedRun()
+{
+    Model model("arm26.osim");
+    EnsembleRunner runner(model);
+    runner.setFinalTime(0.02);
+    runner.setNumThreads(2);
+
+    EnsembleRunner::Run good;
+    good.name = "good";
+    runner.addRun(good);
+    EnsembleRunner::Run bad;
+    bad.name = "bad";
+    bad.propertyValues.push_back({"/forceset/BIClong", "not_a_property", 1});
+    runner.addRun(bad);
+    EnsembleRunner::Run badEdit;
+    badEdit.name = "bad_edit";
+    badEdit.editState = [](const Model&, SimTK::State&) {
+        throw Exception("Cannot set this state.");
+    };
+    runner.addRun(badEdit);
+
+    const auto results = runner.run();
+    ASSERT(results[0].success, __FILE__, __LINE__, results[0].errorMessage);
+    ASSERT(!results[1].success && !results[1].errorMessage.empty(), __FILE__,
+            __LINE__, "Expected the run with a bad property to fail.");
+    ASSERT(!results[2].success, __FILE__, __LINE__,
+            "Expected the run that throws to fail.");
+    ASSERT(results[2].errorMessage.find("Cannot set this state.") !=
+           std::string::npos, __FILE__, __LINE__,
+           "Expected the message of the exception.");
+}
+
+void testConcurrentClones()
+{
+    Model model("arm26.osim");
+    const std::string musclePath = "/forceset/BIClong";
+
+    auto calcLength = [&](Model& copy) -> double {
+        SimTK::State& s = copy.initSystem();
+        copy.getCoordinateSet().get("r_elbow_flex").setValue(s, 1.0);
+        return copy.getComponent<Muscle>(musclePath).getLength(s);
+    };
+    std::unique_ptr<Model> serialCopy(model.clone());
+    const double expected = calcLength(*serialCopy);
+
+    const int numThreads = 8;
+    std::vector<double> lengths(numThreads, SimTK::NaN);
+    std::vector<std::exception_ptr> exceptions(numThreads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; ++i) {
+        threads.emplace_back([&, i]() {
+            try {
+                std::unique_ptr<Model> copy(model.clone());
+                // Modifying a copy must not affect the others.
+                copy->updComponent<Muscle>(musclePath)
+                        .setMaxIsometricForce(100.0 * (i + 1));
+                lengths[i] = calcLength(*copy);
+                ASSERT_EQUAL(100.0 * (i + 1),
+                        copy->getComponent<Muscle>(musclePath)
+                                .getMaxIsometricForce(),
+                        0.0, __FILE__, __LINE__,
+                        "A copy did not keep its own property value.");
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    for (const auto& e : exceptions) if (e) std::rethrow_exception(e);
+
+    for (int i = 0; i < numThreads; ++i)
+        ASSERT_EQUAL(expected, lengths[i], 0.0, __FILE__, __LINE__,
+                "A concurrent copy computed a different muscle length.");
+    ASSERT_EQUAL(
+            serialCopy->getComponent<Muscle>(musclePath).getMaxIsometricForce(),
+            model.getComponent<Muscle>(musclePath).getMaxIsometricForce(),
+            0.0, __FILE__, __LINE__,
+            "Modifying the copies modified the original model.");
+}
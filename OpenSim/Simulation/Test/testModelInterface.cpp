@@ -32,6 +32,7 @@ using namespace std;
 
 void testModelFinalizePropertiesAndConnections();
 void testModelTopologyErrors();
+void testPathLookupAfterDeletingPathPoint();
 
 int main() {
     LoadOpenSimLibrary("osimActuators");
@@ -39,6 +40,7 @@ int main() {
     SimTK_START_TEST("testModelInterface");
         SimTK_SUBTEST(testModelFinalizePropertiesAndConnections);
         SimTK_SUBTEST(testModelTopologyErrors);
+        SimTK_SUBTEST(testPathLookupAfterDeletingPathPoint);
     SimTK_END_TEST();
 }
 
@@ -227,3 +229,38 @@ void testModelTopologyErrors()
 
     ASSERT_THROW(JointFramesHaveSameBaseFrame, degenerate.initSystem());
 }
+
+void testPathLookupAfterDeletingPathPoint()
+{
+    Model model("arm26.osim");
+    SimTK::State& s = model.initSystem();
+
+    // Edit a path through a reference to it, which leaves the model marked as
+    // up to date with its properties.
+    auto& muscle = const_cast<Muscle&>(
+            model.getComponent<Muscle>("forceset/TRIlong"));
+    GeometryPath& path = muscle.updGeometryPath();
+    const int last = path.getPathPointSet().getSize() - 1;
+    const std::string pointName = path.getPathPointSet()[last].getName();
+    const std::string pointPath =
+            path.getPathPointSet()[last].getAbsolutePathString();
+    ASSERT(model.hasComponent(pointPath));
+    ASSERT(model.findComponent(pointName) != nullptr);
+
+    ASSERT(path.deletePathPoint(s, last));
+    ASSERT(model.isObjectUpToDateWithProperties());
+
+    // The deleted point must not be found, and the remaining ones must be.
+    ASSERT(!model.hasComponent(pointPath));
+    ASSERT(model.findComponent(pointName) == nullptr);
+    ASSERT_THROW(ComponentNotFoundOnSpecifiedPath,
+            model.getComponent(pointPath));
+    const auto& first = path.getPathPointSet()[0];
+    ASSERT(&model.getComponent(first.getAbsolutePathString()) == &first);
+    ASSERT(model.findComponent(first.getName()) == &first);
+
+    // The model is indexed again when it is initialized.
+    model.initSystem();
+    ASSERT(!model.hasComponent(pointPath));
+    ASSERT(&model.getComponent(first.getAbsolutePathString()) == &first);
+}
@@ -55,6 +55,8 @@ void testMomentArmDefinitionForModel(const string &filename,
                                      double mass = -1.0, string errorMessage = "");
 
 void testMomentArmsAcrossCompoundJoint();
+void testMomentArmMatrix(const string &filename);
+void testPolynomialPath();
 
 int main()
 {
@@ -67,6 +69,13 @@ int main()
         testMomentArmsAcrossCompoundJoint();
         cout << "Joint composed of more than one mobilized body: PASSED\n" << endl;
 
+        testMomentArmMatrix("testMomentArmsConstraintB.osim");
+        testMomentArmMatrix("gait2354_simbody.osim");
+        cout << "Moment-arm matrix of all muscles and coordinates: PASSED\n" << endl;
+
+        testPolynomialPath();
+        cout << "Polynomial fit of a muscle path: PASSED\n" << endl;
+
         testMomentArmDefinitionForModel("BothLegs22.osim", "r_knee_angle", "VASINT", 
             SimTK::Vec2(-2*SimTK::Pi/3, SimTK::Pi/18), 0.0, 
             "VASINT of BothLegs with no mass: FAILED");
@@ -166,6 +175,128 @@ void testMomentArmsAcrossCompoundJoint()
         0.0, "testMomentArmsAcrossCompoundJoint: FAILED");
 }
 
+// The batched moment-arm matrix must match the moment-arms computed one muscle
+// and one coordinate at a time, and must be recomputed when the pose changes.
+void testMomentArmMatrix(const string &filename)
+{
+    Model model(filename);
+    SimTK::State& s = model.initSystem();
+
+    CoordinateSet& coords = model.updCoordinateSet();
+    const Set<Muscle>& muscles = model.getMuscles();
+
+    for (int pose = 0; pose < 2; ++pose) {
+        if (pose == 1) {
+            for (int j = 0; j < coords.getSize(); ++j) {
+                if (!coords[j].getLocked(s))
+                    coords[j].setValue(s, coords[j].getValue(s) + 0.1, false);
+            }
+            model.assemble(s);
+        }
+        model.realizePosition(s);
+
+        const SimTK::Matrix& momentArms = model.getMomentArmMatrix(s);
+        ASSERT(momentArms.nrow() == muscles.getSize(), __FILE__, __LINE__,
+            "testMomentArmMatrix: wrong number of rows.");
+        ASSERT(momentArms.ncol() == coords.getSize(), __FILE__, __LINE__,
+            "testMomentArmMatrix: wrong number of columns.");
+        for (int i = 0; i < muscles.getSize(); ++i) {
+            for (int j = 0; j < coords.getSize(); ++j) {
+                ASSERT_EQUAL(muscles[i].computeMomentArm(s, coords[j]),
+                    momentArms(i, j), 1e-8, __FILE__, __LINE__,
+                    "testMomentArmMatrix: moment-arm of " +
+                    muscles[i].getName() + " about " + coords[j].getName() +
+                    " does not match.");
+            }
+        }
+    }
+}
+
+// A PolynomialPath fitted to a muscle path must reproduce its length, and its
+// moment-arms and lengthening speed must be consistent with its length.
+void testPolynomialPath()
+{
+    Model model("arm26.osim");
+    model.initSystem();
+    Model reference(model);
+    SimTK::State& sRef = reference.initSystem();
+    Muscle& muscle = model.updMuscles().get("BIClong");
+
+    PolynomialPath polynomialPath(muscle.getGeometryPath());
+    polynomialPath.fit(model, muscle.getGeometryPath());
+    ASSERT(polynomialPath.getProperty_coordinates().size() == 2, __FILE__,
+        __LINE__, "testPolynomialPath: expected BIClong to depend on 2 "
+        "coordinates.");
+    ASSERT(polynomialPath.get_rms_length_error() < 1e-3, __FILE__, __LINE__,
+        "testPolynomialPath: length of the fit is not accurate.");
+    ASSERT(polynomialPath.get_rms_moment_arm_error() < 5e-3, __FILE__,
+        __LINE__, "testPolynomialPath: moment-arms of the fit are not "
+        "accurate.");
+
+    muscle.updProperty_GeometryPath().setValue(polynomialPath);
+    SimTK::State& s = model.initSystem();
+    const GeometryPath& path = muscle.getGeometryPath();
+    const GeometryPath& referencePath =
+        reference.getMuscles().get("BIClong").getGeometryPath();
+    ASSERT(dynamic_cast<const PolynomialPath*>(&path) != nullptr, __FILE__,
+        __LINE__, "testPolynomialPath: path was not replaced.");
+
+    const CoordinateSet& coords = model.getCoordinateSet();
+    SimTK::Random::Uniform random(0, 1);
+    random.setSeed(1);
+    const double lengthTolerance = 2 * polynomialPath.get_max_length_error();
+    for (int pose = 0; pose < 10; ++pose) {
+        for (int j = 0; j < coords.getSize(); ++j) {
+            const double value = coords[j].getRangeMin() + random.getValue() *
+                (coords[j].getRangeMax() - coords[j].getRangeMin());
+            coords[j].setValue(s, value, false);
+            coords[j].setSpeedValue(s, random.getValue() - 0.5);
+            reference.getCoordinateSet()[j].setValue(sRef, value, false);
+        }
+        model.realizeVelocity(s);
+        reference.realizePosition(sRef);
+
+        ASSERT_EQUAL(referencePath.getLength(sRef), path.getLength(s),
+            lengthTolerance, __FILE__, __LINE__,
+            "testPolynomialPath: length does not match the fitted path.");
+
+        double speed = 0;
+        for (int j = 0; j < coords.getSize(); ++j) {
+            const double momentArm = muscle.computeMomentArm(s, coords[j]);
+            speed -= momentArm * coords[j].getSpeedValue(s);
+
+            // The moment-arm is -dL/dq of the polynomial.
+            SimTK::State sPerturbed = s;
+            const double q = coords[j].getValue(s);
+            const double delta = 1e-6;
+            coords[j].setValue(sPerturbed, q + delta, false);
+            model.realizePosition(sPerturbed);
+            const double lengthPlus = path.getLength(sPerturbed);
+            coords[j].setValue(sPerturbed, q - delta, false);
+            model.realizePosition(sPerturbed);
+            const double lengthMinus = path.getLength(sPerturbed);
+            ASSERT_EQUAL(-(lengthPlus - lengthMinus) / (2 * delta), momentArm,
+                1e-6, __FILE__, __LINE__, "testPolynomialPath: moment-arm "
+                "about " + coords[j].getName() + " does not match dL/dq.");
+        }
+        ASSERT_EQUAL(speed, path.getLengtheningSpeed(s), 1e-10, __FILE__,
+            __LINE__, "testPolynomialPath: lengthening speed does not match "
+            "the moment-arms.");
+    }
+
+    // The fit is serialized with the model.
+    model.print("arm26_polynomial_path.osim");
+    Model reloaded("arm26_polynomial_path.osim");
+    SimTK::State& sReloaded = reloaded.initSystem();
+    for (int j = 0; j < coords.getSize(); ++j)
+        reloaded.getCoordinateSet()[j].setValue(sReloaded,
+            coords[j].getValue(s), false);
+    reloaded.realizePosition(sReloaded);
+    ASSERT_EQUAL(path.getLength(s), reloaded.getMuscles().get("BIClong")
+        .getGeometryPath().getLength(sReloaded), 1e-12, __FILE__, __LINE__,
+        "testPolynomialPath: length changed after printing the model.");
+}
+
 //==========================================================================================================
 // moment_arm = dl/dtheta, definition using inexact perturbation technique
 //==========================================================================================================
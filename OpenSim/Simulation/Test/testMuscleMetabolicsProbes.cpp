@@ -649,6 +649,36 @@ Storage simulateModel(Model& model, double t0, double t1)
     return manager.getStateStorage();
 }
 
+// Check that the muscle_metabolic_rate output of a probe that reports all of
+// its components has a channel for each muscle, whose value is the probe input
+// for that muscle, and that the muscle and basal rates add up to the total.
+template <typename T>
+void checkMuscleMetabolicRateOutput(const T& probe, const SimTK::State& s,
+                                    const std::vector<std::string>& muscles)
+{
+    const Vector inputs = probe.computeProbeInputs(s);
+    const Vector& rates = probe.getMuscleMetabolicRates(s);
+    const auto& output = probe.getOutput("muscle_metabolic_rate");
+    ASSERT(rates.size() == int(muscles.size()), __FILE__, __LINE__,
+        probe.getName() + ": incorrect number of muscle metabolic rates.");
+
+    double total = inputs[1];
+    for (int i=0; i<int(muscles.size()); ++i) {
+        const std::string& name = muscles[i];
+        const double value = dynamic_cast<const Output<double>::Channel&>(
+            output.getChannel(name)).getValue(s);
+        ASSERT(value == rates[i], __FILE__, __LINE__,
+            probe.getName() + ": output channel '" + name
+            + "' does not match the muscle metabolic rate.");
+        ASSERT(value == inputs[i+2], __FILE__, __LINE__,
+            probe.getName() + ": output channel '" + name
+            + "' does not match the probe input.");
+        total += value;
+    }
+    ASSERT_EQUAL(inputs[0], total, 1e-10*std::abs(inputs[0]), __FILE__,
+        __LINE__, probe.getName() + ": muscle rates do not add up to total.");
+}
+
 void testProbesUsingMillardMuscleSimulation()
 {
     //--------------------------------------------------------------------------
@@ -1287,6 +1317,92 @@ void testProbesUsingMillardMuscleSimulation()
                  1.0e-2, __FILE__, __LINE__,
         "Bhargava2004: error in reporting data for multiple muscles.");
 
+    //--------------------------------------------------------------------------
+    // Check the per-muscle metabolic rates at the initial state.
+    //--------------------------------------------------------------------------
+    cout << "- checking muscle_metabolic_rate outputs" << endl;
+    const SimTK::State& s = model.getWorkingState();
+    model.getMultibodySystem().realize(s, SimTK::Stage::Dynamics);
+    checkMuscleMetabolicRateOutput(*umbergerTotalAllPieces_both, s,
+                                   {muscle1->getName(), muscle2->getName()});
+    checkMuscleMetabolicRateOutput(*bhargavaTotalAllPieces_both, s,
+                                   {muscle1->getName(), muscle2->getName()});
+    ASSERT(umbergerTotal_m1->getMuscleMetabolicRate(s, muscle1->getName())
+           == umbergerTotalAllPieces_both->getMuscleMetabolicRate(s,
+                                                        muscle1->getName()),
+           __FILE__, __LINE__, "Umberger2010: muscle1 rate depends on the "
+           "other muscles of the probe.");
+    ASSERT(bhargavaTotal_m2->getMuscleMetabolicRate(s, muscle2->getName())
+           == bhargavaTotalAllPieces_both->getMuscleMetabolicRate(s,
+                                                        muscle2->getName()),
+           __FILE__, __LINE__, "Bhargava2004: muscle2 rate depends on the "
+           "other muscles of the probe.");
+
+    // Changing a muscle parameter must not leave the old rates in the cache.
+    const double umbergerRate1 =
+        umbergerTotalAllPieces_both->getMuscleMetabolicRate(s,
+                                                        muscle1->getName());
+    const double bhargavaRate1 =
+        bhargavaTotalAllPieces_both->getMuscleMetabolicRate(s,
+                                                        muscle1->getName());
+    const double umbergerRatio = umbergerTotalAllPieces_both->
+        getRatioSlowTwitchFibers(muscle1->getName());
+    const double bhargavaRatio = bhargavaTotalAllPieces_both->
+        getRatioSlowTwitchFibers(muscle1->getName());
+    umbergerTotalAllPieces_both->setRatioSlowTwitchFibers(muscle1->getName(),
+                                                          0.1);
+    bhargavaTotalAllPieces_both->setRatioSlowTwitchFibers(muscle1->getName(),
+                                                          0.1);
+    ASSERT(umbergerTotalAllPieces_both->getMuscleMetabolicRate(s,
+                                        muscle1->getName()) != umbergerRate1,
+           __FILE__, __LINE__, "Umberger2010: muscle1 rate was not updated "
+           "after its ratio of slow twitch fibers changed.");
+    ASSERT(bhargavaTotalAllPieces_both->getMuscleMetabolicRate(s,
+                                        muscle1->getName()) != bhargavaRate1,
+           __FILE__, __LINE__, "Bhargava2004: muscle1 rate was not updated "
+           "after its ratio of slow twitch fibers changed.");
+    umbergerTotalAllPieces_both->setRatioSlowTwitchFibers(muscle1->getName(),
+                                                          umbergerRatio);
+    bhargavaTotalAllPieces_both->setRatioSlowTwitchFibers(muscle1->getName(),
+                                                          bhargavaRatio);
+    ASSERT(umbergerTotalAllPieces_both->getMuscleMetabolicRate(s,
+                                        muscle1->getName()) == umbergerRate1,
+           __FILE__, __LINE__, "Umberger2010: muscle1 rate was not restored.");
+    ASSERT(bhargavaTotalAllPieces_both->getMuscleMetabolicRate(s,
+                                        muscle1->getName()) == bhargavaRate1,
+           __FILE__, __LINE__, "Bhargava2004: muscle1 rate was not restored.");
+
+    // The same goes for a parameter edited in place, without the setters of
+    // the probe or a call to initSystem().
+    umbergerTotalAllPieces_both->
+        upd_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet()
+        .get(muscle1->getName()).set_ratio_slow_twitch_fibers(0.1);
+    bhargavaTotalAllPieces_both->
+        upd_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet()
+        .get(muscle1->getName()).set_ratio_slow_twitch_fibers(0.1);
+    ASSERT(umbergerTotalAllPieces_both->getMuscleMetabolicRate(s,
+                                        muscle1->getName()) != umbergerRate1,
+           __FILE__, __LINE__, "Umberger2010: muscle1 rate was not updated "
+           "after its ratio of slow twitch fibers was edited in place.");
+    ASSERT(bhargavaTotalAllPieces_both->getMuscleMetabolicRate(s,
+                                        muscle1->getName()) != bhargavaRate1,
+           __FILE__, __LINE__, "Bhargava2004: muscle1 rate was not updated "
+           "after its ratio of slow twitch fibers was edited in place.");
+    umbergerTotalAllPieces_both->
+        upd_Umberger2010MuscleMetabolicsProbe_MetabolicMuscleParameterSet()
+        .get(muscle1->getName()).set_ratio_slow_twitch_fibers(umbergerRatio);
+    bhargavaTotalAllPieces_both->
+        upd_Bhargava2004MuscleMetabolicsProbe_MetabolicMuscleParameterSet()
+        .get(muscle1->getName()).set_ratio_slow_twitch_fibers(bhargavaRatio);
+    ASSERT(umbergerTotalAllPieces_both->getMuscleMetabolicRate(s,
+                                        muscle1->getName()) == umbergerRate1,
+           __FILE__, __LINE__, "Umberger2010: muscle1 rate was not restored "
+           "after an edit in place.");
+    ASSERT(bhargavaTotalAllPieces_both->getMuscleMetabolicRate(s,
+                                        muscle1->getName()) == bhargavaRate1,
+           __FILE__, __LINE__, "Bhargava2004: muscle1 rate was not restored "
+           "after an edit in place.");
+
     //--------------------------------------------------------------------------
     // Run simulation with lower activation and ensure less energy is liberated.
     //--------------------------------------------------------------------------
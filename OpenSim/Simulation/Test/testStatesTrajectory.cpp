@@ -24,6 +24,7 @@
 #include <OpenSim/Simulation/osimSimulation.h>
 #include <OpenSim/Common/Constant.h>
 #include <OpenSim/Common/LoadOpenSimLibrary.h>
+#include <iterator>
 #include <random>
 #include <cstdio>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
@@ -770,6 +771,125 @@ void testExport() {
             OpenSim::Exception);
 }
 
+void testCompactStorage() {
+    Model model("gait2354_simbody.osim");
+    model.updCoordinateSet().get("pelvis_ty").setDefaultLocked(true);
+
+    auto* statesCol = new StatesTrajectoryReporter();
+    statesCol->setName("states_collector_compact");
+    statesCol->set_compact_storage(true);
+    model.addComponent(statesCol);
+
+    auto& state = model.initSystem();
+    SimTK::RungeKuttaMersonIntegrator integrator(model.getSystem());
+    SimTK::TimeStepper ts(model.getSystem(), integrator);
+    ts.initialize(state);
+    ts.setReportAllSignificantStates(true);
+    integrator.setReturnEveryInternalStep(true);
+
+    // Both trajectories get the same states, realized to Report.
+    StatesTrajectory full;
+    while (ts.getState().getTime() < 0.05) {
+        ts.stepTo(0.05);
+        model.getMultibodySystem().realize(ts.getState(),
+                SimTK::Stage::Report);
+        full.append(ts.getState());
+    }
+
+    const StatesTrajectory& compact = statesCol->getStates();
+    SimTK_TEST(compact.getStorageMode() ==
+               StatesTrajectory::StorageMode::Compact);
+    SimTK_TEST_EQ((int)compact.getSize(), (int)full.getSize());
+    SimTK_TEST(compact.hasIntegrity());
+    SimTK_TEST(compact.isCompatibleWith(model));
+
+    // Materialized states have the same values as the original states, and
+    // are realized.
+    size_t i = 0;
+    for (const auto& materialized : compact) {
+        SimTK_TEST_EQ(materialized.getTime(), full[i].getTime());
+        SimTK_TEST_EQ(materialized.getY(), full[i].getY());
+        SimTK_TEST(materialized.getSystemStage() >= SimTK::Stage::Dynamics);
+        SimTK_TEST_EQ(model.calcMassCenterPosition(materialized),
+                      model.calcMassCenterPosition(full[i]));
+        ++i;
+    }
+    SimTK_TEST(i == full.getSize());
+    // States at different indices can be held at once.
+    const SimTK::State& state1 = compact.get(1);
+    const SimTK::State& state2 = compact[2];
+    SimTK_TEST(&state1 != &state2);
+    SimTK_TEST(&compact[1] == &state1);
+    SimTK_TEST_EQ(state1.getQ(), full[1].getQ());
+    SimTK_TEST_EQ(state2.getQ(), full[2].getQ());
+    SimTK_TEST_EQ(state1.getY(), full[1].getY());
+    // Iterators materialize into their own state.
+    auto it = compact.begin();
+    ++it;
+    SimTK_TEST(&*it != &compact[1]);
+    SimTK_TEST_EQ(it->getY(), compact[1].getY());
+
+    // The iterators are random access, with either storage.
+    SimTK_TEST(full.getSize() >= 4);
+    static_assert(std::is_same<
+            std::iterator_traits<StatesTrajectory::const_iterator>
+                    ::iterator_category,
+            std::random_access_iterator_tag>::value,
+            "StatesTrajectory::const_iterator must be random access.");
+    for (const StatesTrajectory* trajectory : {&full, &compact}) {
+        const auto begin = trajectory->begin();
+        const auto end = trajectory->end();
+        SimTK_TEST(end - begin == (std::ptrdiff_t)full.getSize());
+        SimTK_TEST(begin < end && end > begin && begin <= begin);
+        auto third = begin + 2;
+        SimTK_TEST_EQ(third->getY(), full[2].getY());
+        SimTK_TEST(third - 2 == begin && 2 + begin == third);
+        SimTK_TEST_EQ(begin[3].getTime(), full[3].getTime());
+        SimTK_TEST_EQ(third[-1].getY(), full[1].getY());
+        third -= 1;
+        SimTK_TEST_EQ(third->getY(), full[1].getY());
+        third += 2;
+        --third;
+        SimTK_TEST_EQ((*third).getY(), full[2].getY());
+        SimTK_TEST(std::distance(begin, third) == 2);
+        SimTK_TEST_EQ((end - 1)->getTime(), full.back().getTime());
+    }
+    SimTK_TEST_EQ(compact.front().getTime(), full.front().getTime());
+    SimTK_TEST_EQ(compact.back().getU(), full.back().getU());
+    SimTK_TEST_MUST_THROW_EXC(compact.get(compact.getSize()),
+                              IndexOutOfRange);
+
+    // The table is created from the stored values and matches the table of
+    // the full trajectory exactly.
+    tableAndTrajectoryMatch(model, compact.exportToTable(model), full);
+    const std::vector<std::string> columns{
+        model.getCoordinateSet().get("knee_angle_r").getStateVariableNames()[1],
+        model.getMuscles().get(0).getStateVariableNames()[0]};
+    tableAndTrajectoryMatch(model, compact.exportToTable(model, columns),
+                            full, columns);
+
+    // Copies have their own stored values and materialized state, and share
+    // only the template.
+    StatesTrajectory copy(compact);
+    SimTK_TEST_EQ(copy.back().getTime(), full.back().getTime());
+    SimTK_TEST(&copy.back() != &compact.back());
+
+    // Appending enforces the same rules as with full storage.
+    StatesTrajectory states(StatesTrajectory::StorageMode::Compact);
+    state.setTime(1.0);
+    states.append(state);
+    state.setTime(0.5);
+    SimTK_TEST_MUST_THROW_EXC(states.append(state),
+            SimTK::Exception::APIArgcheckFailed);
+    Model arm26("arm26.osim");
+    SimTK::State armState = arm26.initSystem();
+    armState.setTime(2.0);
+    SimTK_TEST_MUST_THROW_EXC(states.append(armState),
+            StatesTrajectory::InconsistentState);
+    states.clear();
+    SimTK_TEST(states.getSize() == 0);
+}
+
 int main() {
     SimTK_START_TEST("testStatesTrajectory");
         // actuators library is not loaded automatically (unless using clang).
@@ -803,5 +923,7 @@ int main() {
         // Export to data table.
         SimTK_SUBTEST(testExport);
 
+        SimTK_SUBTEST(testCompactStorage);
+
     SimTK_END_TEST();
 }
@@ -0,0 +1,228 @@
+#ifndef OPENSIM_BENCHMARK_H_
+#define OPENSIM_BENCHMARK_H_
+/* -------------------------------------------------------------------------- *
+ *                           OpenSim:  Benchmark.h                            *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Common/About.h>
+#include <OpenSim/Common/Exception.h>
+#include <OpenSim/Common/Logger.h>
+#include <OpenSim/Common/Stopwatch.h>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace OpenSim {
+
+/** A minimal harness for timing the core pipelines so that performance
+regressions can be tracked between releases. A benchmark program adds cases
+to a BenchmarkSuite and returns the result of run().
+
+Each case is run once to warm up (e.g., to load plugins and fill the file
+cache) and then a fixed number of times. Only the body of the case is timed;
+the optional setup function runs before every run (including the warm-up)
+and is not timed. The cases do not depend on random numbers or the wall
+clock, so the runs are reproducible.
+
+The results are printed as a table and written to a JSON file:
+@code
+{
+  "suite": "benchmarkSimulation",
+  "opensim_version": "4.1",
+  "build_type": "Release",
+  "repetitions": 5,
+  "benchmarks": [
+    {"name": "Model::initSystem/gait2392", "unit": "s",
+     "min": 0.41, "median": 0.42, "mean": 0.42, "max": 0.44,
+     "samples": [0.42, 0.41, 0.44, 0.42, 0.42]},
+    ...
+  ]
+}
+@endcode
+
+The following command line arguments are accepted:
+  - `--repetitions <n>`: number of timed runs of each case (default: 5).
+  - `--filter <text>`: run only the cases whose name contains text.
+  - `--output <file>`: JSON file to write (default: <suite>.json). */
+class BenchmarkSuite {
+public:
+    BenchmarkSuite(const std::string& name, int argc, char* argv[]) :
+            _name(name), _outputFileName(name + ".json") {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            OPENSIM_THROW_IF(i + 1 == argc, Exception,
+                    "Expected a value after '" + arg + "'.");
+            const std::string value = argv[++i];
+            if (arg == "--repetitions")
+                _repetitions = std::stoi(value);
+            else if (arg == "--filter")
+                _filter = value;
+            else if (arg == "--output")
+                _outputFileName = value;
+            else
+                OPENSIM_THROW(Exception, "Unrecognized argument '" + arg + "'.");
+        }
+        OPENSIM_THROW_IF(_repetitions < 1, Exception,
+                "Expected at least 1 repetition, but got " +
+                std::to_string(_repetitions) + ".");
+    }
+
+    /** Add a case. `body` is timed; `setup`, if provided, is called before
+    each call to `body` and is not timed. */
+    void add(const std::string& name, std::function<void()> body,
+             std::function<void()> setup = nullptr) {
+        _cases.push_back({name, std::move(body), std::move(setup)});
+    }
+
+    /** Run the cases, print the results and write them to the JSON file.
+    @returns 0 if all the cases ran without throwing an exception, and 1
+    otherwise (to be used as the exit code of the program). */
+    int run() {
+        // Keep the logs of the tools and models out of the timings.
+        const Logger::Level level = Logger::getLevel();
+        Logger::setLevel(Logger::Level::Warn);
+
+        std::vector<Result> results;
+        int status = 0;
+        for (const auto& c : _cases) {
+            if (c.name.find(_filter) == std::string::npos) continue;
+            std::cout << "Running " << c.name << "..." << std::endl;
+            try {
+                Result result;
+                result.name = c.name;
+                for (int i = 0; i <= _repetitions; ++i) {
+                    if (c.setup) c.setup();
+                    Stopwatch watch;
+                    c.body();
+                    const double elapsed =
+                            SimTK::nsToSec(watch.getElapsedTimeInNs());
+                    // The first run is the warm-up.
+                    if (i > 0) result.samples.push_back(elapsed);
+                }
+                results.push_back(result);
+            } catch (const std::exception& e) {
+                std::cerr << c.name << " failed: " << e.what() << std::endl;
+                status = 1;
+            }
+        }
+        Logger::setLevel(level);
+
+        printTable(results);
+        writeJSON(results);
+        return status;
+    }
+
+private:
+    struct Case {
+        std::string name;
+        std::function<void()> body;
+        std::function<void()> setup;
+    };
+    struct Result {
+        std::string name;
+        std::vector<double> samples;
+        double min() const {
+            return *std::min_element(samples.begin(), samples.end());
+        }
+        double max() const {
+            return *std::max_element(samples.begin(), samples.end());
+        }
+        double mean() const {
+            return std::accumulate(samples.begin(), samples.end(), 0.0) /
+                   samples.size();
+        }
+        double median() const {
+            std::vector<double> sorted(samples);
+            std::sort(sorted.begin(), sorted.end());
+            const size_t n = sorted.size();
+            return n % 2 ? sorted[n / 2]
+                         : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]);
+        }
+    };
+
+    static std::string quoted(const std::string& s) {
+        std::string result = "\"";
+        for (char c : s) {
+            if (c == '"' || c == '\\') result += '\\';
+            result += c;
+        }
+        return result + "\"";
+    }
+
+    void printTable(const std::vector<Result>& results) const {
+        std::cout << "\n" << std::left << std::setw(56) << "benchmark"
+                  << std::right << std::setw(12) << "median (s)"
+                  << std::setw(12) << "min (s)" << std::setw(12) << "max (s)"
+                  << "\n";
+        for (const auto& r : results) {
+            std::cout << std::left << std::setw(56) << r.name << std::right
+                      << std::setw(12) << r.median() << std::setw(12)
+                      << r.min() << std::setw(12) << r.max() << "\n";
+        }
+        std::cout << std::endl;
+    }
+
+    void writeJSON(const std::vector<Result>& results) const {
+        std::ofstream out(_outputFileName);
+        OPENSIM_THROW_IF(!out, Exception,
+                "Could not open '" + _outputFileName + "' for writing.");
+        out << std::setprecision(9);
+        out << "{\n";
+        out << "  \"suite\": " << quoted(_name) << ",\n";
+        out << "  \"opensim_version\": " << quoted(GetVersion()) << ",\n";
+#ifdef NDEBUG
+        out << "  \"build_type\": \"Release\",\n";
+#else
+        out << "  \"build_type\": \"Debug\",\n";
+#endif
+        out << "  \"repetitions\": " << _repetitions << ",\n";
+        out << "  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            out << (i ? ",\n" : "\n");
+            out << "    {\"name\": " << quoted(r.name) << ", \"unit\": \"s\", "
+                << "\"min\": " << r.min() << ", \"median\": " << r.median()
+                << ", \"mean\": " << r.mean() << ", \"max\": " << r.max()
+                << ",\n     \"samples\": [";
+            for (size_t j = 0; j < r.samples.size(); ++j)
+                out << (j ? ", " : "") << r.samples[j];
+            out << "]}";
+        }
+        out << "\n  ]\n}\n";
+        std::cout << "Wrote " << _outputFileName << "." << std::endl;
+    }
+
+    std::string _name;
+    std::string _outputFileName;
+    std::string _filter;
+    int _repetitions = 5;
+    std::vector<Case> _cases;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_BENCHMARK_H_
@@ -0,0 +1,101 @@
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  benchmarkFileAdapters.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+// Benchmarks of reading and writing the data files of the walking trials.
+// See Benchmark.h for the command line arguments.
+
+#include "Benchmark.h"
+
+#include <OpenSim/Common/Adapters.h>
+#include <OpenSim/Common/Storage.h>
+
+#include <memory>
+
+using namespace OpenSim;
+using namespace std;
+
+namespace {
+
+void addRead(BenchmarkSuite& suite, const string& name,
+        const string& fileName) {
+    suite.add("TimeSeriesTable::TimeSeriesTable/" + name, [fileName]() {
+        TimeSeriesTable table(fileName);
+    });
+    suite.add("Storage::Storage/" + name, [fileName]() {
+        Storage storage(fileName);
+    });
+}
+
+// Write the table in the given file to a file with each of the extensions.
+void addWrite(BenchmarkSuite& suite, const string& name,
+        const string& fileName, const vector<string>& extensions) {
+    auto table = make_shared<TimeSeriesTable>();
+    auto setup = [table, fileName]() {
+        if (table->getNumRows() == 0) *table = TimeSeriesTable(fileName);
+    };
+    for (const auto& extension : extensions) {
+        const string outputFile = name + "_benchmark." + extension;
+        suite.add("FileAdapter::writeFile/" + name + "." + extension,
+                [table, outputFile]() {
+                    DataAdapter::InputTables tables;
+                    tables.emplace("table", table.get());
+                    FileAdapter::writeFile(tables, outputFile);
+                },
+                setup);
+    }
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        BenchmarkSuite suite("benchmarkFileAdapters", argc, argv);
+
+        addRead(suite, "grf.mot", "Analyze/subject01_walk1_grf.mot");
+        addRead(suite, "ik.mot", "Analyze/subject01_walk1_ik.mot");
+        addRead(suite, "states.sto", "shared/std_subject01_walk1_states.sto");
+
+        suite.add("TRCFileAdapter::read/markers.trc", []() {
+            TRCFileAdapter{}.read("IK/subject01_synthetic_marker_data.trc");
+        });
+#if defined(WITH_EZC3D) || defined(WITH_BTK)
+        suite.add("C3DFileAdapter::read/walking2.c3d", []() {
+            C3DFileAdapter{}.read("shared/walking2.c3d");
+        });
+#endif
+
+        addWrite(suite, "grf", "Analyze/subject01_walk1_grf.mot",
+                {"sto", "csv", "bsto"});
+        suite.add("TimeSeriesTable::TimeSeriesTable/grf.bsto",
+                []() { TimeSeriesTable table("grf_benchmark.bsto"); },
+                []() {
+                    BinaryFileAdapter::write(TimeSeriesTable(
+                            "Analyze/subject01_walk1_grf.mot"),
+                            "grf_benchmark.bsto");
+                });
+
+        return suite.run();
+    } catch (const std::exception& e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+}
@@ -0,0 +1,190 @@
+/* -------------------------------------------------------------------------- *
+ *                     OpenSim:  benchmarkSimulation.cpp                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+// Benchmarks of building, simulating and evaluating the muscle paths of the
+// bundled models. See Benchmark.h for the command line arguments.
+
+#include "Benchmark.h"
+
+#include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/Muscle.h>
+
+#include <memory>
+
+using namespace OpenSim;
+using namespace std;
+
+namespace {
+
+/// A model, initialized by the setup of a case.
+struct ModelAndState {
+    unique_ptr<Model> model;
+    SimTK::State* state = nullptr;
+};
+
+void addLoadAndInitSystem(BenchmarkSuite& suite, const string& name,
+        const string& modelFile) {
+    suite.add("Model::Model/" + name, [modelFile]() {
+        Model model(modelFile);
+    });
+
+    auto model = make_shared<unique_ptr<Model>>();
+    suite.add("Model::initSystem/" + name,
+            [model]() { (*model)->initSystem(); },
+            [model, modelFile]() { model->reset(new Model(modelFile)); });
+}
+
+void addIntegrate(BenchmarkSuite& suite, const string& name,
+        const string& modelFile, double finalTime) {
+    auto data = make_shared<ModelAndState>();
+    suite.add("Manager::integrate/" + name,
+            [data, finalTime]() {
+                Manager manager(*data->model);
+                manager.initialize(*data->state);
+                manager.integrate(finalTime);
+            },
+            [data, modelFile]() {
+                data->model.reset(new Model(modelFile));
+                data->state = &data->model->initSystem();
+                data->model->equilibrateMuscles(*data->state);
+            });
+}
+
+// Sweep the given coordinates together through their ranges and evaluate the
+// length and moment arms of every muscle path at each pose.
+void addPathSweep(BenchmarkSuite& suite, const string& name,
+        const string& modelFile, const vector<string>& coordinateNames) {
+    const int numPoses = 20;
+    auto data = make_shared<ModelAndState>();
+    auto setup = [data, modelFile]() {
+        if (data->model) return;
+        data->model.reset(new Model(modelFile));
+        data->state = &data->model->initSystem();
+    };
+    auto setPose = [data, coordinateNames, numPoses](int pose) {
+        for (const auto& coordinateName : coordinateNames) {
+            const Coordinate& coord =
+                    data->model->getCoordinateSet().get(coordinateName);
+            const double fraction = double(pose) / (numPoses - 1);
+            coord.setValue(*data->state, coord.getRangeMin() + fraction *
+                    (coord.getRangeMax() - coord.getRangeMin()), false);
+        }
+        data->model->realizePosition(*data->state);
+    };
+
+    suite.add("GeometryPath::getLength+computeMomentArm/" + name,
+            [data, coordinateNames, numPoses, setPose]() {
+                const Set<Muscle>& muscles = data->model->getMuscles();
+                for (int pose = 0; pose < numPoses; ++pose) {
+                    setPose(pose);
+                    for (int i = 0; i < muscles.getSize(); ++i) {
+                        const GeometryPath& path =
+                                muscles[i].getGeometryPath();
+                        path.getLength(*data->state);
+                        for (const auto& coordinateName : coordinateNames)
+                            path.computeMomentArm(*data->state,
+                                    data->model->getCoordinateSet().get(
+                                            coordinateName));
+                    }
+                }
+            },
+            setup);
+
+    suite.add("Model::getMomentArmMatrix/" + name,
+            [data, numPoses, setPose]() {
+                for (int pose = 0; pose < numPoses; ++pose) {
+                    setPose(pose);
+                    data->model->getMomentArmMatrix(*data->state);
+                }
+            },
+            setup);
+}
+
+// Look up every state variable and coordinate of the model by path, as
+// scripts and controllers do in their per-step loops.
+void addLookUpByPath(BenchmarkSuite& suite, const string& name,
+        const string& modelFile) {
+    auto data = make_shared<ModelAndState>();
+    auto stateNames = make_shared<vector<string>>();
+    auto coordinatePaths = make_shared<vector<string>>();
+    auto setup = [data, stateNames, coordinatePaths, modelFile]() {
+        if (data->model) return;
+        data->model.reset(new Model(modelFile));
+        data->state = &data->model->initSystem();
+        const auto names = data->model->getStateVariableNames();
+        for (int i = 0; i < names.size(); ++i)
+            stateNames->push_back(names[i]);
+        for (const auto& coord : data->model->getComponentList<Coordinate>())
+            coordinatePaths->push_back(coord.getAbsolutePathString());
+    };
+    suite.add("Component::getStateVariableValue/" + name,
+            [data, stateNames]() {
+                for (int repeat = 0; repeat < 100; ++repeat)
+                    for (const auto& stateName : *stateNames)
+                        data->model->getStateVariableValue(*data->state,
+                                stateName);
+            },
+            setup);
+    suite.add("Component::getComponent/" + name,
+            [data, coordinatePaths]() {
+                for (int repeat = 0; repeat < 100; ++repeat)
+                    for (const auto& path : *coordinatePaths)
+                        data->model->getComponent<Coordinate>(path);
+            },
+            setup);
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        BenchmarkSuite suite("benchmarkSimulation", argc, argv);
+
+        addLoadAndInitSystem(suite, "arm26", "shared/arm26.osim");
+        addLoadAndInitSystem(suite, "gait10dof18musc",
+                "shared/gait10dof18musc_subject01.osim");
+        addLoadAndInitSystem(suite, "gait2354", "Analyze/subject01.osim");
+        addLoadAndInitSystem(suite, "gait2392",
+                "Wrapping/gait2392_pelvisFixed.osim");
+
+        addIntegrate(suite, "arm26", "shared/arm26.osim", 0.5);
+        addIntegrate(suite, "gait10dof18musc",
+                "shared/gait10dof18musc_subject01.osim", 0.1);
+
+        addPathSweep(suite, "arm26", "shared/arm26.osim",
+                {"r_shoulder_elev", "r_elbow_flex"});
+        addPathSweep(suite, "gait2392", "Wrapping/gait2392_pelvisFixed.osim",
+                {"hip_flexion_r", "knee_angle_r"});
+        addPathSweep(suite, "Arnold2010",
+                "Wrapping/Arnold2010_pelvisFixed.osim",
+                {"hip_flexion_r", "knee_angle_r"});
+
+        addLookUpByPath(suite, "gait2392",
+                "Wrapping/gait2392_pelvisFixed.osim");
+
+        return suite.run();
+    } catch (const std::exception& e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+}
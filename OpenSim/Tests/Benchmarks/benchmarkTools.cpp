@@ -0,0 +1,75 @@
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  benchmarkTools.cpp                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2020 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+// Benchmarks of the tools run on the gait2354 walking data, with the same
+// setup files as the tests of the applications. See Benchmark.h for the
+// command line arguments.
+
+#include "Benchmark.h"
+
+#include <OpenSim/Tools/AnalyzeTool.h>
+#include <OpenSim/Tools/InverseDynamicsTool.h>
+#include <OpenSim/Tools/InverseKinematicsTool.h>
+
+#include <memory>
+
+using namespace OpenSim;
+using namespace std;
+
+namespace {
+
+// Time Tool::run(); the tool (and its model) is loaded from the setup file
+// beforehand.
+template <typename Tool>
+void addTool(BenchmarkSuite& suite, const string& name,
+        const string& setupFile) {
+    auto tool = make_shared<unique_ptr<Tool>>();
+    suite.add(name,
+            [tool]() { (*tool)->run(); },
+            [tool, setupFile]() { tool->reset(new Tool(setupFile)); });
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        BenchmarkSuite suite("benchmarkTools", argc, argv);
+
+        addTool<InverseKinematicsTool>(suite,
+                "InverseKinematicsTool/gait2354",
+                "IK/subject01_Setup_InverseKinematics.xml");
+        addTool<InverseDynamicsTool>(suite,
+                "InverseDynamicsTool/gait2354",
+                "ID/subject01_Setup_InverseDynamics.xml");
+        addTool<AnalyzeTool>(suite,
+                "AnalyzeTool/MuscleAnalysis/gait2354",
+                "Analyze/subject01_Setup_MuscleAnalysis.xml");
+        addTool<AnalyzeTool>(suite,
+                "AnalyzeTool/StaticOptimization/gait2354",
+                "Analyze/subject01_Setup_StaticOptimization.xml");
+
+        return suite.run();
+    } catch (const std::exception& e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+}
@@ -47,6 +47,7 @@ public:
 };
 
 void testWrapCylinder();
+void testReusingWraps();
 void testWrapObjectUpdateFromXMLNode30515();
 void simulate(Model& osimModel, State& si, double initialTime, double finalTime);
 void simulateModelWithMusclesNoViz(const string &modelFile, double finalTime, double activation=0.5);
@@ -67,6 +68,13 @@ int main()
         std::cout << "Exception: " << e.what() << std::endl;
         failures.push_back("TestShoulderModel (multiple wrap)"); }
 
+    try{
+        testReusingWraps();
+    } catch (const std::exception& e) {
+        std::cout << "Exception: " << e.what() << std::endl;
+        failures.push_back("testReusingWraps");
+    }
+
     try{
         testWrapObjectUpdateFromXMLNode30515();
     } catch (const std::exception& e) {
@@ -403,6 +411,100 @@ void testWrapCylinder()
 }
 
 
+// The wrapping of a path over a wrap object is only computed again once the
+// points of the path have moved relative to the object. Computing the paths
+// again without moving anything must give the same lengths, and the lengths
+// must not depend on which poses were visited before.
+void testReusingWraps()
+{
+    Model model("TestShoulderWrapping.osim");
+    State& s = model.initSystem();
+    const auto& coords = model.getCoordinateSet();
+
+    auto calcLengths = [](const Model& aModel, const State& state)
+            -> std::vector<double> {
+        std::vector<double> lengths;
+        for (const auto& path : aModel.getComponentList<GeometryPath>())
+            lengths.push_back(path.getLength(state));
+        return lengths;
+    };
+
+    SimTK::Random::Uniform random(-0.1, 0.1);
+    random.setSeed(0);
+    for (int pose = 0; pose < 6; ++pose) {
+        // Move a single coordinate for some poses, all of them for others.
+        for (int i = 0; i < coords.getSize(); ++i) {
+            if (pose % 2 == 0 || i == pose % coords.getSize())
+                coords[i].setValue(s, coords[i].getDefaultValue() +
+                        random.getValue(), false);
+        }
+        model.realizePosition(s);
+        const std::vector<double> lengths = calcLengths(model, s);
+
+        s.invalidateAllCacheAtOrAbove(Stage::Position);
+        model.realizePosition(s);
+        const std::vector<double> again = calcLengths(model, s);
+        for (size_t k = 0; k < lengths.size(); ++k)
+            ASSERT(lengths[k] == again[k], __FILE__, __LINE__,
+                    "Path length changed without any point moving.");
+
+        // A copy of the model has not computed any wrapping yet.
+        Model copy(model);
+        State& copyState = copy.initSystem();
+        copyState.updQ() = s.getQ();
+        copy.realizePosition(copyState);
+        const std::vector<double> expected = calcLengths(copy, copyState);
+        for (size_t k = 0; k < lengths.size(); ++k)
+            ASSERT_EQUAL<double>(expected[k], lengths[k], 1e-5, __FILE__,
+                    __LINE__, "Path length depends on the previous poses.");
+    }
+
+    // The last wraps belong to the state: alternating between two states in
+    // different poses gives the lengths of each pose.
+    State other(s);
+    for (int i = 0; i < coords.getSize(); ++i)
+        coords[i].setValue(other, coords[i].getDefaultValue(), false);
+    model.realizePosition(other);
+    const std::vector<double> lengths = calcLengths(model, s);
+    const std::vector<double> otherLengths = calcLengths(model, other);
+    for (int repeat = 0; repeat < 2; ++repeat) {
+        s.invalidateAllCacheAtOrAbove(Stage::Position);
+        other.invalidateAllCacheAtOrAbove(Stage::Position);
+        model.realizePosition(s);
+        model.realizePosition(other);
+        const std::vector<double> again = calcLengths(model, s);
+        const std::vector<double> otherAgain = calcLengths(model, other);
+        for (size_t k = 0; k < lengths.size(); ++k) {
+            ASSERT(lengths[k] == again[k], __FILE__, __LINE__,
+                    "Path length changed after wrapping in another state.");
+            ASSERT(otherLengths[k] == otherAgain[k], __FILE__, __LINE__,
+                    "Path length changed after wrapping in another state.");
+        }
+    }
+
+    // Changing the geometry of a wrap object wraps the paths again, even
+    // though no point has moved.
+    auto& sphere = model.updComponent<WrapSphere>(
+            model.getComponentList<WrapSphere>().begin()->getAbsolutePath());
+    sphere.set_radius(1.5 * sphere.get_radius());
+    s.invalidateAllCacheAtOrAbove(Stage::Position);
+    model.realizePosition(s);
+    const std::vector<double> larger = calcLengths(model, s);
+    Model copy(model);
+    State& copyState = copy.initSystem();
+    copyState.updQ() = s.getQ();
+    copy.realizePosition(copyState);
+    const std::vector<double> expected = calcLengths(copy, copyState);
+    bool changed = false;
+    for (size_t k = 0; k < lengths.size(); ++k) {
+        ASSERT_EQUAL<double>(expected[k], larger[k], 1e-5, __FILE__,
+                __LINE__, "Path length ignores the change of the wrap object.");
+        if (larger[k] != lengths[k]) changed = true;
+    }
+    ASSERT(changed, __FILE__, __LINE__,
+            "No path wraps over the sphere whose radius was changed.");
+}
+
 void simulateModelWithMusclesNoViz(const string &modelFile, double finalTime, double activation)
 {
     // Create a new OpenSim model
@@ -35,9 +35,133 @@
 #include <OpenSim/Simulation/Model/PrescribedForce.h>
 #include <OpenSim/Actuators/Thelen2003Muscle.h>
 
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <thread>
+
 using namespace OpenSim;
 using namespace std;
 
+namespace {
+/* Execute the analyses of aModel over the states from iInitial to iFinal
+ * using up to numThreads threads. The time range is split into contiguous
+ * windows. The order-independent analyses are executed over the first window
+ * by the calling thread, and over every other window by a worker thread with
+ * its own copy of the model and of those analyses. The rows recorded by each
+ * copy are then appended, in time order, to the storages of the original
+ * analyses. All other analyses are executed serially by the calling thread
+ * over the whole time range. */
+void runInParallel(SimTK::State& s, Model& aModel, int iInitial, int iFinal,
+        const Storage& aStatesStore, bool aSolveForEquilibrium,
+        int numThreads)
+{
+    AnalysisSet& analysisSet = aModel.updAnalysisSet();
+
+    std::vector<int> parallelIndices, serialIndices;
+    for (int i = 0; i < analysisSet.getSize(); ++i) {
+        Analysis& analysis = analysisSet.get(i);
+        if (!analysis.getOn()) continue;
+        // Windows would record extra rows at their boundaries if steps were
+        // skipped, and there is nothing to merge without a storage list.
+        if (analysis.isOrderIndependent() &&
+                analysis.getStepInterval() == 1 &&
+                analysis.getStorageList().getSize() > 0) {
+            parallelIndices.push_back(i);
+        } else {
+            log_info("Analysis '{}' will be executed serially.",
+                    analysis.getName());
+            serialIndices.push_back(i);
+        }
+    }
+    if (parallelIndices.empty()) {
+        AnalyzeTool::run(s, aModel, iInitial, iFinal, aStatesStore,
+                aSolveForEquilibrium);
+        return;
+    }
+
+    const int numFrames = iFinal - iInitial + 1;
+    const int windowSize = (numFrames + numThreads - 1) / numThreads;
+    const int numWindows = (numFrames + windowSize - 1) / windowSize;
+
+    // Copies for all but the first window are created up front on this
+    // thread so that the workers only ever touch their own objects. Each
+    // worker also reads its own copy of the states, since Storage caches the
+    // last index it looked up.
+    std::vector<std::unique_ptr<Model>> models(numWindows);
+    std::vector<std::unique_ptr<Storage>> statesStores(numWindows);
+    std::vector<SimTK::State*> states(numWindows, nullptr);
+    for (int w = 1; w < numWindows; ++w) {
+        models[w].reset(aModel.clone());
+        AnalysisSet& analyses = models[w]->updAnalysisSet();
+        for (int i = analyses.getSize() - 1; i >= 0; --i) {
+            if (std::find(parallelIndices.begin(), parallelIndices.end(), i)
+                    == parallelIndices.end())
+                analyses.remove(i);
+        }
+        states[w] = &models[w]->initSystem();
+        statesStores[w].reset(new Storage(aStatesStore));
+    }
+
+    std::vector<std::exception_ptr> errors(numWindows);
+    std::vector<std::thread> workers;
+    for (int w = 1; w < numWindows; ++w) {
+        const int first = iInitial + w * windowSize;
+        const int last = std::min(iFinal, first + windowSize - 1);
+        workers.emplace_back([&, w, first, last]() {
+            try {
+                AnalyzeTool::run(*states[w], *models[w], first, last,
+                        *statesStores[w], aSolveForEquilibrium);
+            } catch (...) {
+                errors[w] = std::current_exception();
+            }
+        });
+    }
+
+    // The first window, followed by a serial pass for the analyses that
+    // cannot be split, runs on this thread while the workers are busy.
+    try {
+        for (int i : serialIndices) analysisSet.get(i).setOn(false);
+        AnalyzeTool::run(s, aModel, iInitial,
+                std::min(iFinal, iInitial + windowSize - 1), aStatesStore,
+                aSolveForEquilibrium);
+        if (!serialIndices.empty()) {
+            for (int i : serialIndices) analysisSet.get(i).setOn(true);
+            for (int i : parallelIndices) analysisSet.get(i).setOn(false);
+            AnalyzeTool::run(s, aModel, iInitial, iFinal, aStatesStore,
+                    aSolveForEquilibrium);
+        }
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+    for (int i : serialIndices) analysisSet.get(i).setOn(true);
+    for (int i : parallelIndices) analysisSet.get(i).setOn(true);
+
+    for (auto& worker : workers) worker.join();
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+
+    for (int k = 0; k < (int)parallelIndices.size(); ++k) {
+        Analysis& analysis = analysisSet.get(parallelIndices[k]);
+        ArrayPtrs<Storage>& results = analysis.getStorageList();
+        for (int w = 1; w < numWindows; ++w) {
+            ArrayPtrs<Storage>& windowResults =
+                    models[w]->updAnalysisSet().get(k).getStorageList();
+            OPENSIM_THROW_IF(windowResults.getSize() != results.getSize(),
+                    Exception,
+                    "Analysis '" + analysis.getName() + "' recorded a "
+                    "different number of storages in different windows.");
+            for (int j = 0; j < results.getSize(); ++j) {
+                const Storage& window = *windowResults.get(j);
+                for (int r = 0; r < window.getSize(); ++r)
+                    results.get(j)->append(*window.getStateVector(r));
+            }
+        }
+    }
+}
+} // anonymous namespace
+
 
 //=============================================================================
 // CONSTRUCTOR(S) AND DESTRUCTOR
@@ -59,6 +183,7 @@ AnalyzeTool::AnalyzeTool() :
     _coordinatesFileName(_coordinatesFileNameProp.getValueStr()),
     _speedsFileName(_speedsFileNameProp.getValueStr()),
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
+    _numThreads(_numThreadsProp.getValueInt()),
     _printResultFiles(true),
     _loadModelAndInput(false)
 {
@@ -79,6 +204,7 @@ AnalyzeTool::AnalyzeTool(const string &aFileName, bool aLoadModelAndInput) :
     _coordinatesFileName(_coordinatesFileNameProp.getValueStr()),
     _speedsFileName(_speedsFileNameProp.getValueStr()),
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
+    _numThreads(_numThreadsProp.getValueInt()),
     _printResultFiles(true),
     _loadModelAndInput(aLoadModelAndInput)
 {
@@ -111,6 +237,7 @@ AnalyzeTool::AnalyzeTool(Model& aModel) :
     _coordinatesFileName(_coordinatesFileNameProp.getValueStr()),
     _speedsFileName(_speedsFileNameProp.getValueStr()),
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
+    _numThreads(_numThreadsProp.getValueInt()),
     _printResultFiles(true),
     _loadModelAndInput(false)
 {
@@ -171,6 +298,7 @@ AnalyzeTool(const AnalyzeTool &aTool) :
     _coordinatesFileName(_coordinatesFileNameProp.getValueStr()),
     _speedsFileName(_speedsFileNameProp.getValueStr()),
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
+    _numThreads(_numThreadsProp.getValueInt()),
     _loadModelAndInput(false)
 {
     setNull();
@@ -191,6 +319,7 @@ setNull()
     _coordinatesFileName = "";
     _speedsFileName = "";
     _lowpassCutoffFrequency = -1.0;
+    _numThreads = 1;
 
     _statesStore = NULL;
 
@@ -236,6 +365,14 @@ void AnalyzeTool::setupProperties()
     _lowpassCutoffFrequencyProp.setName("lowpass_cutoff_frequency_for_coordinates");
     _propertySet.append( &_lowpassCutoffFrequencyProp );
 
+    comment = "Number of threads used to execute the analyses. Values greater than 1 split the time range "
+                 "into contiguous windows that are analyzed concurrently, each with its own copy of the model. "
+                 "Analyses that depend on the order in which states are visited (e.g., StaticOptimization) "
+                 "are always executed serially. The default value is 1.";
+    _numThreadsProp.setComment(comment);
+    _numThreadsProp.setName("num_threads");
+    _propertySet.append( &_numThreadsProp );
+
 }
 
 
@@ -259,6 +396,7 @@ operator=(const AnalyzeTool &aTool)
     _coordinatesFileName = aTool._coordinatesFileName;
     _speedsFileName = aTool._speedsFileName;
     _lowpassCutoffFrequency= aTool._lowpassCutoffFrequency;
+    _numThreads = aTool._numThreads;
     _statesStore = aTool._statesStore;
     _printResultFiles = aTool._printResultFiles;
     return(*this);
@@ -588,7 +726,16 @@ bool AnalyzeTool::run(bool plotting)
     //}
 
     log_info("Executing the analyses from {} to {}...", ti, tf);
-    run(s, *_model, iInitial, iFinal, *_statesStore, _solveForEquilibriumForAuxiliaryStates);
+    const int numThreads =
+            std::max(1, std::min(_numThreads, iFinal - iInitial + 1));
+    if (numThreads > 1) {
+        log_info("Using {} threads.", numThreads);
+        runInParallel(s, *_model, iInitial, iFinal, *_statesStore,
+                _solveForEquilibriumForAuxiliaryStates, numThreads);
+    } else {
+        run(s, *_model, iInitial, iFinal, *_statesStore,
+                _solveForEquilibriumForAuxiliaryStates);
+    }
     _model->getMultibodySystem().realize(s, SimTK::Stage::Position );
     } catch (const Exception& x) {
         x.print(cout);
@@ -68,6 +68,9 @@ private:
     /** Low-pass cut-off frequency for filtering the coordinates (does not apply to states). */
     PropertyDbl _lowpassCutoffFrequencyProp;
     double &_lowpassCutoffFrequency;
+    /** Number of threads used to execute the analyses. */
+    PropertyInt _numThreadsProp;
+    int &_numThreads;
 
     /** Storage for the model states. */
     Storage *_statesStore;
@@ -119,6 +122,14 @@ public:
     void setSpeedsFileName(const std::string &aFileName) { _speedsFileName = aFileName; }
     double getLowpassCutoffFrequency() const { return _lowpassCutoffFrequency; }
     void setLowpassCutoffFrequency(double aLowpassCutoffFrequency) { _lowpassCutoffFrequency = aLowpassCutoffFrequency; }
+    /** %Set the number of threads used by run(). With more than one thread,
+    the analyses that are order independent (see
+    Analysis::isOrderIndependent()) are executed on contiguous windows of the
+    states, each with its own copy of the model and analyses, and their
+    results are concatenated in time order. The remaining analyses are
+    executed serially over the whole time range. */
+    void setNumThreads(int aNumThreads) { _numThreads = aNumThreads; }
+    int getNumThreads() const { return _numThreads; }
     bool getLoadModelAndInput() const { return _loadModelAndInput; }
     void setLoadModelAndInput(bool b) { _loadModelAndInput = b; }
 
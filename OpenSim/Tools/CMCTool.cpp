@@ -75,7 +75,9 @@ CMCTool::CMCTool() :
     _optimizationConvergenceTolerance(_optimizationConvergenceToleranceProp.getValueDbl()),
     _maxIterations(_maxIterationsProp.getValueInt()),
     _printLevel(_printLevelProp.getValueInt()),
-    _verbose(_verboseProp.getValueBool())
+    _verbose(_verboseProp.getValueBool()),
+    _integrateActuatorsIndependently(_integrateActuatorsIndependentlyProp.getValueBool()),
+    _numThreads(_numThreadsProp.getValueInt())
 {
     setNull();
 }
@@ -105,7 +107,9 @@ CMCTool::CMCTool(const string &aFileName, bool aLoadModel) :
     _optimizationConvergenceTolerance(_optimizationConvergenceToleranceProp.getValueDbl()),
     _maxIterations(_maxIterationsProp.getValueInt()),
     _printLevel(_printLevelProp.getValueInt()),
-    _verbose(_verboseProp.getValueBool())
+    _verbose(_verboseProp.getValueBool()),
+    _integrateActuatorsIndependently(_integrateActuatorsIndependentlyProp.getValueBool()),
+    _numThreads(_numThreadsProp.getValueInt())
 {
     setNull();
     updateFromXMLDocument();
@@ -175,7 +179,9 @@ CMCTool(const CMCTool &aTool) :
     _optimizationConvergenceTolerance(_optimizationConvergenceToleranceProp.getValueDbl()),
     _maxIterations(_maxIterationsProp.getValueInt()),
     _printLevel(_printLevelProp.getValueInt()),
-    _verbose(_verboseProp.getValueBool())
+    _verbose(_verboseProp.getValueBool()),
+    _integrateActuatorsIndependently(_integrateActuatorsIndependentlyProp.getValueBool()),
+    _numThreads(_numThreadsProp.getValueInt())
 {
     setNull();
     *this = aTool;
@@ -208,6 +214,8 @@ setNull()
     _maxIterations = 1000;
     _printLevel = 0;
     _verbose = false;
+    _integrateActuatorsIndependently = false;
+    _numThreads = 1;
 
     _replaceForceSet = false;   // default should be false for Forward.
     _solveForEquilibriumForAuxiliaryStates = true;
@@ -327,6 +335,20 @@ void CMCTool::setupProperties()
     _verboseProp.setName("use_verbose_printing");
     _propertySet.append( &_verboseProp );
 
+    comment = "Flag (true or false) indicating whether to integrate the states of each actuator independently "
+                 "of the other actuators when predicting the actuator forces for a set of controls. Each actuator "
+                 "is then integrated with its own step size, and is not integrated again once its control has "
+                 "converged. The default value is false.";
+    _integrateActuatorsIndependentlyProp.setComment(comment);
+    _integrateActuatorsIndependentlyProp.setName("integrate_actuators_independently");
+    _propertySet.append( &_integrateActuatorsIndependentlyProp );
+
+    comment = "Number of threads used to integrate the actuators when integrate_actuators_independently is true. "
+                 "The default value is 1.";
+    _numThreadsProp.setComment(comment);
+    _numThreadsProp.setName("num_threads");
+    _propertySet.append( &_numThreadsProp );
+
 }
 
 
@@ -365,6 +387,8 @@ operator=(const CMCTool &aTool)
     _maxIterations = aTool._maxIterations;
     _printLevel = aTool._printLevel;
     _verbose = aTool._verbose;
+    _integrateActuatorsIndependently = aTool._integrateActuatorsIndependently;
+    _numThreads = aTool._numThreads;
 
     return(*this);
 }
@@ -681,6 +705,8 @@ bool CMCTool::run()
 
     VectorFunctionForActuators *predictor =
         new VectorFunctionForActuators(&actuatorSystem, _model, &cmcActSubsystem);
+    predictor->setIntegrateActuatorsIndependently(_integrateActuatorsIndependently);
+    predictor->setNumThreads(_numThreads);
 
     controller->setActuatorForcePredictor(predictor);
     controller->updTaskSet().setFunctions(*qAndPosSet);
@@ -122,6 +122,13 @@ private:
     /** Flag for turning on and off verbose printing. */
     PropertyBool _verboseProp;
     bool &_verbose;
+    /** Flag indicating whether to integrate the states of each actuator
+    independently of the other actuators when predicting actuator forces. */
+    PropertyBool _integrateActuatorsIndependentlyProp;
+    bool &_integrateActuatorsIndependently;
+    /** Number of threads used to integrate the actuators independently. */
+    PropertyInt _numThreadsProp;
+    int &_numThreads;
 
     ForceSet _originalForceSet;
 
@@ -192,6 +199,12 @@ public:
     bool getUseFastTarget() const { return _useFastTarget;};         
     void setUseFastTarget(bool useFastTarget) const {  _useFastTarget=useFastTarget; };
 
+    // Actuator force prediction (see VectorFunctionForActuators)
+    bool getIntegrateActuatorsIndependently() const { return _integrateActuatorsIndependently; }
+    void setIntegrateActuatorsIndependently(bool aTrueFalse) { _integrateActuatorsIndependently = aTrueFalse; }
+    int getNumThreads() const { return _numThreads; }
+    void setNumThreads(int aNumThreads) { _numThreads = aNumThreads; }
+
 
     //--------------------------------------------------------------------------
     // INTERFACE
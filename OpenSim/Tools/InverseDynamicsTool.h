@@ -88,6 +88,10 @@ protected:
     PropertyStr _outputBodyForcesAtJointsFileNameProp;
     std::string &_outputBodyForcesAtJointsFileName;
 
+    /** Number of threads used to solve for the generalized forces */
+    PropertyInt _numThreadsProp;
+    int &_numThreads;
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -156,6 +160,8 @@ public:
     void setLowpassCutoffFrequency(double aFrequency) {
         _lowpassCutoffFrequency = aFrequency;
     }
+    int getNumThreads() const { return _numThreads; }
+    void setNumThreads(int aNumThreads) { _numThreads = aNumThreads; }
     //--------------------------------------------------------------------------
     // INTERFACE
     //--------------------------------------------------------------------------
@@ -40,10 +40,90 @@
 #include <OpenSim/Simulation/InverseKinematicsSolver.h>
 #include <OpenSim/Simulation/Model/Model.h>
 
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <thread>
+
 using namespace OpenSim;
 using namespace std;
 using namespace SimTK;
 
+namespace {
+/* Solve the numFrames marker frames starting at startIx by splitting them
+ * into numThreads contiguous chunks. Each chunk is solved on its own thread
+ * with its own copy of the model, state and InverseKinematicsSolver, and is
+ * warm-started by assembling at its first frame. The solution (and, if
+ * requested, the marker errors and locations) of every frame is written to
+ * the corresponding entry of the output vectors, in time order. */
+void solveFramesInParallel(const Model& model,
+        const MarkersReference& markersReference,
+        SimTK::Array_<CoordinateReference>& coordinateReferences,
+        double constraintWeight, double accuracy,
+        const std::vector<double>& times, int startIx, int numFrames,
+        int numThreads, bool reportErrors, bool reportLocations,
+        std::vector<SimTK::Vector>& qSolutions,
+        std::vector<SimTK::Array_<double>>& squaredMarkerErrors,
+        std::vector<SimTK::Array_<Vec3>>& markerLocations)
+{
+    qSolutions.resize(numFrames);
+    if (reportErrors) squaredMarkerErrors.resize(numFrames);
+    if (reportLocations) markerLocations.resize(numFrames);
+
+    // Copies of the model and solvers are created up front on this thread so
+    // that the workers only ever touch their own objects.
+    std::vector<std::unique_ptr<Model>> models(numThreads);
+    std::vector<std::unique_ptr<InverseKinematicsSolver>> solvers(numThreads);
+    std::vector<SimTK::State> states(numThreads);
+    for (int t = 0; t < numThreads; ++t) {
+        models[t].reset(model.clone());
+        // Analyses (e.g., the Kinematics reporter) are only stepped by the
+        // calling thread, once all frames have been solved.
+        models[t]->updAnalysisSet().clearAndDestroy();
+        states[t] = models[t]->initSystem();
+        solvers[t].reset(new InverseKinematicsSolver(*models[t],
+                markersReference, coordinateReferences, constraintWeight));
+        solvers[t]->setAccuracy(accuracy);
+    }
+
+    const int chunkSize = (numFrames + numThreads - 1) / numThreads;
+    std::vector<std::exception_ptr> errors(numThreads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < numThreads; ++t) {
+        const int begin = t * chunkSize;
+        const int end = std::min(numFrames, begin + chunkSize);
+        if (begin >= end) break;
+        workers.emplace_back([&, t, begin, end]() {
+            try {
+                InverseKinematicsSolver& solver = *solvers[t];
+                SimTK::State& s = states[t];
+                s.updTime() = times[startIx + begin];
+                solver.assemble(s);
+                for (int i = begin; i < end; ++i) {
+                    s.updTime() = times[startIx + i];
+                    solver.track(s);
+                    qSolutions[i] = s.getQ();
+                    if (reportErrors)
+                        solver.computeCurrentSquaredMarkerErrors(
+                                squaredMarkerErrors[i]);
+                    if (reportLocations)
+                        solver.computeCurrentMarkerLocations(
+                                markerLocations[i]);
+                }
+                log_info("Solved frames {} to {}.", startIx + begin,
+                        startIx + end - 1);
+            } catch (...) {
+                errors[t] = std::current_exception();
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+}
+} // anonymous namespace
+
 //=============================================================================
 // CONSTRUCTOR(S) AND DESTRUCTOR
 //=============================================================================
@@ -88,6 +168,7 @@ void InverseKinematicsTool::constructProperties()
     constructProperty_coordinate_file("");
     constructProperty_output_motion_file("");
     constructProperty_report_marker_locations(false);
+    constructProperty_num_threads(1);
 }
 
 //=============================================================================
@@ -194,19 +275,48 @@ bool InverseKinematicsTool::run()
 
         Stopwatch watch;
 
+        // With multiple threads, all frames are solved up front and the
+        // loop below only reports the results in time order.
+        const int numThreads = std::max(1, std::min(get_num_threads(), Nframes));
+        std::vector<SimTK::Vector> qSolutions;
+        std::vector<SimTK::Array_<double>> frameSquaredMarkerErrors;
+        std::vector<SimTK::Array_<Vec3>> frameMarkerLocations;
+        if (numThreads > 1) {
+            log_info("Solving {} frames using {} threads.", Nframes,
+                    numThreads);
+            solveFramesInParallel(*_model, markersReference,
+                    coordinateReferences, get_constraint_weight(),
+                    get_accuracy(), times, start_ix, Nframes, numThreads,
+                    get_report_errors(), get_report_marker_locations(),
+                    qSolutions, frameSquaredMarkerErrors,
+                    frameMarkerLocations);
+        }
+
         for (int i = start_ix; i <= final_ix; ++i) {
             s.updTime() = times[i];
-            ikSolver.track(s);
-            // show progress line every 1000 frames so users see progress
-            if (std::remainder(i - start_ix, 1000) == 0 && i != start_ix)
-                log_info("Solved {} frame(s)...", i - start_ix);
+            if (numThreads > 1) {
+                s.updQ() = qSolutions[i - start_ix];
+                if (get_report_errors())
+                    squaredMarkerErrors = frameSquaredMarkerErrors[i - start_ix];
+                if (get_report_marker_locations())
+                    markerLocations = frameMarkerLocations[i - start_ix];
+            } else {
+                ikSolver.track(s);
+                // show progress line every 1000 frames so users see progress
+                if (std::remainder(i - start_ix, 1000) == 0 && i != start_ix)
+                    log_info("Solved {} frame(s)...", i - start_ix);
+                if (get_report_errors())
+                    ikSolver.computeCurrentSquaredMarkerErrors(
+                            squaredMarkerErrors);
+                if (get_report_marker_locations())
+                    ikSolver.computeCurrentMarkerLocations(markerLocations);
+            }
             if(get_report_errors()){
                 Array<double> markerErrors(0.0, 3);
                 double totalSquaredMarkerError = 0.0;
                 double maxSquaredMarkerError = 0.0;
                 int worst = -1;
 
-                ikSolver.computeCurrentSquaredMarkerErrors(squaredMarkerErrors);
                 for(int j=0; j<nm; ++j){
                     totalSquaredMarkerError += squaredMarkerErrors[j];
                     if(squaredMarkerErrors[j] > maxSquaredMarkerError){
@@ -229,7 +339,6 @@ bool InverseKinematicsTool::run()
             }
 
             if(get_report_marker_locations()){
-                ikSolver.computeCurrentMarkerLocations(markerLocations);
                 Array<double> locations(0.0, 3*nm);
                 for(int j=0; j<nm; ++j){
                     for(int k=0; k<3; ++k)
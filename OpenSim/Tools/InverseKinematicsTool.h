@@ -71,6 +71,11 @@ public:
             "Flag indicating whether or not to report model marker locations. "
             "Note, model marker locations are expressed in Ground.");
 
+    OpenSim_DECLARE_PROPERTY(num_threads, int,
+            "Number of threads used to solve the marker frames. Values greater "
+            "than 1 split the time range into contiguous chunks that are solved "
+            "concurrently, each on its own copy of the model. Default is 1.");
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -102,6 +107,15 @@ public:
 
     IKTaskSet& getIKTaskSet() { return upd_IKTaskSet(); }
 
+    /** %Set the number of threads used by run(). With more than one thread,
+    the frames in the time range are split into contiguous chunks and each
+    chunk is solved by its own copy of the model and InverseKinematicsSolver,
+    starting from an assemble() at the chunk's first frame. Results are
+    written in time order and match the serial solution to within the
+    solver accuracy. */
+    void setNumThreads(int numThreads) { upd_num_threads() = numThreads; }
+    int getNumThreads() const { return get_num_threads(); }
+
     //--------------------------------------------------------------------------
     // INTERFACE
     //--------------------------------------------------------------------------
@@ -71,7 +71,9 @@ RRATool::RRATool() :
     _finalTimeForCOMAdjustment(_finalTimeForCOMAdjustmentProp.getValueDbl()),
     _adjustedCOMBody(_adjustedCOMBodyProp.getValueStr()),
     _outputModelFile(_outputModelFileProp.getValueStr()),
-    _verbose(_verboseProp.getValueBool())
+    _verbose(_verboseProp.getValueBool()),
+    _integrateActuatorsIndependently(_integrateActuatorsIndependentlyProp.getValueBool()),
+    _numThreads(_numThreadsProp.getValueInt())
 {
     setNull();
 }
@@ -96,7 +98,9 @@ RRATool::RRATool(const string &aFileName, bool aLoadModel) :
     _finalTimeForCOMAdjustment(_finalTimeForCOMAdjustmentProp.getValueDbl()),
     _adjustedCOMBody(_adjustedCOMBodyProp.getValueStr()),
     _outputModelFile(_outputModelFileProp.getValueStr()),
-    _verbose(_verboseProp.getValueBool())
+    _verbose(_verboseProp.getValueBool()),
+    _integrateActuatorsIndependently(_integrateActuatorsIndependentlyProp.getValueBool()),
+    _numThreads(_numThreadsProp.getValueInt())
 {
     setNull();
     updateFromXMLDocument();
@@ -161,7 +165,9 @@ RRATool(const RRATool &aTool) :
     _finalTimeForCOMAdjustment(_finalTimeForCOMAdjustmentProp.getValueDbl()),
     _adjustedCOMBody(_adjustedCOMBodyProp.getValueStr()),
     _outputModelFile(_outputModelFileProp.getValueStr()),
-    _verbose(_verboseProp.getValueBool())
+    _verbose(_verboseProp.getValueBool()),
+    _integrateActuatorsIndependently(_integrateActuatorsIndependentlyProp.getValueBool()),
+    _numThreads(_numThreadsProp.getValueInt())
 {
     setNull();
     *this = aTool;
@@ -193,6 +199,8 @@ setNull()
     _outputModelFile = "";
     _adjustKinematicsToReduceResiduals=true;
     _verbose = false;
+    _integrateActuatorsIndependently = false;
+    _numThreads = 1;
     _targetDT = .001;
     _replaceForceSet = false;   // default should be false for Forward.
 
@@ -292,6 +300,20 @@ void RRATool::setupProperties()
     _verboseProp.setName("use_verbose_printing");
     _propertySet.append( &_verboseProp );
 
+    comment = "Flag (true or false) indicating whether to integrate the states of each actuator independently "
+                 "of the other actuators when predicting the actuator forces for a set of controls. Each actuator "
+                 "is then integrated with its own step size, and is not integrated again once its control has "
+                 "converged. The default value is false.";
+    _integrateActuatorsIndependentlyProp.setComment(comment);
+    _integrateActuatorsIndependentlyProp.setName("integrate_actuators_independently");
+    _propertySet.append( &_integrateActuatorsIndependentlyProp );
+
+    comment = "Number of threads used to integrate the actuators when integrate_actuators_independently is true. "
+                 "The default value is 1.";
+    _numThreadsProp.setComment(comment);
+    _numThreadsProp.setName("num_threads");
+    _propertySet.append( &_numThreadsProp );
+
 }
 
 
@@ -326,6 +348,8 @@ operator=(const RRATool &aTool)
     _initialTimeForCOMAdjustment = aTool._initialTimeForCOMAdjustment;
     _finalTimeForCOMAdjustment = aTool._finalTimeForCOMAdjustment;
     _verbose = aTool._verbose;
+    _integrateActuatorsIndependently = aTool._integrateActuatorsIndependently;
+    _numThreads = aTool._numThreads;
 
     return(*this);
 }
@@ -669,6 +693,8 @@ bool RRATool::run()
 
     VectorFunctionForActuators *predictor =
         new VectorFunctionForActuators(&actuatorSystem, _model, &cmcActSubsystem);
+    predictor->setIntegrateActuatorsIndependently(_integrateActuatorsIndependently);
+    predictor->setNumThreads(_numThreads);
 
     controller->setActuatorForcePredictor(predictor);
     controller->updTaskSet().setFunctions(*qAndPosSet);
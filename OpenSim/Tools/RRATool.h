@@ -117,6 +117,13 @@ private:
     /** Flag for turning on and off verbose printing. */
     PropertyBool _verboseProp;
     bool &_verbose;
+    /** Flag indicating whether to integrate the states of each actuator
+    independently of the other actuators when predicting actuator forces. */
+    PropertyBool _integrateActuatorsIndependentlyProp;
+    bool &_integrateActuatorsIndependently;
+    /** Number of threads used to integrate the actuators independently. */
+    PropertyInt _numThreadsProp;
+    int &_numThreads;
 
     ForceSet _originalForceSet;
 
@@ -166,6 +173,10 @@ public:
 
     bool getAdjustCOMToReduceResiduals() { return _adjustCOMToReduceResiduals; }
     void setAdjustCOMToReduceResiduals(bool aAdjust) { _adjustCOMToReduceResiduals = aAdjust; }
+    bool getIntegrateActuatorsIndependently() const { return _integrateActuatorsIndependently; }
+    void setIntegrateActuatorsIndependently(bool aTrueFalse) { _integrateActuatorsIndependently = aTrueFalse; }
+    int getNumThreads() const { return _numThreads; }
+    void setNumThreads(int aNumThreads) { _numThreads = aNumThreads; }
 
     const std::string &getAdjustedCOMBody() { return _adjustedCOMBody; }
     void setAdjustedCOMBody(const std::string &aBody) { _adjustedCOMBody = aBody; }
@@ -177,12 +177,9 @@ computeDesiredAccelerations( const SimTK::State& state, double aT)
     // Term 1: Experimental Acceleration
     double a;
     if(_aTrk[0]==NULL) {
-        std::vector<int> derivComponents(2);
-        derivComponents[0]=0;
-        derivComponents[1]=0;
-        a = (_ka)[0]*_pTrk[0]->calcDerivative(derivComponents,SimTK::Vector(1,aT));
+        a = (_ka)[0]*_pTrk[0]->calcDerivative(aT, 2);
     } else {
-        a = (_ka)[0]*_aTrk[0]->calcValue(SimTK::Vector(1,aT));
+        a = (_ka)[0]*_aTrk[0]->calcValue(aT);
     }
 
     // Surface Error
@@ -30,6 +30,8 @@
 //  2. Test a PrescribedController on a block with an ideal actuator
 //  3. Test a CorrectionController tracking a block with an ideal actuator
 //  4. Test a PrescribedController on the arm26 model with reserves.
+//  5. Test that a PrescribedController evaluates control functions that
+//     share their times together and gives the same controls.
 //     Add tests here as new controller types are added to OpenSim
 //
 //=============================================================================
@@ -46,6 +48,7 @@ void testCorrectionControllerOnBlock();
 void testPrescribedControllerFromFile(const std::string& modelFile,
                                       const std::string& actuatorsFile,
                                       const std::string& controlsFile);
+void testPrescribedControllerControlGroups();
 
 int main()
 {
@@ -60,6 +63,8 @@ int main()
         log_info("Testing PrescribedController from File");
         testPrescribedControllerFromFile("arm26.osim", "arm26_Reserve_Actuators.xml",
                                          "arm26_controls.xml");
+        log_info("Testing PrescribedController control groups");
+        testPrescribedControllerControlGroups();
     }   
     catch (const std::exception& e) {
         log_error("TestControllers failed due to the following error(s): {}",
@@ -417,3 +422,97 @@ void testPrescribedControllerFromFile(const std::string& modelFile,
      
     osimModel.disownAllComponents();
 }
+
+void testPrescribedControllerControlGroups()
+{
+    using namespace SimTK;
+
+    // The controls computed by the controller must match the value of each
+    // actuator's control function, including before the first time and after
+    // the last time of the functions.
+    auto checkControls = [](const Model& model,
+                            const PrescribedController& controller,
+                            State& s) {
+        const auto& actuators = controller.getActuatorSet();
+        Vector actuatorControls(1);
+        for (double time : {-0.25, 0.0, 0.123, 0.5, 0.77, 1.0, 1.3}) {
+            s.setTime(time);
+            Vector controls(model.getNumControls(), 0.0);
+            controller.computeControls(s, controls);
+            for (int i = 0; i < actuators.getSize(); ++i) {
+                actuators[i].getControls(controls, actuatorControls);
+                ASSERT_EQUAL(controller.get_ControlFunctions()[i]
+                                     .calcValue(Vector(1, time)),
+                             actuatorControls[0], 1e-12, __FILE__, __LINE__,
+                             "PrescribedController gave the wrong control for "
+                             "actuator " + actuators[i].getName() + ".");
+            }
+        }
+    };
+
+    // Controls for all the muscles of arm26 from a file.
+    Model model("arm26.osim");
+    TimeSeriesTable table;
+    std::vector<std::string> labels;
+    for (int i = 0; i < model.getMuscles().getSize(); ++i)
+        labels.push_back(model.getMuscles()[i].getName());
+    table.setColumnLabels(labels);
+    for (int itime = 0; itime <= 10; ++itime) {
+        RowVector row((int)labels.size());
+        for (int i = 0; i < row.size(); ++i)
+            row[i] = 0.5 + 0.4 * std::sin(0.7 * itime + i);
+        table.appendRow(0.1 * itime, row);
+    }
+    STOFileAdapter::write(table, "arm26_control_groups.sto");
+
+    for (int interpolation : {1, 3}) {
+        Model fileModel("arm26.osim");
+        auto* controller = new PrescribedController(
+                "arm26_control_groups.sto", interpolation);
+        fileModel.addController(controller);
+        checkControls(fileModel, *controller, fileModel.initSystem());
+    }
+
+    // Some functions share their times and some do not.
+    Model mixedModel("arm26.osim");
+    mixedModel.finalizeFromProperties();
+    auto* controller = new PrescribedController();
+    controller->setActuators(mixedModel.updActuators());
+    const double times[] = {0, 0.5, 1};
+    const double values1[] = {0.1, 0.6, 0.2};
+    const double values2[] = {0.9, 0.3, 0.4};
+    const double otherTimes[] = {0, 0.3, 1};
+    PiecewiseLinearFunction* retained = nullptr;
+    for (int i = 0; i < controller->getActuatorSet().getSize(); ++i) {
+        Function* function;
+        if (i == 2)
+            function = new Constant(0.3);
+        else if (i == 4)
+            function = new PiecewiseLinearFunction(3, otherTimes, values1);
+        else
+            function = new PiecewiseLinearFunction(3, times,
+                                                   i % 2 ? values1 : values2);
+        if (i == 1)
+            retained = dynamic_cast<PiecewiseLinearFunction*>(function);
+        controller->prescribeControlForActuator(i, function);
+    }
+    mixedModel.addController(controller);
+    State& s = mixedModel.initSystem();
+    checkControls(mixedModel, *controller, s);
+
+    // Functions edited in place are used right away, and are grouped again
+    // when the model is initialized again.
+    auto& edited = dynamic_cast<PiecewiseLinearFunction&>(
+            controller->upd_ControlFunctions()[0]);
+    edited.setY(1, 0.8);
+    checkControls(mixedModel, *controller, s);
+    edited.setX(1, 0.4);
+    checkControls(mixedModel, *controller, s);
+    checkControls(mixedModel, *controller, mixedModel.initSystem());
+
+    // So are functions edited through a pointer kept from before the model
+    // was initialized, which does not involve the controller's properties.
+    State& s2 = mixedModel.initSystem();
+    retained->setY(0, 0.7);
+    checkControls(mixedModel, *controller, s2);
+}
@@ -26,14 +26,107 @@
 
 // INCLUDES
 #include "VectorFunctionForActuators.h"
+#include <OpenSim/Simulation/Control/ControlLinear.h>
 #include <OpenSim/Simulation/Model/CMCActuatorSubsystem.h>
 #include <OpenSim/Simulation/Model/Model.h>
 #include "CMC.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <map>
+#include <thread>
+
 
 using namespace OpenSim;
 using namespace std;
 
+namespace {
+// Results of an actuator are reused for a control that differs from the one
+// they were computed with by at most this much. The root solver converges the
+// actuator forces to a much coarser tolerance.
+const double ControlTolerance = 1.0e-12;
+
+// System whose continuous states are those of the actuator being integrated
+// independently. Their derivatives are computed by the given function when
+// the system is realized to Stage::Dynamics.
+class IndependentActuatorSystemRep : public SimTK::System::Guts {
+public:
+    IndependentActuatorSystemRep() :
+        SimTK::System::Guts("IndependentActuatorSystem", "1.0") {}
+    IndependentActuatorSystemRep* cloneImpl() const override
+    {   return new IndependentActuatorSystemRep(*this); }
+};
+
+class IndependentActuatorSubsystemRep : public SimTK::Subsystem::Guts {
+public:
+    typedef std::function<void(const SimTK::State&)> Dynamics;
+    IndependentActuatorSubsystemRep(int numStates, Dynamics dynamics) :
+        SimTK::Subsystem::Guts("IndependentActuatorSubsystem", "1.0"),
+        _numStates(numStates), _dynamics(std::move(dynamics)) {}
+    IndependentActuatorSubsystemRep* cloneImpl() const override
+    {   return new IndependentActuatorSubsystemRep(*this); }
+    int realizeSubsystemTopologyImpl(SimTK::State& s) const override {
+        s.allocateZ(getMySubsystemIndex(), SimTK::Vector(_numStates, 0.0));
+        return 0;
+    }
+    int realizeSubsystemDynamicsImpl(const SimTK::State& s) const override {
+        _dynamics(s);
+        return 0;
+    }
+private:
+    int _numStates;
+    Dynamics _dynamics;
+};
+
+class IndependentActuatorSystem : public SimTK::System {
+public:
+    IndependentActuatorSystem(int numStates,
+            IndependentActuatorSubsystemRep::Dynamics dynamics) {
+        adoptSystemGuts(new IndependentActuatorSystemRep());
+        SimTK::DefaultSystemSubsystem defsub(*this);
+        SimTK::Subsystem subsystem;
+        subsystem.adoptSubsystemGuts(new IndependentActuatorSubsystemRep(
+                numStates, std::move(dynamics)));
+        adoptSubsystem(subsystem);
+    }
+};
+}
+
+/** Data used by one thread to integrate actuators independently. */
+struct VectorFunctionForActuators::Workspace {
+    /** Copy of the model, without controllers. */
+    std::unique_ptr<Model> model;
+    /** The copy of each actuator in model, and the components of model that
+    own its state variables. */
+    std::vector<const ScalarActuator*> actuators;
+    std::vector<std::vector<const Component*>> stateVariableOwners;
+    /** State of model from which the poses are created. */
+    SimTK::State poseTemplate;
+    /** The model posed at each time visited during the current interval,
+    realized to Stage::Velocity. */
+    std::map<double, SimTK::State> poses;
+
+    /** Actuator being integrated and its control. */
+    int index{-1};
+    Control* control{nullptr};
+
+    /** System holding the states of the actuator being integrated (and
+    unused states with zero derivatives for actuators with fewer states),
+    and its integrator. */
+    std::unique_ptr<IndependentActuatorSystem> system;
+    std::unique_ptr<SimTK::Integrator> integrator;
+    SimTK::State systemState;
+
+    SimTK::State state;
+    SimTK::Vector controls;
+    SimTK::Vector actuatorControls = SimTK::Vector(1, 0.0);
+    SimTK::Vector_<SimTK::SpatialVec> bodyForces;
+    SimTK::Vector generalizedForces;
+};
+
 //=============================================================================
 // DESTRUCTOR AND CONSTRUCTORS
 //=============================================================================
@@ -99,6 +192,10 @@ setNull()
     _CMCActuatorSubsystem = NULL;
     _model             = NULL;
     _integrator        = NULL;
+    _integrateActuatorsIndependently = false;
+    _numThreads = 1;
+    _independentAccuracy = 5.0e-6;
+    _independentMaxStepSize = 1.0e-3;
 }
 
 //_____________________________________________________________________________
@@ -151,6 +248,7 @@ void VectorFunctionForActuators::
 setInitialTime(double aTI)
 {
     _ti = aTI;
+    clearIndependentResults();
 }
 //_____________________________________________________________________________
 /**
@@ -177,6 +275,7 @@ void VectorFunctionForActuators::
 setFinalTime(double aTF)
 {
     _tf = aTF;
+    clearIndependentResults();
 }
 //_____________________________________________________________________________
 /**
@@ -234,6 +333,91 @@ getCMCActSubsys()
     return(_CMCActuatorSubsystem);
 }
 
+//-----------------------------------------------------------------------------
+// INDEPENDENT INTEGRATION
+//-----------------------------------------------------------------------------
+//_____________________________________________________________________________
+/**
+ * Set whether the states of each actuator are integrated independently.
+ */
+void VectorFunctionForActuators::
+setIntegrateActuatorsIndependently(bool aTrueFalse)
+{
+    _integrateActuatorsIndependently = aTrueFalse;
+    clearIndependentResults();
+}
+//_____________________________________________________________________________
+/**
+ * Get whether the states of each actuator are integrated independently.
+ */
+bool VectorFunctionForActuators::
+getIntegrateActuatorsIndependently() const
+{
+    return(_integrateActuatorsIndependently);
+}
+//_____________________________________________________________________________
+/**
+ * Set the number of threads used to integrate the actuators independently.
+ */
+void VectorFunctionForActuators::
+setNumThreads(int aNumThreads)
+{
+    _numThreads = std::max(1, aNumThreads);
+}
+//_____________________________________________________________________________
+/**
+ * Get the number of threads used to integrate the actuators independently.
+ */
+int VectorFunctionForActuators::
+getNumThreads() const
+{
+    return(_numThreads);
+}
+//_____________________________________________________________________________
+/**
+ * Set the accuracy of the integrators used to integrate the actuators
+ * independently.
+ */
+void VectorFunctionForActuators::
+setIndependentIntegratorAccuracy(double aAccuracy)
+{
+    _independentAccuracy = aAccuracy;
+    _workspaces.clear();
+    clearIndependentResults();
+}
+//_____________________________________________________________________________
+/**
+ * Get the accuracy of the integrators used to integrate the actuators
+ * independently.
+ */
+double VectorFunctionForActuators::
+getIndependentIntegratorAccuracy() const
+{
+    return(_independentAccuracy);
+}
+//_____________________________________________________________________________
+/**
+ * Set the maximum step size of the integrators used to integrate the
+ * actuators independently.
+ */
+void VectorFunctionForActuators::
+setIndependentIntegratorMaximumStepSize(double aMaxStepSize)
+{
+    _independentMaxStepSize = aMaxStepSize;
+    _workspaces.clear();
+    clearIndependentResults();
+}
+//_____________________________________________________________________________
+/**
+ * Get the maximum step size of the integrators used to integrate the
+ * actuators independently.
+ */
+double VectorFunctionForActuators::
+getIndependentIntegratorMaximumStepSize() const
+{
+    return(_independentMaxStepSize);
+}
+
 
 
 //=============================================================================
@@ -249,6 +433,11 @@ getCMCActSubsys()
 void VectorFunctionForActuators::
 evaluate(const SimTK::State& s, const double *aX, double *rF)
 {
+    if(_integrateActuatorsIndependently) {
+        evaluateIndependently(s, aX, rF);
+        return;
+    }
+
     int i;
     int N = getNX();
 
@@ -301,3 +490,331 @@ void VectorFunctionForActuators::evaluate(const SimTK::State& s,
         const OpenSim::Array<double>& aX, OpenSim::Array<double>& rF) {
     evaluate( s, &aX[0],&rF[0]);
 }
+
+
+//=============================================================================
+// INDEPENDENT INTEGRATION
+//=============================================================================
+//_____________________________________________________________________________
+/**
+ * Evaluate the vector function by integrating the states of each actuator
+ * independently of the other actuators.
+ *
+ * @param s SimTK::State.
+ * @param aX Array of controls.
+ * @param rF Array of actuator force differences.
+ */
+void VectorFunctionForActuators::
+evaluateIndependently(const SimTK::State& s, const double *aX, double *rF)
+{
+    int N = getNX();
+
+    CMC& controller=  dynamic_cast<CMC&>(_model->updControllerSet().get("CMC" ));
+    ControlSet& controlSet = controller.updControlSet();
+    controlSet.setControlValues(_tf, aX);
+
+    if((int)_independentActuators.size() != N)
+        initializeIndependentActuators();
+
+    // Find the actuators that have not been integrated with their control
+    // over this interval yet.
+    std::vector<int> pending;
+    for(int i=0;i<N;i++) {
+        IndependentActuator& actuator = _independentActuators[i];
+        bool statesChanged = false;
+        for(int j=0;j<(int)actuator.stateVariables.size();j++) {
+            const double value = actuator.stateVariables[j].first->
+                    getStateVariableValue(s, actuator.stateVariables[j].second);
+            if(value != actuator.initialStates[j]) {
+                actuator.initialStates[j] = value;
+                statesChanged = true;
+            }
+        }
+        if(statesChanged) {
+            actuator.controls.clear();
+            actuator.actuations.clear();
+            actuator.finalStates.clear();
+        }
+
+        const double x = aX[i];
+        const auto found = std::find_if(actuator.controls.begin(),
+                actuator.controls.end(), [x](double control) {
+                    return std::abs(control - x) <= ControlTolerance; });
+        if(found == actuator.controls.end())
+            pending.push_back(i);
+        else
+            actuator.current = int(found - actuator.controls.begin());
+    }
+
+    // Each thread integrates actuators on its own copy of the model, with its
+    // own copy of the control of each actuator (evaluating a control is not
+    // thread safe).
+    const int numThreads =
+            std::max(1, std::min(_numThreads, (int)pending.size()));
+    while((int)_workspaces.size() < numThreads)
+        _workspaces.push_back(createWorkspace());
+    for(int thread=0;thread<numThreads;thread++) {
+        Workspace& workspace = *_workspaces[thread];
+        OPENSIM_THROW_IF(workspace.poseTemplate.getNZ() != s.getNZ(),
+                Exception, "The copy of the model used to integrate the "
+                "actuators independently has a different number of states.");
+        workspace.poseTemplate.updZ() = s.getZ();
+    }
+    std::vector<std::unique_ptr<Control>> controls(pending.size());
+    for(int k=0;k<(int)pending.size();k++)
+        controls[k].reset(controlSet.get(pending[k]).clone());
+
+    if(numThreads == 1) {
+        for(int k=0;k<(int)pending.size();k++)
+            integrateActuator(pending[k], aX[pending[k]], *controls[k],
+                    *_workspaces[0]);
+    } else {
+        std::atomic<int> next(0);
+        std::vector<std::exception_ptr> errors(numThreads);
+        auto work = [&](int thread) {
+            try {
+                for(int k = next++; k < (int)pending.size(); k = next++) {
+                    integrateActuator(pending[k], aX[pending[k]],
+                            *controls[k], *_workspaces[thread]);
+                }
+            } catch (...) {
+                errors[thread] = std::current_exception();
+            }
+        };
+        std::vector<std::thread> workers;
+        for(int thread=1;thread<numThreads;thread++)
+            workers.emplace_back(work, thread);
+        work(0);
+        for(auto& worker : workers) worker.join();
+        for(const auto& error : errors) {
+            if(error) std::rethrow_exception(error);
+        }
+    }
+
+    // Vector function values
+    for(int i=0;i<N;i++) {
+        const IndependentActuator& actuator = _independentActuators[i];
+        rF[i] = actuator.actuations[actuator.current] - _f[i];
+    }
+
+    // The complete state holds the final states of all the actuators.
+    SimTK::State completeState = s;
+    getCMCActSubsys()->poseModel(completeState, _tf);
+    _model->getMultibodySystem().realize(completeState,
+            SimTK::Stage::Velocity);
+    for(const IndependentActuator& actuator : _independentActuators) {
+        const std::vector<double>& y = actuator.finalStates[actuator.current];
+        for(int j=0;j<(int)actuator.stateVariables.size();j++) {
+            actuator.stateVariables[j].first->setStateVariableValue(
+                    completeState, actuator.stateVariables[j].second, y[j]);
+        }
+    }
+    getCMCActSubsys()->setCompleteState(completeState);
+}
+//_____________________________________________________________________________
+/**
+ * Find the actuators controlled by CMC and their state variables.
+ */
+void VectorFunctionForActuators::
+initializeIndependentActuators()
+{
+    CMC& controller=  dynamic_cast<CMC&>(_model->updControllerSet().get("CMC" ));
+    const Set<const Actuator>& forceSet = controller.getActuatorSet();
+
+    _workspaces.clear();
+    _independentActuators.clear();
+    _independentActuators.resize(forceSet.getSize());
+    for(int i=0;i<forceSet.getSize();i++) {
+        IndependentActuator& actuator = _independentActuators[i];
+        actuator.actuator = dynamic_cast<const ScalarActuator*>(&forceSet[i]);
+        OPENSIM_THROW_IF(!actuator.actuator, Exception,
+                "Actuator '" + forceSet[i].getName() + "' is not a "
+                "ScalarActuator.");
+
+        // State variables of subcomponents are named by their path relative
+        // to the actuator.
+        const Array<std::string> names =
+                actuator.actuator->getStateVariableNames();
+        for(int j=0;j<names.getSize();j++) {
+            const std::string& name = names[j];
+            const auto slash = name.rfind('/');
+            if(slash == std::string::npos) {
+                actuator.stateVariables.emplace_back(actuator.actuator, name);
+            } else {
+                actuator.stateVariables.emplace_back(
+                        &actuator.actuator->getComponent(
+                                name.substr(0, slash)),
+                        name.substr(slash + 1));
+            }
+        }
+        actuator.initialStates.assign(actuator.stateVariables.size(),
+                SimTK::NaN);
+    }
+}
+//_____________________________________________________________________________
+/**
+ * Create the data used by one thread: a copy of the model, without
+ * controllers (controls are set explicitly), and an integrator for the
+ * states of one actuator at a time.
+ */
+std::unique_ptr<VectorFunctionForActuators::Workspace>
+VectorFunctionForActuators::
+createWorkspace()
+{
+    std::unique_ptr<Workspace> workspace(new Workspace());
+    Workspace& w = *workspace;
+    w.model.reset(_model->clone());
+    w.model->updControllerSet().clearAndDestroy();
+    w.poseTemplate = w.model->initSystem();
+
+    int maxNumStates = 0;
+    for(const IndependentActuator& actuator : _independentActuators) {
+        const auto& copy = w.model->getComponent<ScalarActuator>(
+                actuator.actuator->getAbsolutePath());
+        w.actuators.push_back(&copy);
+        std::vector<const Component*> owners;
+        for(const auto& variable : actuator.stateVariables) {
+            owners.push_back(&w.model->getComponent(
+                    variable.first->getAbsolutePath()));
+        }
+        w.stateVariableOwners.push_back(owners);
+        maxNumStates = std::max(maxNumStates,
+                (int)actuator.stateVariables.size());
+    }
+
+    w.system.reset(new IndependentActuatorSystem(maxNumStates,
+            [this, &w](const SimTK::State& s) {
+                calcActuatorDerivatives(s, w);
+            }));
+    w.systemState = w.system->realizeTopology();
+    w.integrator.reset(new SimTK::RungeKuttaMersonIntegrator(*w.system));
+    w.integrator->setAccuracy(_independentAccuracy);
+    w.integrator->setMaximumStepSize(_independentMaxStepSize);
+    return workspace;
+}
+//_____________________________________________________________________________
+/**
+ * Discard the poses and the results of the independent integrations.
+ */
+void VectorFunctionForActuators::
+clearIndependentResults()
+{
+    for(auto& workspace : _workspaces)
+        workspace->poses.clear();
+    for(IndependentActuator& actuator : _independentActuators) {
+        actuator.controls.clear();
+        actuator.actuations.clear();
+        actuator.finalStates.clear();
+        actuator.current = -1;
+    }
+}
+//_____________________________________________________________________________
+/**
+ * Get the copy of the model of a workspace posed at time t, realized to
+ * Stage::Velocity. Poses are created once per time and shared by all the
+ * actuators integrated with the workspace.
+ */
+const SimTK::State& VectorFunctionForActuators::
+getPose(double t, Workspace& workspace)
+{
+    const auto it = workspace.poses.find(t);
+    if(it != workspace.poses.end()) return it->second;
+
+    SimTK::State pose = workspace.poseTemplate;
+    {
+        std::lock_guard<std::mutex> lock(_poseMutex);
+        getCMCActSubsys()->poseModel(*workspace.model, pose, t);
+    }
+    workspace.model->getMultibodySystem().realize(pose,
+            SimTK::Stage::Velocity);
+    return workspace.poses[t] = pose;
+}
+//_____________________________________________________________________________
+/**
+ * Set the workspace state to the pose at time t with the given states of the
+ * actuator being integrated and its control at the time of the pose (which
+ * is the hold time if the coordinates are held constant). The controls and
+ * states of the other actuators are left as they are, since they do not
+ * affect this actuator.
+ */
+void VectorFunctionForActuators::
+setActuatorState(double t, const double* y, Workspace& workspace)
+{
+    workspace.state = getPose(t, workspace);
+
+    const ScalarActuator& actuator = *workspace.actuators[workspace.index];
+    workspace.controls.resize(workspace.model->getNumControls());
+    workspace.controls = 0.0;
+    workspace.actuatorControls[0] =
+            workspace.control->getControlValue(workspace.state.getTime());
+    actuator.addInControls(workspace.actuatorControls, workspace.controls);
+    workspace.model->setControls(workspace.state, workspace.controls);
+
+    const IndependentActuator& independent =
+            _independentActuators[workspace.index];
+    const auto& owners = workspace.stateVariableOwners[workspace.index];
+    for(int j=0;j<(int)owners.size();j++) {
+        owners[j]->setStateVariableValue(workspace.state,
+                independent.stateVariables[j].second, y[j]);
+    }
+}
+//_____________________________________________________________________________
+/**
+ * Compute the derivatives of the states of the actuator being integrated
+ * with a workspace, given the state of the system of the workspace.
+ */
+void VectorFunctionForActuators::
+calcActuatorDerivatives(const SimTK::State& s, Workspace& workspace)
+{
+    setActuatorState(s.getTime(), &s.getZ()[0], workspace);
+
+    const IndependentActuator& independent =
+            _independentActuators[workspace.index];
+    const auto& owners = workspace.stateVariableOwners[workspace.index];
+    SimTK::Vector& zDot = s.updZDot();
+    zDot = 0.0;
+    for(int j=0;j<(int)owners.size();j++) {
+        zDot[j] = owners[j]->getStateVariableDerivativeValue(workspace.state,
+                independent.stateVariables[j].second);
+    }
+}
+//_____________________________________________________________________________
+/**
+ * Integrate the states of an actuator from the initial to the final time
+ * with the given control, and record the resulting actuation and final
+ * states.
+ */
+void VectorFunctionForActuators::
+integrateActuator(int index, double x, Control& control, Workspace& workspace)
+{
+    IndependentActuator& actuator = _independentActuators[index];
+    workspace.index = index;
+    workspace.control = &control;
+
+    const int ny = (int)actuator.stateVariables.size();
+    std::vector<double> y = actuator.initialStates;
+    if(ny > 0) {
+        SimTK::State& systemState = workspace.systemState;
+        systemState.updZ() = 0.0;
+        for(int j=0;j<ny;j++) systemState.updZ()[j] = y[j];
+        systemState.setTime(_ti);
+
+        SimTK::TimeStepper ts(*workspace.system, *workspace.integrator);
+        ts.initialize(systemState);
+        ts.stepTo(_tf);
+
+        const SimTK::Vector& z = workspace.integrator->getState().getZ();
+        for(int j=0;j<ny;j++) y[j] = z[j];
+    }
+
+    // Actuation at the final time.
+    setActuatorState(_tf, y.data(), workspace);
+    const ScalarActuator& copy = *workspace.actuators[index];
+    copy.calcForceContribution(workspace.state, workspace.bodyForces,
+            workspace.generalizedForces);
+
+    actuator.controls.push_back(x);
+    actuator.actuations.push_back(copy.getActuation(workspace.state));
+    actuator.finalStates.push_back(y);
+    actuator.current = (int)actuator.controls.size() - 1;
+}
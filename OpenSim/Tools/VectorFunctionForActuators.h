@@ -30,6 +30,12 @@
 #include <OpenSim/Common/Array.h>
 #include <OpenSim/Common/VectorFunctionUncoupledNxN.h>
 
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace SimTK {
 class Integrator;
 class System;
@@ -40,7 +46,10 @@ class System;
 namespace OpenSim { 
 
 class CMCActuatorSubsystem;
+class Component;
+class Control;
 class Model;
+class ScalarActuator;
 
 /**
  * An abstract class for representing a vector function.
@@ -79,6 +88,43 @@ protected:
     SimTK::Integrator* _integrator;
     /** Model */
     Model* _model;
+    /** Flag indicating whether the states of each actuator are integrated
+    independently of those of the other actuators. */
+    bool _integrateActuatorsIndependently;
+    /** Number of threads used to integrate the actuators independently. */
+    int _numThreads;
+    /** Accuracy and maximum step size of the integrators used to integrate
+    the actuators independently. */
+    double _independentAccuracy;
+    double _independentMaxStepSize;
+
+private:
+    /** An actuator whose states are integrated independently. */
+    struct IndependentActuator {
+        const ScalarActuator* actuator{nullptr};
+        /** The component that owns each of the actuator's state variables
+        (the actuator or one of its subcomponents), and the name of the
+        variable in that component. */
+        std::vector<std::pair<const Component*, std::string>> stateVariables;
+        /** Initial values of the state variables. */
+        std::vector<double> initialStates;
+        /** Controls already integrated over the current time interval, with
+        the actuation and final states that each produced. */
+        std::vector<double> controls;
+        std::vector<double> actuations;
+        std::vector<std::vector<double>> finalStates;
+        /** Index of the entry above used by the last evaluation. */
+        int current{-1};
+    };
+    struct Workspace;
+
+    std::vector<IndependentActuator> _independentActuators;
+    /** One workspace, with its own copy of the model, per thread. */
+    std::vector<std::unique_ptr<Workspace>> _workspaces;
+    /** Serializes posing the copies of the model, since the coordinate
+    trajectories of the CMC actuator subsystem are not safe to evaluate
+    concurrently. */
+    std::mutex _poseMutex;
 
 
 //=============================================================================
@@ -115,6 +161,41 @@ public:
     void getTargetForces(double *rF) const;
     CMCActuatorSubsystem* getCMCActSubsys();
 
+    /** %Set whether evaluate() integrates the states of each actuator
+    independently of the other actuators, rather than integrating the states
+    of all actuators together with the CMC actuator system. The activation
+    and fiber dynamics of an actuator depend only on its own states, its own
+    control and the prescribed kinematics, so they can be integrated on their
+    own, each with its own step size. The kinematics of the model are computed
+    once per time visited and shared by all actuators, and an actuator is not
+    integrated again over the same interval for a control it has already been
+    evaluated with (e.g., once its root has converged). States of components
+    that are not actuators controlled by CMC keep their initial values.
+    Each thread integrates the actuators on its own copy of the model with
+    a Runge-Kutta-Merson integrator (see setIndependentIntegratorAccuracy()),
+    and the controls are evaluated from the control set of CMC.
+    The default is false.
+
+    The cached kinematics and results are discarded by setInitialTime() and
+    setFinalTime(), which must therefore be called after changing the
+    coordinate corrections of the CMC actuator subsystem. */
+    void setIntegrateActuatorsIndependently(bool aTrueFalse);
+    bool getIntegrateActuatorsIndependently() const;
+    /** %Set the number of threads used to integrate the actuators when they
+    are integrated independently. The default is 1. */
+    void setNumThreads(int aNumThreads);
+    int getNumThreads() const;
+    /** %Set the accuracy of the integrators used when the actuators are
+    integrated independently. The default, 5e-6, is the accuracy of the
+    integrator of the CMC actuator system. */
+    void setIndependentIntegratorAccuracy(double aAccuracy);
+    double getIndependentIntegratorAccuracy() const;
+    /** %Set the maximum step size of the integrators used when the actuators
+    are integrated independently. The default, 1e-3, is the maximum step size
+    of the integrator of the CMC actuator system. */
+    void setIndependentIntegratorMaximumStepSize(double aMaxStepSize);
+    double getIndependentIntegratorMaximumStepSize() const;
+
     
     //--------------------------------------------------------------------------
     // EVALUATE
@@ -146,6 +227,19 @@ public:
     virtual void evaluate(const Array<double> &rY) {}
     virtual void evaluate(Array<double> &rY, const Array<int> &aDerivWRT) {}
 
+private:
+    void evaluateIndependently(const SimTK::State& s, const double *aX,
+            double *rF);
+    void initializeIndependentActuators();
+    std::unique_ptr<Workspace> createWorkspace();
+    void integrateActuator(int index, double x, Control& control,
+            Workspace& workspace);
+    void calcActuatorDerivatives(const SimTK::State& s,
+            Workspace& workspace);
+    void setActuatorState(double t, const double* y, Workspace& workspace);
+    const SimTK::State& getPose(double t, Workspace& workspace);
+    void clearIndependentResults();
+
 
 //=============================================================================
 };  // END class VectorFunctionForActuators